@@ -65,6 +65,12 @@ struct cache_sel_matrix_config final : public rconfig::base_config {
   bool                         strict_constraints{true};
 
   rtypes::spatial_dist         new_cache_tol{0.0};
+
+  /**
+   * \brief The backend used to compute cache sites: either \c "nlopt" or
+   * \c "grid" (fixed cost grid search + local refinement).
+   */
+  std::string                  site_solver{"nlopt"};
 };
 
 NS_END(cache_sel, config, fordyca);
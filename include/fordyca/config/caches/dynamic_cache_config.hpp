@@ -72,6 +72,20 @@ struct dynamic_cache_config final : public rconfig::base_config {
    * which may not be desirable.
    */
   bool   robot_drop_only{false};
+
+  /**
+   * \brief If > 0, then dynamic cache creation triggered by robot block drops
+   * only considers free blocks and existing caches within this distance of the
+   * location(s) of the drop(s) that timestep, rather than the whole arena.
+   */
+  rtypes::spatial_dist local_radius{0.0};
+
+  /**
+   * \brief If > 0, then dynamic cache creation over the whole arena is also
+   * performed every this many timesteps (in addition to at initialization and
+   * reset).
+   */
+  uint   global_interval{0};
 };
 
 NS_END(caches, config, fordyca);
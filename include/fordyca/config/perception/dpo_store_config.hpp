@@ -0,0 +1,58 @@
+/**
+ * \file dpo_store_config.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_CONFIG_PERCEPTION_DPO_STORE_CONFIG_HPP_
+#define INCLUDE_FORDYCA_CONFIG_PERCEPTION_DPO_STORE_CONFIG_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "rcppsw/config/base_config.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, config, perception);
+
+/*******************************************************************************
+ * Structure Definitions
+ ******************************************************************************/
+/**
+ * \struct dpo_store_config
+ * \ingroup config perception
+ *
+ * \brief Configuration for the \ref ds::dpo_store used by DPO robots.
+ *
+ * - \c max_blocks - The max # of blocks a robot will track at once. When it is
+ *   reached, the block with the lowest pheromone density is forgotten to make
+ *   room for a new one. 0 = unlimited.
+ *
+ * - \c max_caches - Same as \c max_blocks, but for caches.
+ */
+struct dpo_store_config final : public rconfig::base_config {
+  size_t max_blocks{0};
+  size_t max_caches{0};
+};
+
+NS_END(perception, config, fordyca);
+
+#endif /* INCLUDE_FORDYCA_CONFIG_PERCEPTION_DPO_STORE_CONFIG_HPP_ */
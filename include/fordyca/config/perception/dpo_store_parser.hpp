@@ -0,0 +1,75 @@
+/**
+ * \file dpo_store_parser.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_CONFIG_PERCEPTION_DPO_STORE_PARSER_HPP_
+#define INCLUDE_FORDYCA_CONFIG_PERCEPTION_DPO_STORE_PARSER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <memory>
+#include <string>
+
+#include "rcppsw/config/xml/xml_config_parser.hpp"
+
+#include "fordyca/config/perception/dpo_store_config.hpp"
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, config, perception);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class dpo_store_parser
+ * \ingroup config perception
+ *
+ * \brief Parses XML configuration for the DPO store robots use into \ref
+ * dpo_store_config.
+ */
+class dpo_store_parser final : public rconfig::xml::xml_config_parser {
+ public:
+  using config_type = dpo_store_config;
+
+  /**
+   * \brief The root tag that all XML configuration for the DPO store should lie
+   * under in the XML tree.
+   */
+  inline static const std::string kXMLRoot = "dpo_store";
+
+  void parse(const ticpp::Element& node) override RCPPSW_COLD;
+  std::string xml_root(void) const override { return kXMLRoot; }
+
+ private:
+  const rconfig::base_config* config_get_impl(void) const override {
+    return m_config.get();
+  }
+
+  /* clang-format off */
+  std::unique_ptr<config_type> m_config{nullptr};
+  /* clang-format on */
+};
+
+NS_END(perception, config, fordyca);
+
+#endif /* INCLUDE_FORDYCA_CONFIG_PERCEPTION_DPO_STORE_PARSER_HPP_ */
@@ -24,15 +24,13 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
-#include <boost/variant.hpp>
-#include <map>
 #include <string>
-#include <vector>
 
 #include "rcppsw/math/vector2.hpp"
 #include "rcppsw/types/type_uuid.hpp"
 
 #include "fordyca/config/block_sel/block_pickup_policy_config.hpp"
+#include "fordyca/controller/cognitive/sel_exception_list.hpp"
 #include "fordyca/fordyca.hpp"
 
 /*******************************************************************************
@@ -44,17 +42,6 @@ struct block_sel_matrix_config;
 }} // namespace config::block_sel
 NS_START(controller, cognitive);
 
-/**
- * \brief \ref boost::variant containing all the different object/POD types that
- * are mapped to within the \ref block_sel_matrix; multiple entries in the
- * matrix can have the same type.
- */
-using block_sel_variant =
-    boost::variant<double,
-                   rmath::vector2d,
-                   std::vector<rtypes::type_uuid>,
-                   config::block_sel::block_pickup_policy_config>;
-
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
@@ -62,29 +49,40 @@ using block_sel_variant =
  * \class block_sel_matrix
  * \ingroup controller cognitive
  *
- * \brief A dictionary of information needed by robots using various utility
- * functions to calculate the best:
+ * \brief The information needed by robots using various utility functions to
+ * calculate the best:
  *
  * - block (of whatever type)
+ *
+ * Each piece of information is a typed field, so reads during selection are
+ * plain loads rather than map lookups.
  */
-class block_sel_matrix : public std::map<std::string, block_sel_variant> {
+class block_sel_matrix {
  public:
-  inline static const std::string kNestLoc = "nest_loc";
-  inline static const std::string kCubePriority = "cube_priority";
-  inline static const std::string kRampPriority = "ramp_priority";
-  inline static const std::string kSelExceptions = "sel_exceptions";
-
   /**
    * \brief The conditions that must be satisfied before a robot will be
    * able to pickup a block (if applicable).
    */
-  inline static const std::string kPickupPolicy = "pickup_policy";
   inline static const std::string kPickupPolicyNull = "";
   inline static const std::string kPickupPolicyClusterProx = "cluster_proximity";
 
-  explicit block_sel_matrix(
-      const config::block_sel::block_sel_matrix_config* config,
-      const rmath::vector2d& nest_loc);
+  block_sel_matrix(const config::block_sel::block_sel_matrix_config* config,
+                   const rmath::vector2d& nest_loc);
+
+  /* Not copy constructible/assignable by default */
+  block_sel_matrix(const block_sel_matrix&) = delete;
+  block_sel_matrix& operator=(const block_sel_matrix&) = delete;
+
+  const rmath::vector2d& nest_loc(void) const { return mc_nest_loc; }
+  double cube_priority(void) const { return mc_cube_priority; }
+  double ramp_priority(void) const { return mc_ramp_priority; }
+  const config::block_sel::block_pickup_policy_config& pickup_policy(
+      void) const {
+    return mc_pickup_policy;
+  }
+  const sel_exception_list& sel_exceptions(void) const {
+    return m_sel_exceptions;
+  }
 
   /**
    * \brief Add a block to the exception list, disqualifying it from being
@@ -103,6 +101,16 @@ class block_sel_matrix : public std::map<std::string, block_sel_variant> {
    * that block up again as part of a task).
    */
   void sel_exceptions_clear(void);
+
+ private:
+  /* clang-format off */
+  const rmath::vector2d                               mc_nest_loc;
+  const double                                        mc_cube_priority;
+  const double                                        mc_ramp_priority;
+  const config::block_sel::block_pickup_policy_config mc_pickup_policy;
+
+  sel_exception_list                                  m_sel_exceptions{};
+  /* clang-format on */
 };
 
 NS_END(cognitive, controller, fordyca);
@@ -25,6 +25,7 @@
  * Includes
  ******************************************************************************/
 #include <list>
+#include <vector>
 
 #include "rcppsw/er/client.hpp"
 #include "rcppsw/math/vector2.hpp"
@@ -66,6 +67,13 @@ class block_selector : public rer::client<block_selector> {
   const crepr::base_block3D* operator()(const ds::dp_block_map& blocks,
                                         const rmath::vector2d& position);
 
+  /**
+   * \brief The factor the densities of all blocks can decay by before the
+   * result of the last selection may change (see \ref
+   * math::utility_batch::decay_floor()).
+   */
+  double decay_floor(void) const { return m_decay_floor; }
+
  private:
   /**
    * \brief Determine if the specified block is excluded from being considered
@@ -82,10 +90,13 @@ class block_selector : public rer::client<block_selector> {
    * \return \c TRUE if the cache should be excluded, \c FALSE otherwise.
    */
   bool block_is_excluded(const rmath::vector2d& position,
-                         const crepr::base_block3D* block) const;
+                         const crepr::base_block3D* block,
+                         const sel_exception_list& exceptions) const;
 
   /* clang-format off */
   const block_sel_matrix* const mc_matrix;
+
+  double                        m_decay_floor{0.0};
   /* clang-format on */
 };
 
@@ -24,10 +24,7 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
-#include <boost/variant.hpp>
-#include <map>
 #include <string>
-#include <vector>
 
 #include "rcppsw/er/client.hpp"
 #include "rcppsw/math/range.hpp"
@@ -36,6 +33,7 @@
 
 #include "fordyca/config/cache_sel/cache_pickup_policy_config.hpp"
 #include "fordyca/controller/cognitive/cache_sel_exception.hpp"
+#include "fordyca/controller/cognitive/sel_exception_list.hpp"
 #include "fordyca/fordyca.hpp"
 
 /*******************************************************************************
@@ -47,19 +45,6 @@ struct cache_sel_matrix_config;
 } // namespace config::cache_sel
 NS_START(controller, cognitive);
 
-/**
- * \brief \ref boost::variant containing all the different object/POD types that
- * are mapped to within the \ref cache_sel_matrix; multiple entries in the
- * matrix can have the same type.
- */
-using cache_sel_variant =
-    boost::variant<rtypes::spatial_dist,
-                   rmath::vector2d,
-                   rmath::rangeu,
-                   std::vector<rtypes::type_uuid>,
-                   config::cache_sel::cache_pickup_policy_config,
-                   bool>;
-
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
@@ -67,47 +52,61 @@ using cache_sel_variant =
  * \class cache_sel_matrix
  * \ingroup controller cognitive
  *
- * \brief A dictionary of information needed by robots using various utility
- * functions to calculate the best:
+ * \brief The information needed by robots using various utility functions to
+ * calculate the best:
  *
  * - existing cache
  * - new cache
  * - cache site
  *
+ * Each piece of information is a typed field, so reads during selection are
+ * plain loads rather than map lookups.
+ *
  * This class may be separated into those components in the future if it makes
  * sense. For now, it is cleaner to have all three uses be in the same class.
  */
-class cache_sel_matrix final
-    : public rer::client<cache_sel_matrix>,
-      private std::map<std::string, cache_sel_variant> {
+class cache_sel_matrix final : public rer::client<cache_sel_matrix> {
  public:
-  inline static const std::string kNestLoc = "nest_loc";
-  inline static const std::string kCacheProxDist = "cache_prox_dist";
-  inline static const std::string kClusterProxDist = "cluster_prox_dist";
-  inline static const std::string kBlockProxDist = "block_prox_dist";
-  inline static const std::string kNestProxDist = "nest_prox_dist";
-  inline static const std::string kSiteXRange = "site_xrange";
-  inline static const std::string kSiteYRange = "site_yrange";
-  inline static const std::string kPickupExceptions = "pickup_exceptions";
-  inline static const std::string kDropExceptions = "drop_exceptions";
-  inline static const std::string kStrictConstraints = "strict_constraints";
-  inline static const std::string kNewCacheDropTolerance = "new_cache_tol";
-
   /**
    * \brief Policy that must be satisfied before a robot will be able to pickup
    * from *ANY* cache.
    */
-  inline static const std::string kPickupPolicy = "pickup_policy";
   inline static const std::string kPickupPolicyNull = "";
   inline static const std::string kPickupPolicyTime = "time";
   inline static const std::string kPickupPolicyCacheSize = "cache_size";
   inline static const std::string kPickupPolicyCacheDuration = "cache_duration";
 
-  using std::map<std::string, cache_sel_variant>::find;
   cache_sel_matrix(const config::cache_sel::cache_sel_matrix_config* config,
                    const rmath::vector2d& nest_loc);
   ~cache_sel_matrix(void) override = default;
 
+  /* Not copy constructible/assignable by default */
+  cache_sel_matrix(const cache_sel_matrix&) = delete;
+  cache_sel_matrix& operator=(const cache_sel_matrix&) = delete;
+
+  const rmath::vector2d& nest_loc(void) const { return mc_nest_loc; }
+  rtypes::spatial_dist cache_prox_dist(void) const { return mc_cache_prox_dist; }
+  rtypes::spatial_dist cluster_prox_dist(void) const {
+    return mc_cluster_prox_dist;
+  }
+  rtypes::spatial_dist block_prox_dist(void) const { return mc_block_prox_dist; }
+  rtypes::spatial_dist nest_prox_dist(void) const { return mc_nest_prox_dist; }
+  const rmath::rangeu& site_xrange(void) const { return mc_site_xrange; }
+  const rmath::rangeu& site_yrange(void) const { return mc_site_yrange; }
+  bool strict_constraints(void) const { return mc_strict_constraints; }
+  rtypes::spatial_dist new_cache_tol(void) const { return mc_new_cache_tol; }
+  const std::string& site_solver(void) const { return mc_site_solver; }
+  const config::cache_sel::cache_pickup_policy_config& pickup_policy(
+      void) const {
+    return mc_pickup_policy;
+  }
+  const sel_exception_list& pickup_exceptions(void) const {
+    return m_pickup_exceptions;
+  }
+  const sel_exception_list& drop_exceptions(void) const {
+    return m_drop_exceptions;
+  }
+
   /**
    * \brief Add a cache to the exception list, disqualifying it from being
    * selected as a cache to pick up a block from/drop a block in, regardless of
@@ -126,6 +125,24 @@ class cache_sel_matrix final
    * existing cache).
    */
   void sel_exceptions_clear(void);
+
+ private:
+  /* clang-format off */
+  const rmath::vector2d                               mc_nest_loc;
+  const rtypes::spatial_dist                          mc_cache_prox_dist;
+  const rtypes::spatial_dist                          mc_cluster_prox_dist;
+  const rtypes::spatial_dist                          mc_block_prox_dist;
+  const rtypes::spatial_dist                          mc_nest_prox_dist;
+  const rmath::rangeu                                 mc_site_xrange;
+  const rmath::rangeu                                 mc_site_yrange;
+  const bool                                          mc_strict_constraints;
+  const rtypes::spatial_dist                          mc_new_cache_tol;
+  const std::string                                   mc_site_solver;
+  const config::cache_sel::cache_pickup_policy_config mc_pickup_policy;
+
+  sel_exception_list                                  m_pickup_exceptions{};
+  sel_exception_list                                  m_drop_exceptions{};
+  /* clang-format on */
 };
 
 NS_END(cognitive, controller, fordyca);
@@ -27,13 +27,17 @@
 #include <memory>
 
 #include "fordyca/controller/reactive/d0/crw_controller.hpp"
+#include "fordyca/metrics/perception/selection_memo_metrics.hpp"
 
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca);
 
-namespace fsm { namespace d0 { class dpo_fsm; }}
+namespace fsm {
+class selection_memo_counts;
+namespace d0 { class dpo_fsm; }
+} /* namespace fsm */
 
 namespace config {
 namespace d0 { class dpo_controller_repository; }
@@ -56,7 +60,8 @@ NS_START(d0);
  * time (knowledge is modeled by pheromone density and decays as such).
  */
 class dpo_controller : public reactive::d0::crw_controller,
-                       public rer::client<dpo_controller> {
+                       public rer::client<dpo_controller>,
+                       public metrics::perception::selection_memo_metrics {
  public:
   dpo_controller(void) RCPPSW_COLD;
   ~dpo_controller(void) override RCPPSW_COLD;
@@ -81,6 +86,10 @@ class dpo_controller : public reactive::d0::crw_controller,
   RCPPSW_WRAP_DECL_OVERRIDE(rmath::vector3z, vector_loc3D, const);
   RCPPSW_WRAP_DECL_OVERRIDE(rtypes::type_uuid, entity_acquired_id, const);
 
+  /* selection memo metrics */
+  uint n_memo_hits(void) const override RCPPSW_PURE;
+  uint n_memo_misses(void) const override RCPPSW_PURE;
+
   /* block transportation */
   RCPPSW_WRAP_DECL_OVERRIDE(fsm::foraging_transport_goal,
                             block_transport_goal,
@@ -119,6 +128,12 @@ class dpo_controller : public reactive::d0::crw_controller,
   dpo_perception_subsystem* dpo_perception(void) RCPPSW_PURE;
   const dpo_perception_subsystem* dpo_perception(void) const RCPPSW_PURE;
 
+  /**
+   * \brief The hit/miss counts of the selection memos of all FSMs the
+   * controller uses, including those of derived classes.
+   */
+  fsm::selection_memo_counts* memo_counts(void) { return m_memo_counts.get(); }
+
   fsm::d0::dpo_fsm* fsm(void) { return m_fsm.get(); }
   const fsm::d0::dpo_fsm* fsm(void) const { return m_fsm.get(); }
 
@@ -171,7 +186,8 @@ class dpo_controller : public reactive::d0::crw_controller,
   bool                                           m_display_los{false};
   std::unique_ptr<class block_sel_matrix>        m_block_sel_matrix;
   std::unique_ptr<foraging_perception_subsystem> m_perception;
-  std::unique_ptr<fsm::d0::dpo_fsm>          m_fsm;
+  std::unique_ptr<fsm::d0::dpo_fsm>              m_fsm;
+  std::unique_ptr<fsm::selection_memo_counts>    m_memo_counts;
   /* clang-format on */
 };
 
@@ -53,6 +53,10 @@ namespace ds {
 class dpo_store;
 }
 
+namespace fsm {
+class selection_memo_counts;
+} /* namespace fsm */
+
 NS_START(controller, cognitive);
 class cache_sel_matrix;
 class block_sel_matrix;
@@ -75,7 +79,8 @@ class task_executive_builder : public rer::client<task_executive_builder> {
   task_executive_builder(const controller::cognitive::block_sel_matrix* bsel_matrix,
                       const controller::cognitive::cache_sel_matrix* csel_matrix,
                       csubsystem::saa_subsystemQ3D* saa,
-                      foraging_perception_subsystem* perception) RCPPSW_COLD;
+                      foraging_perception_subsystem* perception,
+                      fsm::selection_memo_counts* memo_counts) RCPPSW_COLD;
 
   ~task_executive_builder(void) override RCPPSW_COLD;
   task_executive_builder& operator=(const task_executive_builder&) = delete;
@@ -103,6 +108,10 @@ class task_executive_builder : public rer::client<task_executive_builder> {
     return mc_csel_matrix;
   }
 
+  RCPPSW_COLD fsm::selection_memo_counts* memo_counts(void) const {
+    return m_memo_counts;
+  }
+
   RCPPSW_COLD tasking_map d1_tasks_create(
       const config::d1::controller_repository& config_repo,
       cta::ds::bi_tdgraph* graph,
@@ -126,6 +135,7 @@ class task_executive_builder : public rer::client<task_executive_builder> {
 
   csubsystem::saa_subsystemQ3D* const              m_saa;
   foraging_perception_subsystem* const                 m_perception;
+  fsm::selection_memo_counts* const                    m_memo_counts;
 
   /* clang-format on */
 };
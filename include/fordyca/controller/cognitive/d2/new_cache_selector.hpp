@@ -25,6 +25,7 @@
  * Includes
  ******************************************************************************/
 #include <list>
+#include <vector>
 
 #include "rcppsw/er/client.hpp"
 #include "rcppsw/math/vector2.hpp"
@@ -67,7 +68,14 @@ class new_cache_selector: public rer::client<new_cache_selector> {
    */
   const crepr::base_block3D* operator()(const ds::dp_block_map& new_caches,
                                         const ds::dp_cache_map& existing_caches,
-                                        const rmath::vector2d& position) const;
+                                        const rmath::vector2d& position);
+
+  /**
+   * \brief The factor the densities of all new caches can decay by before the
+   * result of the last selection may change (see \ref
+   * math::utility_batch::decay_floor()).
+   */
+  double decay_floor(void) const { return m_decay_floor; }
 
  private:
   bool new_cache_is_excluded(const ds::dp_cache_map& existing_caches,
@@ -76,6 +84,8 @@ class new_cache_selector: public rer::client<new_cache_selector> {
 
   /* clang-format off */
   const controller::cognitive::cache_sel_matrix* const mc_matrix;
+
+  double                                               m_decay_floor{0.0};
   /* clang-format on */
 };
 
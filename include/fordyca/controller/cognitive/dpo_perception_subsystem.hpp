@@ -28,9 +28,11 @@
 #include <string>
 
 #include "rcppsw/er/client.hpp"
+#include "rcppsw/math/vector2.hpp"
 
 #include "cosm/ds/entity_vector.hpp"
 
+#include "fordyca/config/perception/dpo_store_config.hpp"
 #include "fordyca/controller/cognitive/foraging_perception_subsystem.hpp"
 #include "fordyca/fordyca.hpp"
 #include "fordyca/metrics/perception/dpo_perception_metrics.hpp"
@@ -59,7 +61,13 @@ class dpo_perception_subsystem final
       public foraging_perception_subsystem,
       public metrics::perception::dpo_perception_metrics {
  public:
-  explicit dpo_perception_subsystem(const cspconfig::perception_config* config);
+  /**
+   * \param config Perception configuration.
+   * \param store_config Configuration for the DPO store. May be NULL, in which
+   *                     case the store is unbounded.
+   */
+  dpo_perception_subsystem(const cspconfig::perception_config* config,
+                           const fcperception::dpo_store_config* store_config);
   ~dpo_perception_subsystem(void) override;
 
   /* DPO perception metrics */
@@ -67,6 +75,8 @@ class dpo_perception_subsystem final
   uint n_known_caches(void) const override RCPPSW_PURE;
   crepr::pheromone_density avg_block_density(void) const override;
   crepr::pheromone_density avg_cache_density(void) const override;
+  uint n_evicted_blocks(void) const override RCPPSW_PURE;
+  uint n_evicted_caches(void) const override RCPPSW_PURE;
 
   /**
    * \brief Update the robot's perception of the environment, passing it its
@@ -96,13 +106,43 @@ class dpo_perception_subsystem final
   void process_los_blocks(const repr::forager_los* c_los);
   void process_los_caches(const repr::forager_los* c_los);
 
+  /**
+   * \brief Determine if neither the bounds of the LOS nor the contents of the
+   * part of the arena it views have changed since the last time it was
+   * processed, and remember its bounds/epoch for next time.
+   */
+  bool los_unchanged(const repr::forager_los* c_los);
+
+  /**
+   * \brief Refresh the densities of the blocks/caches in an unchanged LOS,
+   * which is all that processing it would do.
+   *
+   * \return \c FALSE if something in the LOS is not tracked in the store as
+   * expected (e.g. it was removed for some other reason since the LOS was last
+   * processed), in which case the LOS must be processed fully.
+   */
+  bool los_blocks_refresh(const repr::forager_los* c_los);
+  bool los_caches_refresh(const repr::forager_los* c_los);
+
   void los_tracking_sync(const repr::forager_los* c_los,
                          const cads::bcache_vectorno& los_caches);
   void los_tracking_sync(const repr::forager_los* c_los,
                          const cds::block3D_vectorno& los_blocks);
 
+  /**
+   * \brief The bounds of the LOS and the epoch of the part of the arena it
+   * viewed the last time it was processed.
+   */
+  struct los_stamp {
+    rmath::vector2z ll{};
+    rmath::vector2z ur{};
+    uint            epoch{0};
+    bool            valid{false};
+  };
+
   /* clang-format off */
   std::unique_ptr<ds::dpo_store> m_store;
+  los_stamp                      m_los_stamp{};
   /* clang-format on */
 };
 
@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "rcppsw/er/client.hpp"
+#include "rcppsw/math/vector2.hpp"
 
 #include "cosm/subsystem/perception/config/perception_config.hpp"
 
@@ -94,6 +95,43 @@ class mdpo_perception_subsystem final
   ds::dpo_store* dpo_store(void) override RCPPSW_PURE;
 
  private:
+  /**
+   * \brief A difference between the LOS and the robot's perceived arena map
+   * found by \ref los_diff_scan().
+   */
+  enum class los_diff_type {
+    /**
+     * \brief The map thinks the cell has a block, but it does not.
+     */
+    ekBLOCK_VANISHED,
+
+    /**
+     * \brief The map thinks the cell has a cache, but it does not.
+     */
+    ekCACHE_VANISHED,
+
+    /**
+     * \brief The cell is unknown in the map, but is known in the LOS.
+     */
+    ekCELL_KNOWN
+  };
+
+  struct los_diff {
+    los_diff_type   type;
+    rmath::vector2z loc;
+  };
+
+  /**
+   * \brief Compare the LOS with the matching window of the robot's perceived
+   * arena map in a single pass, building the list of differences between them
+   * to be processed by \ref process_los_blocks()/\ref process_los_caches(),
+   * and updating the aggregate stats on inaccuracies in the map for this
+   * timestep.
+   *
+   * \param c_los The current LOS.
+   */
+  void los_diff_scan(const repr::forager_los* c_los);
+
   /*
    * \brief Update the perceived arena map with the current line-of-sight,
    * update the relevance of information (density) within it, and fix any blocks
@@ -106,16 +144,9 @@ class mdpo_perception_subsystem final
   void process_los_blocks(const repr::forager_los* c_los);
   void process_los_caches(const repr::forager_los* c_los);
 
-  /**
-   * \brief Update the aggregate stats on inaccuracies in the robot's perceived
-   * arena map for this timestep.
-   *
-   * \param c_los The current LOS
-   */
-  void update_cell_stats(const repr::forager_los* c_los);
-
   /* clang-format off */
   std::vector<uint>                     m_cell_stats;
+  std::vector<los_diff>                 m_los_diff{};
   std::unique_ptr<repr::forager_los>   m_los;
   std::unique_ptr<ds::dpo_semantic_map> m_map;
   /* clang-format on */
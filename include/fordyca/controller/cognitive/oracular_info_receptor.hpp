@@ -43,6 +43,8 @@ class foraging_oracle;
 
 namespace fordyca::ds {
 class dpo_store;
+class arena_snapshot_pool;
+class oracle_knowledge;
 } /* namespace fordyca::ds */
 
 NS_START(fordyca, controller, cognitive);
@@ -63,9 +65,11 @@ NS_START(fordyca, controller, cognitive);
 
 class oracular_info_receptor final : public rer::client<oracular_info_receptor> {
  public:
-  explicit oracular_info_receptor(const cforacle::foraging_oracle* oracle)
+  oracular_info_receptor(const cforacle::foraging_oracle* oracle,
+                         const ds::oracle_knowledge* knowledge)
       : ER_CLIENT_INIT("fordyca.controller.oracular_info_receptor"),
-        mc_oracle(oracle) {}
+        mc_oracle(oracle),
+        mc_knowledge(knowledge) {}
 
   oracular_info_receptor(const oracular_info_receptor&) = delete;
   oracular_info_receptor& operator=(const oracular_info_receptor&) = delete;
@@ -77,6 +81,13 @@ class oracular_info_receptor final : public rer::client<oracular_info_receptor>
    * whenever we change tasks (complete/abort), we need to synchronously
    * (per-timestep) update our perception of entities in the environment by
    * calling this function in the controller.
+   *
+   * If the store is backed by an \ref ds::arena_snapshot_pool, only the
+   * entities which have been added/removed/moved since the last update are
+   * processed; otherwise (or if we have fallen too far behind), the complete
+   * set of oracular entities is. Either way, the densities of the types of
+   * entities the oracle provides do not decay in the store, as the oracle
+   * keeps all of them current.
    */
   void dpo_store_update(ds::dpo_store* store);
 
@@ -102,8 +113,27 @@ class oracular_info_receptor final : public rer::client<oracular_info_receptor>
   void exec_est_update(cta::polled_task* task);
   void int_est_update(cta::polled_task* task);
 
+  /**
+   * \brief Replay the complete set of free blocks/caches in the arena, as
+   * kept current by the loop functions in the \ref ds::oracle_knowledge, into
+   * the store.
+   */
+  void dpo_store_full_update(ds::dpo_store* store);
+
+  /**
+   * \brief Replay only the blocks/caches which have changed in the arena since
+   * the last synchronized epoch into the store. The cost is proportional to
+   * the # of changes, not the # of entities in the store: unchanged entities
+   * are not touched, and hold the densities they were last refreshed to.
+   */
+  void dpo_store_delta_update(ds::dpo_store* store,
+                              const ds::arena_snapshot_pool* pool);
+
   /* clang-format off */
   const cforacle::foraging_oracle* mc_oracle;
+  const ds::oracle_knowledge*      mc_knowledge;
+  bool                             m_synced{false};
+  uint                             m_epoch{0};
   /* clang-format on */
 };
 
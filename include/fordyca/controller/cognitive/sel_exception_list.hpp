@@ -0,0 +1,105 @@
+/**
+ * \file sel_exception_list.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_CONTROLLER_COGNITIVE_SEL_EXCEPTION_LIST_HPP_
+#define INCLUDE_FORDYCA_CONTROLLER_COGNITIVE_SEL_EXCEPTION_LIST_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <vector>
+
+#include "rcppsw/types/type_uuid.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, controller, cognitive);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class sel_exception_list
+ * \ingroup controller cognitive
+ *
+ * \brief The list of objects (blocks or caches) a robot is currently not
+ * allowed to select, regardless of their utility.
+ *
+ * Kept sorted by ID, so membership tests during selection are a binary search
+ * over a small contiguous array. Lists are only ever a handful of entries long
+ * (they are cleared every task), so insertion cost is not a concern.
+ *
+ * Each change to the list bumps its \ref version(), so that selections made
+ * against the list can be cached until it changes.
+ */
+class sel_exception_list {
+ public:
+  sel_exception_list(void) = default;
+
+  size_t size(void) const { return m_ids.size(); }
+  bool empty(void) const { return m_ids.empty(); }
+
+  /**
+   * \brief Monotonically increasing counter which changes whenever the
+   * contents of the list change.
+   */
+  size_t version(void) const { return m_version; }
+
+  /**
+   * \brief Add an ID to the list; duplicates are ignored.
+   */
+  void add(const rtypes::type_uuid& id) {
+    auto it = std::lower_bound(m_ids.begin(), m_ids.end(), id, id_cmp);
+    if (it == m_ids.end() || it->v() != id.v()) {
+      m_ids.insert(it, id);
+      ++m_version;
+    }
+  }
+
+  bool contains(const rtypes::type_uuid& id) const {
+    return std::binary_search(m_ids.begin(), m_ids.end(), id, id_cmp);
+  }
+
+  void clear(void) {
+    if (!m_ids.empty()) {
+      m_ids.clear();
+      ++m_version;
+    }
+  }
+
+ private:
+  static bool id_cmp(const rtypes::type_uuid& id1,
+                     const rtypes::type_uuid& id2) {
+    return id1.v() < id2.v();
+  }
+
+  /* clang-format off */
+  std::vector<rtypes::type_uuid> m_ids{};
+  size_t                         m_version{0};
+  /* clang-format on */
+};
+
+NS_END(cognitive, controller, fordyca);
+
+#endif /* INCLUDE_FORDYCA_CONTROLLER_COGNITIVE_SEL_EXCEPTION_LIST_HPP_ */
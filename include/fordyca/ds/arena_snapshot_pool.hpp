@@ -0,0 +1,363 @@
+/**
+ * \file arena_snapshot_pool.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_DS_ARENA_SNAPSHOT_POOL_HPP_
+#define INCLUDE_FORDYCA_DS_ARENA_SNAPSHOT_POOL_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/type_uuid.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+namespace cosm::arena {
+class caching_arena_map;
+} /* namespace cosm::arena */
+
+namespace cosm::arena::repr {
+class base_cache;
+} /* namespace cosm::arena::repr */
+
+namespace cosm::repr {
+class base_block3D;
+} /* namespace cosm::repr */
+
+NS_START(fordyca, ds);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class arena_snapshot_pool
+ * \ingroup ds
+ *
+ * \brief Immutable, versioned snapshots of the blocks and caches in the arena,
+ * owned by the loop functions and shared between the \ref dpo_store of every
+ * robot.
+ *
+ * Instead of each robot cloning every entity in its LOS each timestep, robots
+ * hold handles to the snapshot of the entity as of the current timestep, and a
+ * new snapshot is only made when the arena entity actually changes (i.e. a
+ * block moves, or the set of blocks in a cache changes). Snapshots are shared,
+ * and so must not be modified; see \ref repr::dpo_entity::ent_detach().
+ *
+ * The pool is refreshed once per timestep from a non-concurrent context, and
+ * lookups are read-only, so robot controllers can perform them concurrently.
+ * Refreshes are driven by change notifications from the loop functions (\ref
+ * block_changed(), \ref blocks_changed(), \ref caches_changed()), so that
+ * only the entities which might have changed are examined, rather than the
+ * whole arena.
+ *
+ * Each refresh which changes something advances the pool's epoch, and the
+ * blocks/caches which were added, modified, or removed are recorded in a
+ * bounded change journal, so that consumers which last synchronized at an
+ * earlier epoch can catch up at a cost proportional to the # of changes rather
+ * than the size of the arena.
+ *
+ * The epoch at which the blocks/caches in each tile of \ref kTileDim x \ref
+ * kTileDim cells last changed is also tracked, so that robots can tell if the
+ * part of the arena in their LOS has changed since they last looked at it.
+ */
+class arena_snapshot_pool final : public rer::client<arena_snapshot_pool> {
+ public:
+  template <typename T>
+  struct snapshot {
+    std::shared_ptr<T> ent{ nullptr };
+
+    /**
+     * \brief Incremented each time a new snapshot of an entity is taken; 0 if
+     * the snapshot is not valid.
+     */
+    uint version{ 0 };
+  };
+
+  enum class change_type {
+    ekADDED,
+    /**
+     * \brief A block moved (including being picked up/dropped by a robot), or
+     * the set of blocks in a cache changed.
+     */
+    ekMODIFIED,
+    ekREMOVED
+  };
+
+  struct change {
+    uint              epoch;
+    rtypes::type_uuid id;
+    change_type       type;
+  };
+
+  using journal_type = std::deque<change>;
+
+  /**
+   * \brief How many epochs worth of changes are retained in the journal.
+   * Consumers which fall further behind than this must resynchronize fully.
+   */
+  static constexpr uint kJournalDepth = 16;
+
+  /**
+   * \brief The dimension (in cells) of the square tiles for which change
+   * epochs are tracked.
+   */
+  static constexpr size_t kTileDim = 8;
+
+  arena_snapshot_pool(void) : ER_CLIENT_INIT("fordyca.ds.arena_snapshot_pool") {}
+
+  /* Not copy constructible/assignable by default */
+  arena_snapshot_pool(const arena_snapshot_pool&) = delete;
+  arena_snapshot_pool& operator=(const arena_snapshot_pool&) = delete;
+
+  /**
+   * \brief Synchronize the pool with the current state of the arena, taking
+   * new snapshots of entities which have changed since the last update, and
+   * dropping snapshots of entities which no longer exist. Entities which have
+   * not changed are not copied.
+   *
+   * Only the blocks reported via \ref block_changed() (and the caches they
+   * were/are in) are examined, unless a full rescan has been requested.
+   */
+  void update(const carena::caching_arena_map* map);
+
+  /**
+   * \brief Note that the block with the specified ID may have changed (e.g. it
+   * was picked up/dropped by a robot). Not thread safe.
+   */
+  void block_changed(const rtypes::type_uuid& id);
+
+  /**
+   * \brief Note that any block may have changed (e.g. blocks were moved by the
+   * arena, or absorbed into a newly created cache), so all blocks must be
+   * examined on the next update. Not thread safe.
+   */
+  void blocks_changed(void) { m_blocks_rescan = true; }
+
+  /**
+   * \brief Note that any cache may have changed (e.g. caches were created by
+   * the arena), so all caches must be examined on the next update. Not thread
+   * safe.
+   */
+  void caches_changed(void) { m_caches_rescan = true; }
+
+  /**
+   * \brief Drop all snapshots. Snapshots still held by robots remain valid
+   * until they are released.
+   */
+  void reset(void);
+
+  /**
+   * \brief Get the current snapshot of the specified arena block. If there is
+   * no snapshot for the block, or the snapshot does not match the block's
+   * current state, an invalid snapshot is returned.
+   */
+  snapshot<crepr::base_block3D> block(const crepr::base_block3D* block) const;
+
+  /**
+   * \brief Get the current snapshot of the specified arena cache. If there is
+   * no snapshot for the cache, or the snapshot does not match the cache's
+   * current state, an invalid snapshot is returned.
+   */
+  snapshot<carepr::base_cache> cache(const carepr::base_cache* cache) const;
+
+  /**
+   * \brief Get the current snapshot of the arena block with the specified ID,
+   * or an invalid snapshot if there is no such block.
+   */
+  snapshot<crepr::base_block3D> block(const rtypes::type_uuid& id) const;
+
+  /**
+   * \brief Get the current snapshot of the arena cache with the specified ID,
+   * or an invalid snapshot if there is no such cache.
+   */
+  snapshot<carepr::base_cache> cache(const rtypes::type_uuid& id) const;
+
+  /**
+   * \brief Return \c TRUE iff the block with the specified ID is currently a
+   * free block: not carried by a robot and not in a cache.
+   */
+  bool block_is_free(const rtypes::type_uuid& id) const;
+
+  size_t n_blocks(void) const { return m_blocks.size(); }
+  size_t n_caches(void) const { return m_caches.size(); }
+
+  /**
+   * \brief The current epoch, which only advances when an update changes
+   * something, so comparing epochs is a cheap way to tell if the arena changed.
+   */
+  uint epoch(void) const { return m_epoch; }
+
+  /**
+   * \brief Return \c TRUE iff the journal contains all changes made after the
+   * specified epoch.
+   */
+  bool journal_covers(uint epoch) const {
+    return epoch >= m_journal_start;
+  }
+
+  /**
+   * \brief The block/cache changes made after the specified epoch, in the
+   * order they were made. Only meaningful if \ref journal_covers() is \c TRUE
+   * for the epoch.
+   */
+  journal_type::const_iterator block_changes_since(uint epoch) const {
+    return changes_since(m_block_changes, epoch);
+  }
+  journal_type::const_iterator cache_changes_since(uint epoch) const {
+    return changes_since(m_cache_changes, epoch);
+  }
+  const journal_type& block_changes(void) const { return m_block_changes; }
+  const journal_type& cache_changes(void) const { return m_cache_changes; }
+
+  /**
+   * \brief The most recent epoch at which a block or cache in any of the cells
+   * in the rectangle with corners \p ll and \p ur (inclusive) changed. If two
+   * calls for the same rectangle return the same epoch, nothing in it changed
+   * in between.
+   */
+  uint region_epoch(const rmath::vector2z& ll, const rmath::vector2z& ur) const;
+
+ private:
+  struct block_entry {
+    snapshot<crepr::base_block3D> snap{};
+    rmath::vector2z               loc{};
+
+    /**
+     * \brief The arena block the snapshot was taken of. Blocks are never
+     * removed from the arena, so this is valid until the next reset.
+     */
+    const crepr::base_block3D*    arena{ nullptr };
+  };
+
+  struct cache_entry {
+    snapshot<carepr::base_cache>  snap{};
+    std::vector<rtypes::type_uuid> blocks{};
+    bool                           seen{ false };
+  };
+
+  /**
+   * \brief Take a new snapshot of \p block if it has changed since the last
+   * one, marking the caches it was/is now in for examination.
+   *
+   * \return \c TRUE iff a new snapshot was taken.
+   */
+  bool block_refresh(const crepr::base_block3D* block, uint epoch);
+
+  /**
+   * \brief Take new snapshots of all caches which have changed, and drop the
+   * snapshots of caches which no longer exist.
+   *
+   * \return The # of new snapshots taken, and the # dropped.
+   */
+  std::pair<size_t, size_t> caches_refresh(const carena::caching_arena_map* map,
+                                           uint epoch);
+
+  /**
+   * \brief Return \c TRUE iff the IDs of the blocks in \p cache are \p ids,
+   * in the same order.
+   */
+  static bool cache_blocks_equal(const carepr::base_cache* cache,
+                                 const std::vector<rtypes::type_uuid>& ids);
+
+  /**
+   * \brief Record that the blocks in \p ids are/are no longer in the cache
+   * with ID \p cache_id.
+   */
+  void cached_blocks_add(const std::vector<rtypes::type_uuid>& ids,
+                         const rtypes::type_uuid& cache_id);
+  void cached_blocks_remove(const std::vector<rtypes::type_uuid>& ids,
+                            const rtypes::type_uuid& cache_id);
+
+  /**
+   * \brief Journal the blocks in \p ids which were in a cache that was just
+   * modified/removed, and are now free blocks without having moved (e.g. the
+   * block left over when a cache is depleted), so that consumers re-check
+   * them.
+   */
+  void blocks_released(const std::vector<rtypes::type_uuid>& ids, uint epoch);
+
+  static journal_type::const_iterator changes_since(const journal_type& journal,
+                                                    uint epoch);
+
+  /**
+   * \brief Drop journal entries which are older than \ref kJournalDepth
+   * epochs.
+   */
+  void journal_trim(void);
+
+  /**
+   * \brief Mark all tiles overlapped by \p ent as changed at \p epoch.
+   */
+  template <typename TEntity>
+  void tiles_touch(const TEntity* ent, uint epoch);
+
+  static uint64_t tile_key(size_t x, size_t y) {
+    return (static_cast<uint64_t>(x) << 32) | static_cast<uint64_t>(y);
+  }
+
+  /* clang-format off */
+  uint                                 m_version{0};
+  uint                                 m_epoch{0};
+  uint                                 m_journal_start{0};
+  double                               m_resolution{0.0};
+
+  /**
+   * \brief The epoch all tiles are considered to have changed at, regardless
+   * of \ref m_tiles (i.e. the epoch of the last reset).
+   */
+  uint                                 m_tiles_floor{0};
+  std::unordered_map<uint64_t, uint>   m_tiles{};
+  std::unordered_map<int, block_entry> m_blocks{};
+  std::unordered_map<int, cache_entry> m_caches{};
+
+  /**
+   * \brief The ID of the cache each cached block is in.
+   */
+  std::unordered_map<int, int>         m_cached_blocks{};
+
+  /**
+   * \brief The ID of the cache whose center is in each cell (key is \ref
+   * tile_key() of the cell).
+   */
+  std::unordered_map<uint64_t, int>    m_cache_centers{};
+  std::vector<int>                     m_pending_blocks{};
+  std::unordered_set<int>              m_pending_caches{};
+  bool                                 m_blocks_rescan{true};
+  bool                                 m_caches_rescan{true};
+  journal_type                         m_block_changes{};
+  journal_type                         m_cache_changes{};
+  /* clang-format on */
+};
+
+NS_END(ds, fordyca);
+
+#endif /* INCLUDE_FORDYCA_DS_ARENA_SNAPSHOT_POOL_HPP_ */
@@ -0,0 +1,108 @@
+/**
+ * \file block_membership_index.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_DS_BLOCK_MEMBERSHIP_INDEX_HPP_
+#define INCLUDE_FORDYCA_DS_BLOCK_MEMBERSHIP_INDEX_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <vector>
+
+#include "rcppsw/types/type_uuid.hpp"
+
+#include "cosm/arena/ds/cache_vector.hpp"
+#include "cosm/foraging/ds/block_cluster_vector.hpp"
+#include "cosm/repr/base_block3D.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, ds);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class block_membership_index
+ * \ingroup ds
+ *
+ * \brief Mapping of block ID -> (ID of the cache containing the block, ID of
+ * the cluster containing the block), for use in filtering blocks during cache
+ * creation in O(1) per block, rather than searching every cache/cluster for
+ * every block.
+ *
+ * Indexed directly by block ID, as block IDs are assigned sequentially by the
+ * arena.
+ */
+class block_membership_index {
+ public:
+  struct membership {
+    rtypes::type_uuid cache{rtypes::constants::kNoUUID};
+    rtypes::type_uuid cluster{rtypes::constants::kNoUUID};
+  };
+
+  block_membership_index(void) = default;
+
+  /* Not copy constructible/assignable by default */
+  block_membership_index(const block_membership_index&) = delete;
+  block_membership_index& operator=(const block_membership_index&) = delete;
+
+  /**
+   * \brief Rebuild the index from the current caches/clusters in the arena.
+   */
+  void build(const cads::acache_vectorno& caches,
+             const cfds::block3D_cluster_vectorro& clusters);
+
+  bool in_cache(const crepr::base_block3D* block) const {
+    const auto* m = find(block);
+    return nullptr != m && rtypes::constants::kNoUUID != m->cache;
+  }
+
+  bool in_cluster(const crepr::base_block3D* block) const {
+    const auto* m = find(block);
+    return nullptr != m && rtypes::constants::kNoUUID != m->cluster;
+  }
+
+  /**
+   * \brief Get the memberships of the specified block, or NULL if the block is
+   * not a member of any cache/cluster.
+   */
+  const membership* find(const crepr::base_block3D* block) const {
+    auto id = block->id().v();
+    if (id < 0 || static_cast<size_t>(id) >= m_memberships.size()) {
+      return nullptr;
+    }
+    return &m_memberships[id];
+  }
+
+ private:
+  membership& access(const rtypes::type_uuid& id);
+
+  /* clang-format off */
+  std::vector<membership> m_memberships{};
+  /* clang-format on */
+};
+
+NS_END(ds, fordyca);
+
+#endif /* INCLUDE_FORDYCA_DS_BLOCK_MEMBERSHIP_INDEX_HPP_ */
@@ -0,0 +1,122 @@
+/**
+ * \file cache_prox_index.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_DS_CACHE_PROX_INDEX_HPP_
+#define INCLUDE_FORDYCA_DS_CACHE_PROX_INDEX_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/spatial_dist.hpp"
+#include "rcppsw/types/type_uuid.hpp"
+
+#include "cosm/arena/ds/cache_vector.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, ds);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class cache_prox_index
+ * \ingroup ds
+ *
+ * \brief Uniform grid of the centers of the caches in the arena, bucketed by
+ * the cache proximity distance, so that checking if a location is too close to
+ * any cache only requires looking at the 3x3 neighborhood of buckets around
+ * it, rather than at every cache.
+ *
+ * The index is a snapshot: it must be invalidated whenever caches are created,
+ * and is considered stale if the # of caches in the arena no longer matches the
+ * # indexed (i.e. a cache was depleted).
+ */
+class cache_prox_index : public rer::client<cache_prox_index> {
+ public:
+  struct entry {
+    rtypes::type_uuid id{rtypes::constants::kNoUUID};
+    rmath::vector2d   center{};
+  };
+
+  explicit cache_prox_index(const rtypes::spatial_dist& prox_dist);
+
+  /* Not copy constructible/assignable by default */
+  cache_prox_index(const cache_prox_index&) = delete;
+  cache_prox_index& operator=(const cache_prox_index&) = delete;
+
+  const rtypes::spatial_dist& prox_dist(void) const { return mc_prox_dist; }
+
+  /**
+   * \brief Determine if the index reflects the current set of caches in the
+   * arena.
+   *
+   * \param n_caches The current # of caches in the arena.
+   */
+  bool is_current(size_t n_caches) const {
+    return m_valid && n_caches == m_n_entries;
+  }
+
+  void invalidate(void) { m_valid = false; }
+
+  /**
+   * \brief Rebuild the index from the specified caches. Caller must hold the
+   * arena cache mutex.
+   */
+  void rebuild(const cads::acache_vectorno& caches);
+
+  /**
+   * \brief Find the closest cache whose center is within the proximity
+   * distance of the specified location.
+   *
+   * \return The cache entry, or NULL if there is no such cache.
+   */
+  const entry* query(const rmath::vector2d& loc) const;
+
+ private:
+  using key_type = uint64_t;
+
+  key_type key(int i, int j) const {
+    return (static_cast<key_type>(static_cast<uint32_t>(i)) << 32) |
+           static_cast<uint32_t>(j);
+  }
+  int bucket_coord(double v) const;
+
+  /* clang-format off */
+  const rtypes::spatial_dist                      mc_prox_dist;
+
+  bool                                            m_valid{false};
+  size_t                                          m_n_entries{0};
+  std::unordered_map<key_type, std::vector<entry>> m_buckets{};
+  /* clang-format on */
+};
+
+NS_END(ds, fordyca);
+
+#endif /* INCLUDE_FORDYCA_DS_CACHE_PROX_INDEX_HPP_ */
@@ -41,6 +41,16 @@ NS_START(fordyca, ds);
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
+/**
+ * \brief Blocks are indexed by their anchor cell.
+ */
+template <>
+struct dpo_map_traits<crepr::base_block3D> {
+  static rtypes::type_uuid id(const crepr::base_block3D& block);
+  static rmath::vector2z loc(const crepr::base_block3D& block);
+  static rmath::vector2d rloc(const crepr::base_block3D& block);
+};
+
 /**
  * \class dp_block_map
  * \ingroup ds
@@ -43,6 +43,16 @@ NS_START(fordyca, ds);
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
+/**
+ * \brief Caches are indexed by their host cell.
+ */
+template <>
+struct dpo_map_traits<carepr::base_cache> {
+  static rtypes::type_uuid id(const carepr::base_cache& cache);
+  static rmath::vector2z loc(const carepr::base_cache& cache);
+  static rmath::vector2d rloc(const carepr::base_cache& cache);
+};
+
 /**
  * \class dp_cache_map
  * \ingroup ds
@@ -24,10 +24,20 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
-#include <boost/range/adaptor/map.hpp>
-#include <map>
+#include <boost/range/iterator_range.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <set>
 #include <utility>
+#include <vector>
 
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/type_uuid.hpp"
+
+#include "fordyca/ds/flat_index.hpp"
 #include "fordyca/repr/dpo_entity.hpp"
 
 /*******************************************************************************
@@ -35,6 +45,18 @@
  ******************************************************************************/
 NS_START(fordyca, ds);
 
+/**
+ * \struct dpo_map_traits
+ * \ingroup ds
+ *
+ * \brief How to extract the ID and discrete location of the objects stored in
+ * a \ref dpo_map, so that both indices can be maintained, and the real
+ * location, so that the average location of all objects can be. Must be
+ * specialized for each object type.
+ */
+template <typename obj_type>
+struct dpo_map_traits;
+
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
@@ -46,42 +68,118 @@ NS_START(fordyca, ds);
  * SEPARATELY from the \ref arena_map where they actually live (clone not
  * reference), which decouples/simplifies a lot of the tricky handshaking logic
  * when robots interact with the arena.
+ *
+ * Objects are stored contiguously, and indexed by both ID and discrete location
+ * via open addressed \ref flat_index instances (whichever one is the key type
+ * is the primary index), so lookups by either are O(1). Both keys are unique:
+ * adding an object replaces any object with the same ID or location. Removal
+ * swaps the last object into the removed object's slot, so the objects in the
+ * map must not be removed while iterating over it, and pointers to objects in
+ * the map are invalidated by insertion/removal (pointers to the underlying
+ * entities are not).
+ *
+ * Running aggregates (sum of locations and pheromone densities) over all
+ * objects are maintained on insertion/removal/density update/decay, so that
+ * averages over the map are O(1).
+ *
+ * The map can optionally be bounded (see \ref capacity()), in which case the
+ * object with the lowest pheromone density is evicted to make room for new
+ * ones (an incoming object with a lower density than any in the map is not
+ * added at all). All objects decay at the same rate, so ranking them by
+ * density only needs to be updated when an object is added or its density
+ * updated, and eviction is O(log n).
+ *
+ * Every structural change to the map (add/remove/density refresh/in place
+ * modification, or pending deposits landing) bumps its \ref change_epoch().
+ * Pure decay does not, as it happens every timestep; it only advances \ref
+ * decay_epoch(), so computations over the map which are not invariant under
+ * decay can be cached for as many decay epochs as they remain valid for.
  */
 template <typename key_type, typename obj_type>
 class dpo_map {
  public:
   using value_type = typename repr::dpo_entity<obj_type>;
-  using map_type = std::map<key_type, value_type>;
-
-  template <typename T, typename Adaptor>
-  using iterator_type =
-      decltype(boost::make_iterator_range(std::declval<T>().begin(),
-                                          std::declval<T>().end()) |
-               std::declval<Adaptor>());
+  using container_type = std::vector<value_type>;
+  using traits_type = dpo_map_traits<obj_type>;
 
-  dpo_map(void) : mc_obj_ref(m_obj) {}
+  dpo_map(void) = default;
 
   /**
-   * \brief Update the densities of all objects in the map. Should be called
+   * \brief Decay the densities of all objects in the map. Should be called
    * when one unit of time has passed (e.g. every timestep).
+   *
+   * This just advances the decay epoch; densities are decayed lazily when they
+   * are read, so this is O(1).
+   *
+   * If pheromone has been deposited on any object since the last decay step,
+   * it lands now, and densities do not just decay uniformly, so this is a
+   * structural change.
+   *
+   * If decay has been disabled via \ref decay_enable(), only the decay epoch
+   * advances, and all densities are held as they are.
    */
   void decay_all(void) {
-    for (std::pair<const key_type, value_type>& o : m_obj) {
-      o.second.density().update();
-    } /* for(&o..) */
+    ++m_decay_epoch;
+    if (!m_decay_enabled) {
+      return;
+    }
+    m_agg.density = m_agg.density * (1.0 - m_agg.rho) + m_agg.density_pending;
+    m_agg.density_pending = 0.0;
+    if (m_agg.deposited) {
+      ++m_change_epoch;
+      m_agg.deposited = false;
+    }
+    ++(*m_epoch);
+  }
+
+  /**
+   * \brief The # of times \ref decay_all() has been called.
+   */
+  uint decay_epoch(void) const { return m_decay_epoch; }
+
+  /**
+   * \brief Enable/disable decay of the densities of the objects in the map
+   * (e.g. because they are all known to be current, and densities would
+   * otherwise have to be refreshed every timestep to keep them at the level
+   * they were refreshed to). While disabled, deposits do not land either.
+   */
+  void decay_enable(bool enable) { m_decay_enabled = enable; }
+  bool decay_enabled(void) const { return m_decay_enabled; }
+
+  /**
+   * \brief Monotonically increasing counter which changes whenever an object
+   * is added to/removed from the map, the density of any object in the map is
+   * refreshed, or pheromone deposited on an object lands. Not changed by pure
+   * decay.
+   */
+  size_t change_epoch(void) const { return m_change_epoch; }
+
+  /**
+   * \brief Mark the map as changed after an object in it has been modified in
+   * place (e.g. a block has been removed from a tracked cache).
+   */
+  void obj_modified(void) { ++m_change_epoch; }
+
+  /**
+   * \brief Returns a pointer to the object with the specified ID, or nullptr
+   * if no such object is in the map.
+   */
+  const value_type* find(const rtypes::type_uuid& id) const RCPPSW_PURE {
+    return slot_ptr(m_by_id.find(id.v()));
+  }
+  value_type* find(const rtypes::type_uuid& id) RCPPSW_PURE {
+    return slot_ptr(m_by_id.find(id.v()));
   }
 
   /**
-   * \brief Returns a pointer to the object that matches the specified key, or
-   * nullptr if the key is not found in themap.
+   * \brief Returns a pointer to the object at the specified discrete location,
+   * or nullptr if no such object is in the map.
    */
-  const value_type* find(const key_type& key) const RCPPSW_PURE {
-    auto it = m_obj.find(key);
-    return (it == m_obj.end()) ? nullptr : &(it->second);
+  const value_type* find(const rmath::vector2z& loc) const RCPPSW_PURE {
+    return slot_ptr(m_by_loc.find(loc));
   }
-  value_type* find(const key_type& key) RCPPSW_PURE {
-    auto it = m_obj.find(key);
-    return (it == m_obj.end()) ? nullptr : &(it->second);
+  value_type* find(const rmath::vector2z& loc) RCPPSW_PURE {
+    return slot_ptr(m_by_loc.find(loc));
   }
 
   /**
@@ -92,33 +190,124 @@ class dpo_map {
     return nullptr != find(key);
   }
 
+  /**
+   * \brief Set the max # of objects in the map, or 0 for no limit. If the map
+   * currently contains more objects than that, the ones with the lowest
+   * densities are evicted.
+   */
+  void capacity(size_t capacity) {
+    m_capacity = capacity;
+    m_rank.clear();
+    m_rank_keys.clear();
+    if (0 == m_capacity) {
+      return;
+    }
+    for (auto& obj : m_obj) {
+      m_rank_keys.push_back(rank_key(obj));
+      m_rank.insert({ m_rank_keys.back(), obj.ent() });
+    } /* for(&obj..) */
+    while (m_obj.size() > m_capacity) {
+      evict();
+    } /* while(m_obj.size()..) */
+  }
+  size_t capacity(void) const { return m_capacity; }
+
+  /**
+   * \brief The # of objects which have been evicted since the last call to
+   * \ref evictions_reset().
+   */
+  size_t n_evicted(void) const { return m_n_evicted; }
+  void evictions_reset(void) { m_n_evicted = 0; }
+
   /**
    * \brief Add the specified object from the map of known objects of that
-   * type. If it is already in the map of known objects of that type, the old
-   * version is replaced.
+   * type. If it is already in the map of known objects of that type (as
+   * determined by the key type), the old version is replaced. Any other object
+   * with the same secondary key (i.e. a different object at the same location,
+   * or the same object at a different location) is out of date, and is
+   * removed.
+   *
+   * If the map is full, the object with the lowest density is evicted to make
+   * room for the new one, unless the new one has the lowest density itself, in
+   * which case it is not added, and counts as the evicted object.
+   *
+   * \return \c TRUE if the object was added, and \c FALSE otherwise.
+   */
+  bool obj_add(value_type&& obj) {
+    slot_remove(m_by_id.find(traits_type::id(*obj.ent()).v()));
+    slot_remove(m_by_loc.find(traits_type::loc(*obj.ent())));
+    if (0 != m_capacity && m_obj.size() >= m_capacity) {
+      if (rank_key(obj) < m_rank.begin()->first) {
+        ++m_n_evicted;
+        return false;
+      }
+      evict();
+    }
+
+    size_t slot = m_obj.size();
+    ++m_change_epoch;
+    m_by_id.insert(traits_type::id(*obj.ent()).v(), slot);
+    m_by_loc.insert(traits_type::loc(*obj.ent()), slot);
+    obj.epoch_bind(m_epoch);
+    agg_accum(obj, 1.0);
+    m_obj.push_back(std::move(obj));
+    if (0 != m_capacity) {
+      m_rank_keys.push_back(rank_key(m_obj.back()));
+      m_rank.insert({ m_rank_keys.back(), m_obj.back().ent() });
+    }
+    return true;
+  }
+
+  /**
+   * \brief Update the pheromone density of an object in the map. Densities of
+   * objects in the map must only be modified via this function, so that the
+   * running aggregates stay up to date.
+   */
+  void density_update(value_type& obj,
+                      const crepr::pheromone_density& density) {
+    agg_accum(obj, -1.0);
+    obj.density(density);
+    agg_accum(obj, 1.0);
+    ++m_change_epoch;
+
+    if (0 != m_capacity) {
+      size_t slot = static_cast<size_t>(&obj - m_obj.data());
+      m_rank.erase({ m_rank_keys[slot], obj.ent() });
+      m_rank_keys[slot] = rank_key(obj);
+      m_rank.insert({ m_rank_keys[slot], obj.ent() });
+    }
+  }
+
+  /**
+   * \brief Get the average real location of all objects in the map, or (0,0)
+   * if the map is empty.
+   */
+  rmath::vector2d rloc_avg(void) const {
+    return empty() ? rmath::vector2d() : m_agg.rloc / m_obj.size();
+  }
+
+  /**
+   * \brief Get the average pheromone density of all objects in the map, or 0
+   * if the map is empty.
    */
-  void obj_add(std::pair<key_type, value_type>&& obj) {
-    m_obj.erase(obj.first);
-    m_obj.insert(std::move(obj));
+  double density_avg(void) const {
+    return empty() ? 0.0 : m_agg.density / m_obj.size();
   }
 
   /**
    * \brief Return an iterator for examining, but not modifying the values of
    * the map.
    */
-  auto const_values_range(void) const
-      -> decltype(std::declval<map_type>() | boost::adaptors::map_values) {
-    return m_obj | boost::adaptors::map_values;
+  boost::iterator_range<typename container_type::const_iterator>
+  const_values_range(void) const {
+    return boost::make_iterator_range(m_obj.cbegin(), m_obj.cend());
   }
 
   /**
-   * \brief Return an iterator for examining, but not modifying, the keys of
-   * the map.
+   * \brief Iterate over mutable values of the map.
    */
-  iterator_type<const map_type, decltype(boost::adaptors::map_keys)>
-  keys_range(void) const {
-    return boost::make_iterator_range(m_obj.begin(), m_obj.end()) |
-           boost::adaptors::map_keys;
+  boost::iterator_range<typename container_type::iterator> values_range(void) {
+    return boost::make_iterator_range(m_obj.begin(), m_obj.end());
   }
 
   /**
@@ -126,34 +315,200 @@ class dpo_map {
    * type (if it exists). If the argument is not in the map of known objects of
    * that type, no action is performed.
    */
-  void obj_remove(const key_type& key) { m_obj.erase(key); }
+  void obj_remove(const key_type& key) {
+    const value_type* victim = find(key);
+    if (nullptr != victim) {
+      slot_remove(static_cast<size_t>(victim - m_obj.data()));
+    }
+  }
+
+  size_t size(void) const { return m_obj.size(); }
+  bool empty(void) const { return m_obj.empty(); }
+  void clear(void) {
+    m_obj.clear();
+    m_by_id.clear();
+    m_by_loc.clear();
+    m_agg = {};
+    m_rank.clear();
+    m_rank_keys.clear();
+    ++m_change_epoch;
+  }
 
  private:
-  /* clang-format off */
+  using id_index_type = flat_index<int>;
+
   /**
-   * \brief Needed for compiler to correctly deduce wrapped function return
-   * types for const qualified contexts (must be BEFORE the wrapping macros in
-   * the file).
+   * \brief Remove the object in \p slot, if it is not \ref
+   * id_index_type::kNONE.
    */
-  const map_type& mc_obj_ref;
-  map_type        m_obj{};
-  /* clang-format on */
+  void slot_remove(size_t slot) {
+    if (id_index_type::kNONE == slot) {
+      return;
+    }
+    const value_type* victim = &m_obj[slot];
+    ++m_change_epoch;
+    agg_accum(*victim, -1.0);
+    index_erase(slot);
 
- public:
-  RCPPSW_WRAP_DECLDEF(size, mc_obj_ref, const)
-  RCPPSW_WRAP_DECLDEF(empty, mc_obj_ref, const)
-  RCPPSW_WRAP_DECLDEF(clear, m_obj)
+    /* move the last object into the vacated slot */
+    size_t last = m_obj.size() - 1;
+    if (0 != m_capacity) {
+      m_rank.erase({ m_rank_keys[slot], victim->ent() });
+      m_rank_keys[slot] = m_rank_keys[last];
+      m_rank_keys.pop_back();
+    }
+    if (slot != last) {
+      m_obj[slot] = std::move(m_obj[last]);
+      index_update(slot);
+    }
+    m_obj.pop_back();
+
+    /* don't let floating point error accumulate across refills */
+    if (m_obj.empty()) {
+      m_agg = {};
+    }
+  }
+
+  const value_type* slot_ptr(size_t slot) const {
+    return (id_index_type::kNONE == slot) ? nullptr : &m_obj[slot];
+  }
+  value_type* slot_ptr(size_t slot) {
+    return (id_index_type::kNONE == slot) ? nullptr : &m_obj[slot];
+  }
 
   /**
-   * \brief Iterate over mutable values of the map.
+   * \brief Running sums over all objects in the map.
+   */
+  struct aggregates {
+    rmath::vector2d rloc{};
+
+    /**
+     * \brief Sum of the current densities of all objects.
+     */
+    double density{0.0};
+
+    /**
+     * \brief The amount by which the densities of all objects will exceed
+     * pure exponential decay of \ref density after the next decay step, due
+     * to pheromone deposited since the last one.
+     */
+    double density_pending{0.0};
+
+    /**
+     * \brief Has pheromone been deposited on any object since the last decay
+     * step? Tracked separately from \ref density_pending, which can cancel
+     * out.
+     */
+    bool deposited{false};
+
+    /**
+     * \brief The pheromone decay rate, which is the same for all objects.
+     */
+    double rho{0.0};
+  };
+
+  /**
+   * \brief Add (\p sign = 1) or remove (\p sign = -1) the contribution of \p
+   * obj to the running aggregates.
+   */
+  void agg_accum(const value_type& obj, double sign) {
+    crepr::pheromone_density curr = obj.density();
+    crepr::pheromone_density next = curr;
+    next.update();
+
+    m_agg.rho = curr.rho();
+    m_agg.rloc = m_agg.rloc + traits_type::rloc(*obj.ent()) * sign;
+    m_agg.density += curr.v() * sign;
+    double pending = next.v() - curr.v() * (1.0 - curr.rho());
+    m_agg.density_pending += pending * sign;
+    m_agg.deposited |= (sign > 0.0 && 0.0 != pending);
+  }
+
+  /**
+   * \brief Compute the key by which \p obj is ranked for eviction.
    *
-   * \todo This has to be AFTER the member variable is declared, because I can't
-   * figure out how to get std:declval<map_type>() to be non-const (I think) and
-   * have the non-const map_values iterator as the chosen function overload.
+   * All densities decay by the same factor each timestep, so log(density)
+   * decreases by the same amount for all objects each timestep, and offsetting
+   * it by that amount times the current epoch gives a key which orders objects
+   * by density, and does not change as densities decay. The density after the
+   * next decay step is used so that any pending deposits are included.
    */
-  auto values_range(void) -> decltype(m_obj | boost::adaptors::map_values) {
-    return m_obj | boost::adaptors::map_values;
+  double rank_key(const value_type& obj) const {
+    crepr::pheromone_density next = obj.density();
+    next.update();
+    double decay =
+        std::max(1.0 - next.rho(), std::numeric_limits<double>::min());
+    return std::log(next.v()) - (*m_epoch + 1) * std::log(decay);
   }
+
+  /**
+   * \brief Remove the object with the lowest density from the map.
+   */
+  void evict(void) {
+    obj_remove(key_of(*m_rank.begin()->second));
+    ++m_n_evicted;
+  }
+
+  struct loc_hash {
+    size_t operator()(const rmath::vector2z& loc) const {
+      return std::hash<size_t>()(loc.x()) ^ (std::hash<size_t>()(loc.y()) << 1);
+    }
+  };
+
+  static key_type key_of(const obj_type& obj) {
+    return key_of(obj, static_cast<const key_type*>(nullptr));
+  }
+  static rtypes::type_uuid key_of(const obj_type& obj,
+                                  const rtypes::type_uuid*) {
+    return traits_type::id(obj);
+  }
+  static rmath::vector2z key_of(const obj_type& obj, const rmath::vector2z*) {
+    return traits_type::loc(obj);
+  }
+
+  /**
+   * \brief Remove the index entries for the object in \p slot.
+   */
+  void index_erase(size_t slot) {
+    const obj_type& obj = *m_obj[slot].ent();
+    m_by_id.erase(traits_type::id(obj).v());
+    m_by_loc.erase(traits_type::loc(obj));
+  }
+
+  /**
+   * \brief Point the index entries for the object which was just moved into \p
+   * slot at its new position.
+   */
+  void index_update(size_t slot) {
+    const obj_type& obj = *m_obj[slot].ent();
+    m_by_id.insert(traits_type::id(obj).v(), slot);
+    m_by_loc.insert(traits_type::loc(obj), slot);
+  }
+
+  /* clang-format off */
+  container_type                                        m_obj{};
+  uint                                                  m_decay_epoch{0};
+  bool                                                  m_decay_enabled{true};
+
+  /**
+   * \brief The epoch the densities of the objects in the map are relative to,
+   * which only advances while decay is enabled.
+   */
+  std::shared_ptr<uint>                                 m_epoch{std::make_shared<uint>(0)};
+  aggregates                                            m_agg{};
+  id_index_type                                         m_by_id{};
+  flat_index<rmath::vector2z, loc_hash>                 m_by_loc{};
+  size_t                                                m_capacity{0};
+  size_t                                                m_n_evicted{0};
+  size_t                                                m_change_epoch{0};
+
+  /**
+   * \brief Objects ordered by \ref rank_key(), and the key of the object in
+   * each slot. Only maintained if the map is bounded.
+   */
+  std::set<std::pair<double, const obj_type*>>         m_rank{};
+  std::vector<double>                                   m_rank_keys{};
+  /* clang-format on */
 };
 
 NS_END(ds, fordyca);
@@ -70,35 +70,32 @@ class dpo_semantic_map final : public rer::client<dpo_semantic_map>,
   RCPPSW_DECORATE_DECLDEF(pheromone_repeat_deposit, const);
 
   /**
-   * \brief Access a particular element in the discretized grid representing the
-   * robot's view of the arena. No bounds checking is performed, so if something
-   * is out of bounds, boost will fail with a bounds checking assertion.
-   *
-   * \param i X coord.
-   * \param j Y coord
-   *
-   * \return The cell.
+   * \brief Get the state of a cell/the ID of the block/cache in it (see \ref
+   * occupancy_grid::cell_state()).
+   */
+  RCPPSW_DECORATE_DECLDEF(cell_state, const)
+  RCPPSW_DECORATE_DECLDEF(cell_entity, const)
+  RCPPSW_DECORATE_DECLDEF(cell_update)
+
+  /**
+   * \brief Get the tracked block/cache in a cell, or NULL if the cell does not
+   * contain one, or if the one it contains is no longer tracked (e.g. it was
+   * removed from the store by an oracle update, which does not touch the
+   * map).
+   */
+  const dp_block_map::value_type* cell_block(const rmath::vector2z& d) const;
+  dp_block_map::value_type* cell_block(const rmath::vector2z& d);
+  const dp_cache_map::value_type* cell_cache(const rmath::vector2z& d) const;
+  dp_cache_map::value_type* cell_cache(const rmath::vector2z& d);
+
+  /**
+   * \brief Get/modify the pheromone density of a cell (see \ref
+   * occupancy_grid::density()).
    */
-  template <size_t Index>
-  typename occupancy_grid::layer_value_type<Index>::value_type& access(size_t i,
-                                                                       size_t j) {
-    return decoratee().access<Index>(i, j);
-  }
-  template <size_t Index>
-  const typename occupancy_grid::layer_value_type<Index>::value_type&
-  access(size_t i, size_t j) const {
-    return decoratee().access<Index>(i, j);
-  }
-  template <size_t Index>
-  typename occupancy_grid::layer_value_type<Index>::value_type&
-  access(const rmath::vector2z& d) {
-    return decoratee().access<Index>(d);
-  }
-  template <size_t Index>
-  const typename occupancy_grid::layer_value_type<Index>::value_type&
-  access(const rmath::vector2z& d) const {
-    return decoratee().access<Index>(d);
-  }
+  RCPPSW_DECORATE_DECLDEF(density, const)
+  RCPPSW_DECORATE_DECLDEF(pheromone_reset)
+  RCPPSW_DECORATE_DECLDEF(pheromone_add)
+  RCPPSW_DECORATE_DECLDEF(pheromone_set)
 
   /**
    * \brief Update the density of:
@@ -116,13 +113,11 @@ class dpo_semantic_map final : public rer::client<dpo_semantic_map>,
   RCPPSW_DECORATE_DECLDEF(ydsize, const)
   RCPPSW_DECORATE_DECLDEF(xrsize, const)
   RCPPSW_DECORATE_DECLDEF(yrsize, const)
-  RCPPSW_DECORATE_DECLDEF(known_cells_inc)
-  RCPPSW_DECORATE_DECLDEF(known_cells_dec)
   RCPPSW_DECORATE_DECLDEF(known_cell_count, const)
   RCPPSW_DECORATE_DECLDEF(resolution, const)
 
-  bool cache_remove(carepr::base_cache* victim);
-  bool block_remove(crepr::base_block3D* victim);
+  bool cache_remove(const carepr::base_cache* victim);
+  bool block_remove(const crepr::base_block3D* victim);
 
   const dpo_store* store(void) const { return &m_store; }
   dpo_store* store(void) { return &m_store; }
@@ -41,6 +41,7 @@
  * Namespaces/Decls
  ******************************************************************************/
 NS_START(fordyca, ds);
+class arena_snapshot_pool;
 
 /*******************************************************************************
  * Class Definitions
@@ -107,13 +108,86 @@ class dpo_store final : public rer::client<dpo_store> {
 
   bool repeat_deposit(void) const { return mc_repeat_deposit; }
 
+  /**
+   * \brief Set the max # of blocks/caches the store will track at once (0 =
+   * unlimited). When a new block/cache is added to a full store, the
+   * block/cache with the lowest density is evicted to make room for it; if
+   * that is the new one, it is not added, and the update is reported as not
+   * having changed the store.
+   */
+  void capacity(size_t max_blocks, size_t max_caches) {
+    m_blocks.capacity(max_blocks);
+    m_caches.capacity(max_caches);
+  }
+
+  /**
+   * \brief The # of blocks/caches evicted from the store since the last call
+   * to \ref evictions_reset().
+   */
+  size_t n_evicted_blocks(void) const { return m_blocks.n_evicted(); }
+  size_t n_evicted_caches(void) const { return m_caches.n_evicted(); }
+  void evictions_reset(void) {
+    m_blocks.evictions_reset();
+    m_caches.evictions_reset();
+  }
+
+  /**
+   * \brief Monotonically increasing counter which changes whenever the set of
+   * known blocks/caches, or their contents, change, or their densities are
+   * refreshed. Decay does not change it (see \ref decay_epoch()).
+   */
+  size_t change_epoch(void) const {
+    return m_blocks.change_epoch() + m_caches.change_epoch();
+  }
+
+  /**
+   * \brief The # of times the store has been decayed via \ref decay_all().
+   * Things computed from the store which depend on densities but are memoized
+   * against \ref change_epoch() need to check this too.
+   */
+  uint decay_epoch(void) const { return m_blocks.decay_epoch(); }
+
+  /**
+   * \brief Set the pool of shared arena snapshots to use when tracking blocks
+   * and caches, instead of cloning them. May be \c nullptr.
+   */
+  void snapshot_pool(const arena_snapshot_pool* pool) { mc_snapshots = pool; }
+  const arena_snapshot_pool* snapshot_pool(void) const { return mc_snapshots; }
+
+  /**
+   * \brief Create a DPO entity for tracking the specified arena block with the
+   * specified density. The entity shares the current arena snapshot of the
+   * block if one is available, and is a clone of the block otherwise.
+   */
+  dpo_entity<crepr::base_block3D>
+  block_snapshot(const crepr::base_block3D* block,
+                 const crepr::pheromone_density& density) const;
+
+  /**
+   * \brief Create a DPO entity for tracking the specified arena cache with the
+   * specified density. The entity shares the current arena snapshot of the
+   * cache if one is available, and is a clone of the cache otherwise.
+   */
+  dpo_entity<carepr::base_cache>
+  cache_snapshot(const carepr::base_cache* cache,
+                 const crepr::pheromone_density& density) const;
+
   /**
    * \brief Update the densities of all objects in the store (i.e. decay
    * them). Should be called when one unit of time has passed (e.g. every
-   * timestep).
+   * timestep). Densities are decayed lazily when read, so this is O(1).
    */
   void decay_all(void);
 
+  /**
+   * \brief Enable/disable decay of the densities of all blocks/caches in the
+   * store (e.g. because an oracle keeps all of them current).
+   */
+  void decay_enable(bool blocks, bool caches) {
+    m_blocks.decay_enable(blocks);
+    m_caches.decay_enable(caches);
+  }
+
   void clear_all(void);
 
   bool contains(const crepr::base_block3D* block) const RCPPSW_PURE;
@@ -130,7 +204,8 @@ class dpo_store final : public rer::client<dpo_store> {
    * \brief Update the known caches set with the new cache.
    *
    * If there is already a known cache at the location of the incoming cache, it
-   * is removed and replaced with a new one.
+   * is removed and replaced with a new one, unless both refer to the same arena
+   * snapshot, in which case only the density is updated.
    *
    * \param cache Cache to update.
    */
@@ -148,10 +223,35 @@ class dpo_store final : public rer::client<dpo_store> {
    */
   update_res_t block_update(dpo_entity<crepr::base_block3D> block_in);
 
+  /**
+   * \brief Update the density of a tracked block which has been seen again and
+   * has not changed, in the same way as if it had been re-found.
+   *
+   * \return \c TRUE if the block was refreshed, \c FALSE if it is not tracked
+   * at its current location.
+   */
+  bool block_density_refresh(const crepr::base_block3D* block);
+
+  /**
+   * \brief Update the density of a tracked cache which has been seen again and
+   * has not changed, in the same way as if it had been re-found.
+   *
+   * \return \c TRUE if the cache was refreshed, \c FALSE if it is not
+   * tracked.
+   */
+  bool cache_density_refresh(const carepr::base_cache* cache);
+
+  /**
+   * \brief Get the density of an entity which has been seen again, given its
+   * current density.
+   */
+  crepr::pheromone_density density_refreshed(
+      crepr::pheromone_density density) const;
+
   /**
    * \brief Remove a cache from the set of of known caches.
    */
-  bool cache_remove(carepr::base_cache* victim);
+  bool cache_remove(const carepr::base_cache* victim);
 
   /*
    * \brief Remove a block from the set of known blocks. If the victim is not
@@ -159,7 +259,7 @@ class dpo_store final : public rer::client<dpo_store> {
    *
    * \return \c TRUE if a block was removed, \c FALSE otherwise.
    */
-  bool block_remove(crepr::base_block3D* victim);
+  bool block_remove(const crepr::base_block3D* victim);
 
   double pheromone_rho(void) const { return mc_pheromone_rho; }
 
@@ -174,6 +274,7 @@ class dpo_store final : public rer::client<dpo_store> {
   /* clang-format off */
   const bool                       mc_repeat_deposit;
   const double                     mc_pheromone_rho;
+  const arena_snapshot_pool*       mc_snapshots{nullptr};
 
   ds::dp_block_map                 m_blocks{};
   ds::dp_cache_map                 m_caches{};
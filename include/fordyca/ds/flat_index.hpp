@@ -0,0 +1,192 @@
+/**
+ * \file flat_index.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_DS_FLAT_INDEX_HPP_
+#define INCLUDE_FORDYCA_DS_FLAT_INDEX_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, ds);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class flat_index
+ * \ingroup ds
+ *
+ * \brief An open addressed hash index from keys to positions in some other
+ * container (e.g. the slots of a \ref dpo_map).
+ *
+ * Entries are stored inline in a single power-of-2 sized array and collisions
+ * are resolved by linear probing, so lookups touch a few adjacent entries
+ * rather than chasing per-node pointers as std::unordered_map does. Removal
+ * shifts subsequent entries in the probe sequence back instead of leaving
+ * tombstones, so lookup cost does not degrade with churn. The load factor is
+ * kept at or below 1/2.
+ */
+template <typename TKey, typename THash = std::hash<TKey>>
+class flat_index {
+ public:
+  /**
+   * \brief Returned by \ref find() if the key is not in the index. Cannot be
+   * stored as a value.
+   */
+  static constexpr size_t kNONE = std::numeric_limits<size_t>::max();
+
+  flat_index(void) = default;
+
+  /**
+   * \brief Get the value for \p key, or \ref kNONE if it is not in the index.
+   */
+  size_t find(const TKey& key) const {
+    if (m_buckets.empty()) {
+      return kNONE;
+    }
+    for (size_t i = home(key);; i = next(i)) {
+      const bucket& b = m_buckets[i];
+      if (kNONE == b.value || b.key == key) {
+        return b.value;
+      }
+    } /* for(i..) */
+  }
+
+  /**
+   * \brief Set the value for \p key, adding it to the index if needed.
+   */
+  void insert(const TKey& key, size_t value) {
+    if ((m_size + 1) * 2 > m_buckets.size()) {
+      rehash(std::max(kMIN_BUCKETS, m_buckets.size() * 2));
+    }
+    size_t i = home(key);
+    while (kNONE != m_buckets[i].value && !(m_buckets[i].key == key)) {
+      i = next(i);
+    } /* while(..) */
+    if (kNONE == m_buckets[i].value) {
+      ++m_size;
+    }
+    m_buckets[i].key = key;
+    m_buckets[i].value = value;
+  }
+
+  /**
+   * \brief Remove \p key from the index.
+   *
+   * \return \c TRUE iff the key was in the index.
+   */
+  bool erase(const TKey& key) {
+    if (m_buckets.empty()) {
+      return false;
+    }
+    size_t i = home(key);
+    while (kNONE != m_buckets[i].value && !(m_buckets[i].key == key)) {
+      i = next(i);
+    } /* while(..) */
+    if (kNONE == m_buckets[i].value) {
+      return false;
+    }
+
+    /*
+     * Move back each subsequent entry in the probe run which would still be
+     * reachable from its home bucket at the vacated position, so that no
+     * lookup can hit an empty bucket before finding its key.
+     */
+    for (size_t j = next(i); kNONE != m_buckets[j].value; j = next(j)) {
+      size_t k = home(m_buckets[j].key);
+      bool in_place = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+      if (!in_place) {
+        m_buckets[i] = std::move(m_buckets[j]);
+        i = j;
+      }
+    } /* for(j..) */
+    m_buckets[i].value = kNONE;
+    --m_size;
+    return true;
+  }
+
+  /**
+   * \brief Remove all keys, keeping the allocated storage.
+   */
+  void clear(void) {
+    for (auto& b : m_buckets) {
+      b.value = kNONE;
+    } /* for(&b..) */
+    m_size = 0;
+  }
+
+  size_t size(void) const { return m_size; }
+  bool empty(void) const { return 0 == m_size; }
+
+ private:
+  struct bucket {
+    TKey   key{};
+    size_t value{kNONE};
+  };
+
+  static constexpr size_t kMIN_BUCKETS = 16;
+
+  /**
+   * \brief Fibonacci hashing, so that keys whose hashes differ only in their
+   * low bits (e.g. consecutive IDs) are spread over the whole table.
+   */
+  size_t home(const TKey& key) const {
+    constexpr uint64_t kMULT = UINT64_C(11400714819323198485);
+    return static_cast<size_t>((static_cast<uint64_t>(THash()(key)) * kMULT) >>
+                               m_shift);
+  }
+  size_t next(size_t i) const { return (i + 1) & (m_buckets.size() - 1); }
+
+  void rehash(size_t n_buckets) {
+    std::vector<bucket> old(n_buckets);
+    old.swap(m_buckets);
+    m_shift = 64;
+    for (size_t n = n_buckets; n > 1; n >>= 1) {
+      --m_shift;
+    } /* for(n..) */
+    m_size = 0;
+    for (auto& b : old) {
+      if (kNONE != b.value) {
+        insert(b.key, b.value);
+      }
+    } /* for(&b..) */
+  }
+
+  /* clang-format off */
+  std::vector<bucket> m_buckets{};
+  size_t              m_size{0};
+  uint                m_shift{64};
+  /* clang-format on */
+};
+
+NS_END(ds, fordyca);
+
+#endif /* INCLUDE_FORDYCA_DS_FLAT_INDEX_HPP_ */
@@ -24,27 +24,29 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <array>
+#include <bitset>
+#include <deque>
+#include <set>
 #include <string>
-#include <tuple>
+#include <utility>
+#include <vector>
 
-#include "rcppsw/ds/stacked_grid2D.hpp"
+#include "rcppsw/er/client.hpp"
 #include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/discretize_ratio.hpp"
+#include "rcppsw/types/type_uuid.hpp"
 
-#include "cosm/ds/cell2D.hpp"
 #include "cosm/repr/pheromone_density.hpp"
 #include "cosm/subsystem/perception/config/perception_config.hpp"
 
+#include "fordyca/ds/packed_cell_grid.hpp"
+
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca, ds);
 
-/**
- * \brief The types of layers used by \ref occupancy_grid (i.e. a heterogeneous
- * 3D grid).
- */
-using robot_layer_stack = std::tuple<crepr::pheromone_density, cds::cell2D>;
-
 /*******************************************************************************
  * Class Definitions
  ******************************************************************************/
@@ -55,55 +57,208 @@ using robot_layer_stack = std::tuple<crepr::pheromone_density, cds::cell2D>;
  * \brief Multilayered grid of cells and associated information
  * density/relevance on the state of those cells. Used by robots in making
  * decisions in how they execute their tasks.
+ *
+ * Robots typically only ever explore a small fraction of large arenas, so
+ * pheromone densities are stored in square tiles of \ref kTileDim cells per
+ * side, which are allocated from a per-grid pool the first time a cell in them
+ * is written to. Within a tile, densities and the bookkeeping for decaying them
+ * are stored as separate planes of scalars, rather than as a \ref
+ * crepr::pheromone_density per cell (all cells share the same decay rate).
+ * Reads from cells in unallocated tiles return an UNKNOWN cell with zero
+ * density. Cells are stored in a \ref packed_cell_grid, which is tiled the same
+ * way.
  */
-class occupancy_grid : public rer::client<occupancy_grid>,
-                       public rds::stacked_grid2D<robot_layer_stack> {
+class occupancy_grid : public rer::client<occupancy_grid> {
  public:
-  /**
-   * \brief The index of the \ref crepr::pheromone_density layer.
-   */
-  static constexpr uint kPheromone = 0;
+  using cell_state_type = packed_cell_grid::state;
 
   /**
-   * \brief The index of the \ref cell2D layer.
+   * \brief The # of cells per side of a tile.
    */
-  static constexpr uint kCell = 1;
+  static constexpr size_t kTileDim = packed_cell_grid::kTileDim;
 
   occupancy_grid(const cspconfig::perception_config* c_config,
                  const std::string& robot_id);
 
+  /* Not copy constructible/assignable by default */
+  occupancy_grid(const occupancy_grid&) = delete;
+  occupancy_grid& operator=(const occupancy_grid&) = delete;
+
   /**
-   * \brief Update the density of all cells in the grid.
+   * \brief Get the state of a cell.
+   */
+  cell_state_type cell_state(const rmath::vector2z& d) const {
+    return m_cells.cell_state(d.x(), d.y());
+  }
+
+  /**
+   * \brief Get the ID of the block/cache in a cell, or \ref
+   * rtypes::constants::kNoUUID if it does not contain one.
+   */
+  rtypes::type_uuid cell_entity(const rmath::vector2z& d) const {
+    return m_cells.cell_entity(d.x(), d.y());
+  }
+
+  /**
+   * \brief Set the state of a cell (and the ID of the block/cache in it, if
+   * any), updating the known cell count if the cell transitions to/from the
+   * UNKNOWN state.
+   */
+  void cell_update(const rmath::vector2z& d,
+                   cell_state_type state,
+                   const rtypes::type_uuid& id = rtypes::constants::kNoUUID);
+
+  /**
+   * \brief Advance the grid by one timestep.
+   *
+   * Pheromone densities are decayed lazily when they are read, so this only
+   * processes the cells which were modified during the last timestep and the
+   * live cells whose density is predicted to have fallen below \ref
+   * kEPSILON. Cost scales with the number of known cells with non-zero density,
+   * rather than with the size of the arena.
    */
   void update(void);
 
   /**
-   * \brief Reset all the cells in the grid
+   * \brief Get the current pheromone density of a cell, including any
+   * pheromone deposited this timestep which has not taken effect yet.
+   */
+  crepr::pheromone_density density(const rmath::vector2z& d) const;
+
+  /**
+   * \brief Reset the pheromone density of a cell to 0.
+   */
+  void pheromone_reset(const rmath::vector2z& d);
+
+  /**
+   * \brief Deposit pheromone in a cell, which takes effect on the next \ref
+   * update() (same as \ref crepr::pheromone_density::pheromone_add()).
+   */
+  void pheromone_add(const rmath::vector2z& d, double quantity);
+
+  /**
+   * \brief Set the pheromone density of a cell, effective immediately.
+   */
+  void pheromone_set(const rmath::vector2z& d, double value);
+
+  /**
+   * \brief Reset all the cells in the grid to UNKNOWN with zero density, and
+   * release all allocated tiles.
    */
   void reset(void);
 
+  size_t xdsize(void) const { return m_ddims.x(); }
+  size_t ydsize(void) const { return m_ddims.y(); }
+  double xrsize(void) const { return m_rdims.x(); }
+  double yrsize(void) const { return m_rdims.y(); }
+  const rtypes::discretize_ratio& resolution(void) const {
+    return m_resolution;
+  }
+
   bool pheromone_repeat_deposit(void) const { return m_pheromone_repeat_deposit; }
 
   uint known_cell_count(void) const { return m_known_cell_count; }
-  void known_cells_inc(void) { ++m_known_cell_count; }
-  void known_cells_dec(void) { --m_known_cell_count; }
+
+  /**
+   * \brief The number of cells whose density is currently being tracked for
+   * decay into the UNKNOWN state.
+   */
+  size_t live_cell_count(void) const { return m_live.size(); }
+
+  /**
+   * \brief The number of tiles of pheromone densities which have been
+   * allocated.
+   */
+  size_t tile_count(void) const { return m_tile_pool.size(); }
 
  private:
+  static constexpr size_t kTileCells = kTileDim * kTileDim;
+
+  struct tile {
+    /**
+     * \brief The density of each cell as of the timestep it was last synced,
+     * not including \ref deposits.
+     */
+    std::array<float, kTileCells> densities{};
+
+    /**
+     * \brief Pheromone deposited in each cell since it was last synced, which
+     * is applied along with the first decay step after that.
+     */
+    std::array<float, kTileCells> deposits{};
+
+    /**
+     * \brief The timestep each cell was last synced.
+     */
+    std::array<uint, kTileCells>  synced{};
+
+    /**
+     * \brief The timestep at which each cell's density is predicted to fall
+     * below \ref kEPSILON, or 0 if the cell is not live.
+     */
+    std::array<uint, kTileCells>  expires{};
+
+    /**
+     * \brief Has each cell been modified since the last \ref update()?
+     */
+    std::bitset<kTileCells>       touched{};
+  };
+
+  size_t flat_index(size_t i, size_t j) const { return i * ydsize() + j; }
+  size_t tile_index(size_t i, size_t j) const {
+    return (i / kTileDim) * m_ytiles + j / kTileDim;
+  }
+  static size_t tile_offset(size_t i, size_t j) {
+    return (i % kTileDim) * kTileDim + j % kTileDim;
+  }
+
+  const tile* tile_find(size_t i, size_t j) const {
+    return m_tiles[tile_index(i, j)];
+  }
+
+  /**
+   * \brief Get the tile containing cell (i,j), allocating it if it does not
+   * exist yet.
+   */
+  tile& tile_alloc(size_t i, size_t j);
+
+  /**
+   * \brief Get the pheromone density of cell \p offset in \p t as of the
+   * timestep it was last synced.
+   */
+  crepr::pheromone_density pheromone_load(const tile& t, size_t offset) const;
+
+  /**
+   * \brief Bring the density of cell (i,j) up to date with the current
+   * timestep by applying all decay steps that have elapsed since it was last
+   * synced in one go.
+   */
+  void pheromone_sync(size_t i, size_t j);
+
+  /**
+   * \brief Sync cell (i,j) prior to modifying its density, and schedule it to
+   * be re-evaluated on the next \ref update().
+   */
+  tile& pheromone_touch(size_t i, size_t j);
+
   /**
-   * \brief Update the state of cell (i,j), which involves decreasing its
-   * pheromone density, and possibly reseting the cell to be empty if its
-   * density gets very close to 0.
+   * \brief Apply \p elapsed timesteps worth of decay to \p density.
    */
-  void cell_state_update(uint i, uint j);
+  void pheromone_decay(crepr::pheromone_density& density, uint elapsed) const;
 
   /**
-   * \brief Initialize a cell in the occupancy grid, which sets the rate of
-   * pheromone decay for the cell, the cell's own reference to its
-   * location. Needed because the underlying boost data structure does not
-   * support non zero parameter constructors, and we do *NOT* want to use
-   * pointers to cells, because that kills our memory performance.
+   * \brief Compute the number of timesteps from now after which a density of
+   * \p v will have decayed below \ref kEPSILON, or 0 if it never will.
    */
-  void cell_init(uint i, uint j, double pheromone_rho);
+  uint pheromone_ttl(double v) const;
+
+  /**
+   * \brief Update the state of cell (i,j), which involves bringing its
+   * pheromone density up to date, and possibly reseting the cell to be unknown
+   * if its density gets very close to 0. If it does not, the cell is
+   * (re)scheduled in the live set.
+   */
+  void cell_state_update(size_t i, size_t j);
 
   /* clang-format off */
   /**
@@ -112,11 +267,45 @@ class occupancy_grid : public rer::client<occupancy_grid>,
    * in.
    */
 
-  static constexpr double             kEPSILON{0.0001};
+  static constexpr double                 kEPSILON{0.0001};
+
+  uint                                    m_known_cell_count{0};
+  uint                                    m_timestep{0};
+  bool                                    m_pheromone_repeat_deposit;
+  double                                  m_pheromone_rho;
+  std::string                             m_robot_id;
+  rtypes::discretize_ratio                m_resolution;
+  rmath::vector2d                         m_rdims;
+  rmath::vector2z                         m_ddims;
+  size_t                                  m_ytiles;
+
+  /**
+   * \brief The density of cells in unallocated tiles.
+   */
+  crepr::pheromone_density                m_unknown_density{};
+
+  /**
+   * \brief Storage for allocated tiles, which does not move tiles when it
+   * grows.
+   */
+  std::deque<tile>                        m_tile_pool{};
+
+  /**
+   * \brief The allocated tile for each tile index, or NULL.
+   */
+  std::vector<tile*>                      m_tiles;
+  packed_cell_grid                        m_cells;
 
-  uint                                m_known_cell_count{0};
-  bool                                m_pheromone_repeat_deposit;
-  std::string                         m_robot_id;
+  /**
+   * \brief Cells modified since the last \ref update().
+   */
+  std::vector<size_t>                     m_touched{};
+
+  /**
+   * \brief Cells with a non-zero density, ordered by the timestep at which
+   * they are predicted to transition to the UNKNOWN state.
+   */
+  std::set<std::pair<uint, size_t>>       m_live{};
   /* clang-format on */
 };
 
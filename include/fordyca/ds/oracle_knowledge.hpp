@@ -0,0 +1,177 @@
+/**
+ * \file oracle_knowledge.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_DS_ORACLE_KNOWLEDGE_HPP_
+#define INCLUDE_FORDYCA_DS_ORACLE_KNOWLEDGE_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/type_uuid.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+namespace cosm::arena {
+class caching_arena_map;
+} /* namespace cosm::arena */
+
+namespace cosm::arena::repr {
+class base_cache;
+} /* namespace cosm::arena::repr */
+
+namespace cosm::repr {
+class base_block3D;
+} /* namespace cosm::repr */
+
+NS_START(fordyca, ds);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class oracle_knowledge
+ * \ingroup ds
+ *
+ * \brief The free blocks and caches in the arena, as made available to
+ * oracular controllers by the loop functions.
+ *
+ * Rebuilding the sets from the arena is O(# blocks + # caches), so instead of
+ * doing that after every robot interaction, the loop functions apply the
+ * deltas the interaction caused (block picked up/dropped, cache depleted),
+ * which are O(1) each. Changes made outside of robot interactions (block
+ * motion, cache creation, resets) cannot be expressed that way, and just mark
+ * the sets as stale, so that they are rebuilt once before they are next
+ * queried.
+ *
+ * Only modified from non-concurrent contexts, and only read during robot
+ * control steps, so lookups are safe to perform concurrently.
+ */
+class oracle_knowledge final : public rer::client<oracle_knowledge> {
+ public:
+  using block_vector = std::vector<crepr::base_block3D*>;
+  using cache_vector = std::vector<carepr::base_cache*>;
+
+  oracle_knowledge(void) : ER_CLIENT_INIT("fordyca.ds.oracle_knowledge") {}
+
+  /* Not copy constructible/assignable by default */
+  oracle_knowledge(const oracle_knowledge&) = delete;
+  oracle_knowledge& operator=(const oracle_knowledge&) = delete;
+
+  /**
+   * \brief Rebuild the sets of free blocks and caches from scratch.
+   */
+  void rebuild(carena::caching_arena_map* map);
+
+  /**
+   * \brief Mark the sets as out of date, because the arena has changed in a
+   * way that could not be applied as a delta.
+   */
+  void invalidate(void) { m_stale = true; }
+  bool stale(void) const { return m_stale; }
+
+  /**
+   * \brief Apply a robot picking up the block with the specified ID, either
+   * from the arena or from a cache.
+   *
+   * \return The ID of the cache the block was picked up from, or \ref
+   * rtypes::constants::kNoUUID if it was a free block.
+   */
+  rtypes::type_uuid block_pickup(const rtypes::type_uuid& id);
+
+  /**
+   * \brief Apply a robot dropping the block with the specified ID, after it
+   * has been placed in the arena (in the nest, where it is redistributed, in
+   * the arena as a free block, or in a cache).
+   */
+  void block_drop(const rtypes::type_uuid& id);
+
+  /**
+   * \brief Apply the cache with the specified ID being depleted. Whatever
+   * blocks were left in it are now free blocks.
+   */
+  void cache_depleted(const rtypes::type_uuid& id);
+
+  const block_vector& blocks(void) const { return m_blocks; }
+  const cache_vector& caches(void) const { return m_caches; }
+
+ private:
+  /**
+   * \brief Add \p entity to \p vec if it is not there, tracking its position
+   * in \p slots, so that it can be removed in O(1).
+   */
+  template <typename TVector>
+  static void slot_add(TVector* vec,
+                       std::unordered_map<int, size_t>* slots,
+                       typename TVector::value_type entity);
+
+  /**
+   * \brief Remove the entity with ID \p id from \p vec (if it is there), by
+   * moving the last entity into its slot.
+   */
+  template <typename TVector>
+  static void slot_remove(TVector* vec,
+                          std::unordered_map<int, size_t>* slots,
+                          const rtypes::type_uuid& id);
+
+  static uint64_t cell_key(const rmath::vector2z& cell) {
+    return (static_cast<uint64_t>(cell.x()) << 32) |
+           static_cast<uint64_t>(cell.y());
+  }
+
+  /* clang-format off */
+  bool                                         m_stale{true};
+  block_vector                                 m_blocks{};
+  cache_vector                                 m_caches{};
+  std::unordered_map<int, size_t>              m_block_slots{};
+  std::unordered_map<int, size_t>              m_cache_slots{};
+
+  /**
+   * \brief All blocks in the arena by ID. Blocks are never removed from the
+   * arena, so this is valid until the next rebuild.
+   */
+  std::unordered_map<int, crepr::base_block3D*> m_arena_blocks{};
+
+  /**
+   * \brief The ID of the cache each cached block is in, and the IDs of the
+   * blocks in each cache.
+   */
+  std::unordered_map<int, int>                 m_cached_blocks{};
+  std::unordered_map<int, std::vector<int>>    m_cache_blocks{};
+
+  /**
+   * \brief The ID of the cache whose center is in each cell (key is \ref
+   * cell_key()). Blocks dropped into a cache are always at its center.
+   */
+  std::unordered_map<uint64_t, int>            m_cache_centers{};
+  /* clang-format on */
+};
+
+NS_END(ds, fordyca);
+
+#endif /* INCLUDE_FORDYCA_DS_ORACLE_KNOWLEDGE_HPP_ */
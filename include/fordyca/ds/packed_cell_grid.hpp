@@ -0,0 +1,151 @@
+/**
+ * \file packed_cell_grid.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_DS_PACKED_CELL_GRID_HPP_
+#define INCLUDE_FORDYCA_DS_PACKED_CELL_GRID_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+#include "rcppsw/types/type_uuid.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, ds);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class packed_cell_grid
+ * \ingroup ds
+ *
+ * \brief Compact storage for the cells in a robot's \ref occupancy_grid.
+ *
+ * A full \ref cds::cell2D per cell (FSM, entity pointer, color, location) is
+ * far more than a robot needs to remember about a cell it is not currently
+ * looking at, so the state of each cell is stored in two planes instead:
+ *
+ * - A 2-bit state (UNKNOWN, EMPTY, HAS_BLOCK, HAS_CACHE), packed 4 cells/byte.
+ * - The ID of the entity in the cell, if any, which callers resolve against
+ *   the robot's \ref dpo_store when they need the entity itself.
+ *
+ * Robots never track BLOCK_EXTENT/CACHE_EXTENT for cells, or how many blocks
+ * are in a cache (the tracked cache knows that), so 2 bits are enough. Both
+ * planes are stored in square tiles of \ref kTileDim cells per side, which are
+ * only allocated once a cell in them becomes known; cells in unallocated tiles
+ * are UNKNOWN.
+ */
+class packed_cell_grid : public rer::client<packed_cell_grid> {
+ public:
+  enum class state : uint8_t {
+    ekUNKNOWN = 0,
+    ekEMPTY,
+    ekHAS_BLOCK,
+    ekHAS_CACHE
+  };
+
+  /**
+   * \brief The # of cells per side of a tile.
+   */
+  static constexpr size_t kTileDim = 32;
+
+  packed_cell_grid(size_t xdsize, size_t ydsize);
+
+  /* Not copy constructible/assignable by default */
+  packed_cell_grid(const packed_cell_grid&) = delete;
+  packed_cell_grid& operator=(const packed_cell_grid&) = delete;
+
+  /**
+   * \brief Get the state of cell (i,j).
+   */
+  state cell_state(size_t i, size_t j) const {
+    const tile* t = m_tiles[tile_index(i, j)];
+    if (nullptr == t) {
+      return state::ekUNKNOWN;
+    }
+    size_t offset = tile_offset(i, j);
+    size_t shift = (offset & 0x3) << 1;
+    return static_cast<state>((t->states[offset >> 2] >> shift) & 0x3);
+  }
+
+  /**
+   * \brief Get the ID of the entity in cell (i,j), or \ref
+   * rtypes::constants::kNoUUID if the cell does not contain a block/cache.
+   */
+  rtypes::type_uuid cell_entity(size_t i, size_t j) const {
+    const tile* t = m_tiles[tile_index(i, j)];
+    return (nullptr == t) ? rtypes::constants::kNoUUID
+                          : rtypes::type_uuid(t->ids[tile_offset(i, j)]);
+  }
+
+  /**
+   * \brief Set the state of cell (i,j), and the ID of the entity in it.
+   *
+   * \param i X coord.
+   * \param j Y coord.
+   * \param s The new state.
+   * \param id The ID of the block/cache in the cell. Must be \ref
+   *           rtypes::constants::kNoUUID if and only if \p s is not
+   *           HAS_BLOCK or HAS_CACHE.
+   */
+  void cell_update(size_t i, size_t j, state s, const rtypes::type_uuid& id);
+
+  /**
+   * \brief Reset all cells in the grid to UNKNOWN.
+   */
+  void reset(void);
+
+  size_t tile_count(void) const { return m_tile_pool.size(); }
+
+ private:
+  struct tile {
+    tile(void) { ids.fill(rtypes::constants::kNoUUID.v()); }
+
+    std::array<uint8_t, kTileDim * kTileDim / 4> states{};
+    std::array<int32_t, kTileDim * kTileDim>     ids{};
+  };
+
+  size_t tile_index(size_t i, size_t j) const {
+    return (i / kTileDim) * m_ytiles + j / kTileDim;
+  }
+  static size_t tile_offset(size_t i, size_t j) {
+    return (i % kTileDim) * kTileDim + j % kTileDim;
+  }
+
+  /* clang-format off */
+  size_t             m_ytiles;
+  std::deque<tile>   m_tile_pool{};
+  std::vector<tile*> m_tiles;
+  /* clang-format on */
+};
+
+NS_END(ds, fordyca);
+
+#endif /* INCLUDE_FORDYCA_DS_PACKED_CELL_GRID_HPP_ */
@@ -170,6 +170,7 @@
 namespace fordyca {
 namespace config {
 namespace strategy {}
+namespace perception {}
 } /* namespace config */
 
 namespace strategy {
@@ -185,6 +186,7 @@ namespace reactive {}
 
 namespace fconfig = fordyca::config;
 namespace fcstrategy = fconfig::strategy;
+namespace fcperception = fconfig::perception;
 
 namespace fstrategy = fordyca::strategy;
 namespace fsexplore = fstrategy::explore;
@@ -36,6 +36,7 @@
 
 #include "fordyca/fordyca.hpp"
 #include "fordyca/fsm/fsm_ro_params.hpp"
+#include "fordyca/fsm/selection_memo.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -89,6 +90,7 @@ class acquire_existing_cache_fsm : public rer::client<acquire_existing_cache_fsm
 
  private:
   using acq_loc_type = std::pair<rtypes::type_uuid, rmath::vector2d>;
+  using memo_type = selection_memo<const carepr::base_cache*>;
 
   /*
    * See \ref acquire_goal_fsm for the purpose of these callbacks.
@@ -99,6 +101,19 @@ class acquire_existing_cache_fsm : public rer::client<acquire_existing_cache_fsm
   boost::optional<acquire_goal_fsm::candidate_type> existing_cache_select(void);
   bool candidates_exist(void) const RCPPSW_PURE;
   boost::optional<acq_loc_type> calc_acq_location(void);
+
+  /**
+   * \brief Get the best existing cache to acquire, reusing the last one
+   * selected if possible.
+   */
+  const carepr::base_cache* cache_select(void);
+
+  /**
+   * \brief Determine if the result of existing cache selection can be reused
+   * until the store/robot position/exception list change. Not true if cache
+   * validity also depends on the current time, via the pickup policy.
+   */
+  bool cache_select_memoizable(void) const;
   bool cache_acq_valid(const rmath::vector2d& loc, const rtypes::type_uuid& id);
 
   bool cache_acquired_cb(bool explore_result) const;
@@ -114,6 +129,7 @@ class acquire_existing_cache_fsm : public rer::client<acquire_existing_cache_fsm
   const bool                                           mc_for_pickup;
   const controller::cognitive::cache_sel_matrix* const mc_matrix;
   const ds::dpo_store*                           const mc_store;
+  memo_type                                            m_memo;
   /* clang-format on */
 };
 
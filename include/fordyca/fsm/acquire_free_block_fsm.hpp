@@ -34,6 +34,7 @@
 #include "fordyca/fsm/foraging_acq_goal.hpp"
 #include "fordyca/fsm/foraging_transport_goal.hpp"
 #include "fordyca/fsm/fsm_ro_params.hpp"
+#include "fordyca/fsm/selection_memo.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -74,6 +75,9 @@ class acquire_free_block_fsm : public rer::client<acquire_free_block_fsm>,
   acquire_free_block_fsm& operator=(const acquire_free_block_fsm&) = delete;
 
  private:
+  using memo_type =
+      selection_memo<boost::optional<acquire_goal_fsm::candidate_type>>;
+
   /*
    * See \ref acquire_goal_fsm for the purpose of these callbacks.
    */
@@ -89,6 +93,9 @@ class acquire_free_block_fsm : public rer::client<acquire_free_block_fsm>,
   /* clang-format off */
   const controller::cognitive::block_sel_matrix* const mc_matrix;
   const ds::dpo_store*      const                      mc_store;
+
+  /* Selection is a const operation, but remembering its result is not */
+  mutable memo_type                                    m_memo;
   /* clang-format on */
 };
 
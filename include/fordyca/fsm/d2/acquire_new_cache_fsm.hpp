@@ -30,6 +30,7 @@
 #include "fordyca/fordyca.hpp"
 #include "cosm/subsystem/subsystem_fwd.hpp"
 #include "fordyca/fsm/fsm_ro_params.hpp"
+#include "fordyca/fsm/selection_memo.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -67,6 +68,9 @@ class acquire_new_cache_fsm final : public rer::client<acquire_new_cache_fsm>,
   acquire_new_cache_fsm& operator=(const acquire_new_cache_fsm& fsm) = delete;
 
  private:
+  using memo_type =
+      selection_memo<boost::optional<acquire_goal_fsm::candidate_type>>;
+
   /*
    * See \ref acquire_goal_fsm for the purpose of these callbacks.
    */
@@ -78,6 +82,7 @@ class acquire_new_cache_fsm final : public rer::client<acquire_new_cache_fsm>,
   /* clang-format off */
   const controller::cognitive::cache_sel_matrix* const mc_matrix;
   const ds::dpo_store*      const                      mc_store;
+  memo_type                                            m_memo;
   /* clang-format on */
 };
 
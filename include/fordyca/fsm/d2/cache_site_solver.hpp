@@ -0,0 +1,130 @@
+/**
+ * \file cache_site_solver.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_FSM_D2_CACHE_SITE_SOLVER_HPP_
+#define INCLUDE_FORDYCA_FSM_D2_CACHE_SITE_SOLVER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "rcppsw/math/range.hpp"
+#include "rcppsw/math/rng.hpp"
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/spatial_dist.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, fsm, d2);
+
+/*******************************************************************************
+ * Struct Definitions
+ ******************************************************************************/
+/**
+ * \brief The termination condition of a \ref cache_site_solver, independent
+ * of the backend.
+ */
+enum class cache_site_solver_status {
+  ekFAILURE,
+  /**
+   * The site utility reached the solver's stopping value.
+   */
+  ekSTOPVAL_REACHED,
+  /**
+   * The site utility changed by less than the solver's tolerance.
+   */
+  ekUTILITY_TOL_REACHED,
+  /**
+   * The site changed by less than the solver's tolerance.
+   */
+  ekSITE_TOL_REACHED,
+  /**
+   * The solver ran out of iterations/evaluations.
+   */
+  ekMAX_ITERATIONS_REACHED,
+  /**
+   * The solver succeeded for some other reason.
+   */
+  ekOTHER_SUCCESS
+};
+
+/**
+ * \struct cache_site_problem
+ * \ingroup fsm d2
+ *
+ * \brief Everything a \ref cache_site_solver needs to compute a cache site:
+ * the utility function parameters, the proximity constraints, and the
+ * bounds of the search space.
+ */
+struct cache_site_problem {
+  rmath::vector2d              position{};
+  rmath::vector2d              nest_loc{};
+  std::vector<rmath::vector2d> caches{};
+  rtypes::spatial_dist         cache_prox{0.0};
+  rtypes::spatial_dist         nest_prox{0.0};
+  rmath::rangeu                xrange{};
+  rmath::rangeu                yrange{};
+};
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class cache_site_solver
+ * \ingroup fsm d2
+ *
+ * \brief Interface for the backends used by \ref cache_site_selector to
+ * maximize \ref math::cache_site_utility subject to the cache/nest proximity
+ * constraints.
+ */
+class cache_site_solver {
+ public:
+  cache_site_solver(void) = default;
+  virtual ~cache_site_solver(void) = default;
+
+  /* Not copy constructible/assignable by default */
+  cache_site_solver(const cache_site_solver&) = delete;
+  cache_site_solver& operator=(const cache_site_solver&) = delete;
+
+  /**
+   * \brief Compute a cache site for the specified problem.
+   *
+   * \return The computed site, or an empty optional if the solver failed. The
+   * returned site is not guaranteed to satisfy all constraints (the caller is
+   * responsible for checking).
+   */
+  virtual boost::optional<rmath::vector2d> operator()(
+      const cache_site_problem& problem,
+      rmath::rng* rng) = 0;
+
+  /**
+   * \brief The termination condition of the last solve.
+   */
+  virtual cache_site_solver_status status(void) const = 0;
+};
+
+NS_END(d2, fsm, fordyca);
+
+#endif /* INCLUDE_FORDYCA_FSM_D2_CACHE_SITE_SOLVER_HPP_ */
@@ -0,0 +1,60 @@
+/**
+ * \file cache_site_solver_factory.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_FSM_D2_CACHE_SITE_SOLVER_FACTORY_HPP_
+#define INCLUDE_FORDYCA_FSM_D2_CACHE_SITE_SOLVER_FACTORY_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+
+#include "rcppsw/patterns/factory/factory.hpp"
+
+#include "fordyca/fordyca.hpp"
+#include "fordyca/fsm/d2/cache_site_solver.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, fsm, d2);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class cache_site_solver_factory
+ * \ingroup fsm d2
+ *
+ * \brief Factory for creating cache site solver backends.
+ */
+class cache_site_solver_factory :
+    public rpfactory::releasing_factory<cache_site_solver,
+                                        std::string /* key type */> {
+ public:
+  inline static const std::string kGrid = "grid";
+  inline static const std::string kNLopt = "nlopt";
+
+  cache_site_solver_factory(void);
+};
+
+NS_END(d2, fsm, fordyca);
+
+#endif /* INCLUDE_FORDYCA_FSM_D2_CACHE_SITE_SOLVER_FACTORY_HPP_ */
@@ -0,0 +1,106 @@
+/**
+ * \file grid_cache_site_solver.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_FSM_D2_GRID_CACHE_SITE_SOLVER_HPP_
+#define INCLUDE_FORDYCA_FSM_D2_GRID_CACHE_SITE_SOLVER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "rcppsw/er/client.hpp"
+
+#include "fordyca/fsm/d2/cache_site_solver.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, fsm, d2);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class grid_cache_site_solver
+ * \ingroup fsm d2
+ *
+ * \brief Computes a cache site deterministically in two phases:
+ *
+ * 1. Coarse search: evaluate the site utility on a fixed size grid covering
+ *    the site X/Y ranges, skipping points which violate the cache/nest
+ *    proximity constraints.
+ *
+ * 2. Refinement: compass search around the best grid point, halving the step
+ *    size whenever no neighboring point is better, until the step size drops
+ *    below a tolerance or an iteration limit is reached.
+ *
+ * The # of utility/constraint evaluations per solve is bounded by
+ * (kGRID_RESOLUTION^2 + 4 * kMAX_REFINE_ITERATIONS), independent of the
+ * problem. If no grid point satisfies the constraints, the point which
+ * violates them the least is returned.
+ */
+class grid_cache_site_solver final
+    : public rer::client<grid_cache_site_solver>,
+      public cache_site_solver {
+ public:
+  grid_cache_site_solver(void)
+      : ER_CLIENT_INIT("fordyca.fsm.d2.grid_cache_site_solver") {}
+
+  boost::optional<rmath::vector2d> operator()(const cache_site_problem& problem,
+                                              rmath::rng* rng) override;
+
+  cache_site_solver_status status(void) const override { return m_status; }
+
+ private:
+  /**
+   * \brief The # of points along each dimension of the coarse grid.
+   */
+  static constexpr size_t kGRID_RESOLUTION = 32;
+
+  /**
+   * \brief The maximum # of refinement iterations.
+   */
+  static constexpr size_t kMAX_REFINE_ITERATIONS = 32;
+
+  /**
+   * \brief The refinement step size (in meters) below which the site is
+   * considered converged.
+   */
+  static constexpr double kREFINE_TOL = 0.01;
+
+  /**
+   * \brief The amount of constraint violation that is considered acceptable.
+   */
+  static constexpr double kCONSTRAINT_TOL = 1E-8;
+
+  /**
+   * \brief Compute the total amount by which the specified point violates the
+   * cache/nest proximity constraints (0 if it does not violate any).
+   */
+  double violation(const cache_site_problem& problem,
+                   const rmath::vector2d& point) const RCPPSW_PURE;
+
+  /* clang-format off */
+  cache_site_solver_status m_status{cache_site_solver_status::ekFAILURE};
+  /* clang-format on */
+};
+
+NS_END(d2, fsm, fordyca);
+
+#endif /* INCLUDE_FORDYCA_FSM_D2_GRID_CACHE_SITE_SOLVER_HPP_ */
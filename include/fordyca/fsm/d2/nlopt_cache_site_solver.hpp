@@ -0,0 +1,160 @@
+/**
+ * \file nlopt_cache_site_solver.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_FSM_D2_NLOPT_CACHE_SITE_SOLVER_HPP_
+#define INCLUDE_FORDYCA_FSM_D2_NLOPT_CACHE_SITE_SOLVER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+#include <tuple>
+#include <vector>
+#include <nlopt.hpp>
+
+#include "rcppsw/er/client.hpp"
+
+#include "fordyca/fsm/d2/cache_site_solver.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, fsm, d2);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class nlopt_cache_site_solver
+ * \ingroup fsm d2
+ *
+ * \brief Computes a cache site using NLopt, with one inequality constraint per
+ * known cache and one for the nest. The problem is rebuilt on every solve, and
+ * the initial guess is a random point in the arena, so cost and results vary
+ * from call to call.
+ */
+class nlopt_cache_site_solver final
+    : public rer::client<nlopt_cache_site_solver>,
+      public cache_site_solver {
+ public:
+  struct cache_constraint_data {
+    rmath::vector2d      center{};
+    rtypes::spatial_dist cache_prox{0.0};
+  };
+  struct nest_constraint_data {
+    rmath::vector2d      nest_loc{};
+    rtypes::spatial_dist nest_prox{0.0};
+  };
+  struct site_utility_data {
+    rmath::vector2d position{};
+    rmath::vector2d nest_loc{};
+  };
+
+  using cache_constraint_vector = std::vector<cache_constraint_data>;
+  using nest_constraint_vector = std::vector<nest_constraint_data>;
+
+  nlopt_cache_site_solver(void)
+      : ER_CLIENT_INIT("fordyca.fsm.d2.nlopt_cache_site_solver") {}
+
+  boost::optional<rmath::vector2d> operator()(const cache_site_problem& problem,
+                                              rmath::rng* rng) override;
+
+  cache_site_solver_status status(void) const override { return m_status; }
+
+ private:
+  /*
+   * \brief The amount of violation of cache constraints that is considered
+   * acceptable.
+   */
+  static constexpr double kCACHE_CONSTRAINT_TOL = 1E-8;
+
+  /*
+   * \brief The amount of violation of nest constraints that is considered
+   * acceptable.
+   */
+  static constexpr double kNEST_CONSTRAINT_TOL = 1E-8;
+
+  /**
+   * \brief The difference between utilities evaluated on subsequent timesteps
+   * that will be considered indicative of convergence.
+   */
+  static constexpr double kUTILITY_TOL = 1E-2;
+
+  /**
+   * \brief The maximum # of iterations that the optimizer will run. Needed so
+   * that it does not bring the simulation to a halt while it chugs and
+   * chugs. We *should* be able to get something good enough in this many
+   * iterations.
+   */
+  static constexpr uint kMAX_ITERATIONS = 5000;
+
+  using constraint_set = std::tuple<cache_constraint_vector,
+                                    nest_constraint_vector>;
+
+  /**
+   * \brief Create constraints for known caches and relating to the nest.
+   */
+  void constraints_create(const cache_site_problem& problem);
+
+  void opt_initialize(const cache_site_problem& problem,
+                      std::vector<double>* initial_guess,
+                      rmath::rng* rng);
+
+  std::string nlopt_ret_str(nlopt::result res) const;
+  static cache_site_solver_status nlopt_status(nlopt::result res);
+
+  /* clang-format off */
+  cache_site_solver_status m_status{cache_site_solver_status::ekFAILURE};
+  nlopt::opt               m_alg{nlopt::algorithm::GN_ISRES, 2};
+  constraint_set           m_constraints{};
+  site_utility_data        m_utility_data{};
+  /* clang-format on */
+};
+
+/**
+ * \brief Implements the cache nearness constraint for cache site selection, as
+ * described in \todo paper ref. Cannot be a member function because of how
+ * NLopt works, apparently.
+ */
+double __cache_constraint_func(const std::vector<double>& x,
+                               std::vector<double>& ,
+                               void *data) RCPPSW_PURE;
+
+/**
+ * \brief Implements the nest nearness constraint for cache site selection, as
+ * described in \todo paper ref. Cannot be a member function because of how
+ * NLopt works, apparently.
+ */
+double __nest_constraint_func(const std::vector<double>& x,
+                               std::vector<double>& ,
+                               void *data) RCPPSW_PURE;
+
+/**
+ * \brief Implements the cache site utility function cache site selection, as
+ * described in \todo paper ref. Cannot be a member function because of how
+ * NLopt works, apparently.
+ */
+double __site_utility_func(const std::vector<double>& x,
+                           std::vector<double>& ,
+                           void *data) RCPPSW_PURE;
+
+NS_END(d2, fsm, fordyca);
+
+#endif /* INCLUDE_FORDYCA_FSM_D2_NLOPT_CACHE_SITE_SOLVER_HPP_ */
@@ -24,10 +24,13 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <vector>
+
 #include "rcppsw/er/client.hpp"
 #include "rcppsw/math/vector2.hpp"
 #include "rcppsw/types/timestep.hpp"
 
+#include "fordyca/controller/cognitive/sel_exception_list.hpp"
 #include "fordyca/ds/dp_cache_map.hpp"
 
 /*******************************************************************************
@@ -74,6 +77,13 @@ class existing_cache_selector : public rer::client<existing_cache_selector> {
                                        const rmath::vector2d& position,
                                        const rtypes::timestep& t);
 
+  /**
+   * \brief The factor the densities of all caches can decay by before the
+   * result of the last selection may change (see \ref
+   * math::utility_batch::decay_floor()).
+   */
+  double decay_floor(void) const { return m_decay_floor; }
+
  private:
   /**
    * \brief Determine if the specified cache is excluded from being considered
@@ -85,12 +95,15 @@ class existing_cache_selector : public rer::client<existing_cache_selector> {
    * \return \c TRUE if the cache should be excluded, \c FALSE otherwise.
    */
   bool cache_is_excluded(const rmath::vector2d& position,
-                         const carepr::base_cache* cache) const;
+                         const carepr::base_cache* cache,
+                         const controller::cognitive::sel_exception_list& exceptions) const;
 
   /* clang-format off */
   const bool                                           mc_is_pickup;
   const controller::cognitive::cache_sel_matrix* const mc_matrix;
   const ds::dp_cache_map* const                        mc_cache_map;
+
+  double                                               m_decay_floor{0.0};
   /* clang-format on */
 };
 
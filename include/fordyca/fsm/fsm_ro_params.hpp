@@ -28,6 +28,7 @@
 
 #include "rcppsw/common/common.hpp"
 #include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/discretize_ratio.hpp"
 
 #include "fordyca/config/strategy/strategy_config.hpp"
 #include "fordyca/fordyca.hpp"
@@ -47,6 +48,7 @@ class dpo_store;
 } /* namespace ds */
 
 NS_START(fsm);
+class selection_memo_counts;
 
 /*******************************************************************************
  * Struct Definitions
@@ -63,6 +65,8 @@ struct fsm_ro_params {
   const fccognitive::cache_sel_matrix* csel_matrix;
   const ds::dpo_store* store;
   const fcstrategy::strategy_config strategy_config;
+  selection_memo_counts* memo_counts;
+  const rtypes::discretize_ratio memo_resolution;
 };
 
 NS_END(fsm, fordyca);
@@ -0,0 +1,212 @@
+/**
+ * \file selection_memo.hpp
+ *
+ * \copyright 2019 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_FSM_SELECTION_MEMO_HPP_
+#define INCLUDE_FORDYCA_FSM_SELECTION_MEMO_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/discretize_ratio.hpp"
+
+#include "fordyca/ds/dpo_store.hpp"
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, fsm);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class selection_memo_counts
+ * \ingroup fsm
+ *
+ * \brief The # of hits/misses of all the \ref selection_memo instances of a
+ * robot. Counts are kept per DPO store decay epoch (i.e. per perception
+ * update): the first lookup in a new epoch resets them, so they never need to
+ * be reset externally.
+ */
+class selection_memo_counts {
+ public:
+  selection_memo_counts(void) = default;
+
+  void record(uint decay_epoch, bool hit) {
+    if (decay_epoch != m_epoch) {
+      m_epoch = decay_epoch;
+      m_hits = 0;
+      m_misses = 0;
+    }
+    if (hit) {
+      ++m_hits;
+    } else {
+      ++m_misses;
+    }
+  }
+
+  /**
+   * \brief The # of hits/misses recorded during the specified decay epoch.
+   */
+  size_t n_hits(uint decay_epoch) const {
+    return (decay_epoch == m_epoch) ? m_hits : 0;
+  }
+  size_t n_misses(uint decay_epoch) const {
+    return (decay_epoch == m_epoch) ? m_misses : 0;
+  }
+
+ private:
+  /* clang-format off */
+  uint   m_epoch{0};
+  size_t m_hits{0};
+  size_t m_misses{0};
+  /* clang-format on */
+};
+
+/**
+ * \class selection_memo
+ * \ingroup fsm
+ *
+ * \brief Remembers the result of the last block/cache selection made by an
+ * acquisition FSM, so that asking for it again when nothing it depends on has
+ * changed is O(1), rather than a utility calculation over all known objects.
+ *
+ * A result is reused as long as the DPO store has not structurally changed
+ * (\ref ds::dpo_store::change_epoch()), the robot is still in the same cell of
+ * the occupancy grid, and the version of the selection exception list used has
+ * not changed. Within a cell, the result is the one computed from the position
+ * the robot was at when the selection was last run.
+ *
+ * Decay does not change the store epoch; instead each computed result carries
+ * the factor densities can decay by before it may change (see \ref
+ * math::utility_batch::decay_floor()), which is converted into the # of decay
+ * epochs it can be reused for.
+ */
+template <typename TResult>
+class selection_memo {
+ public:
+  /**
+   * \brief What the selection callable passed to \ref operator()() returns.
+   */
+  struct computed {
+    TResult result{};
+    double decay_floor{1.0};
+  };
+
+  /**
+   * \param store The store selections are made from.
+   * \param counts Where to record hits/misses. Can be NULL.
+   * \param resolution The resolution of the occupancy grid robot positions are
+   *                   discretized with when checking if a result can be
+   *                   reused.
+   */
+  selection_memo(const ds::dpo_store* store,
+                 selection_memo_counts* counts,
+                 const rtypes::discretize_ratio& resolution)
+      : mc_store(store), mc_resolution(resolution), m_counts(counts) {}
+
+  /**
+   * \brief Get the result of the selection for a robot at \p pos, running
+   * \p select to compute it if the last result cannot be reused.
+   *
+   * \param pos The current position of the robot.
+   * \param exceptions_version The version of the selection exception list
+   *                           \p select uses, if any.
+   * \param select Callable computing the selection result (\ref computed).
+   */
+  template <typename TSelect>
+  const TResult& operator()(const rmath::vector2d& pos,
+                            size_t exceptions_version,
+                            const TSelect& select) {
+    key k = { mc_store->change_epoch(),
+              rmath::dvec2zvec(pos, mc_resolution.v()),
+              exceptions_version };
+    uint epoch = mc_store->decay_epoch();
+    bool hit = m_valid && k == m_key &&
+               epoch - m_fill_epoch <= m_decay_window;
+    if (nullptr != m_counts) {
+      m_counts->record(epoch, hit);
+    }
+
+    if (!hit) {
+      computed c = select();
+      m_result = std::move(c.result);
+      m_key = k;
+      m_valid = true;
+      m_fill_epoch = epoch;
+      m_decay_window = decay_window(c.decay_floor);
+    }
+    return m_result;
+  }
+
+ private:
+  struct key {
+    size_t          store_epoch{0};
+    rmath::vector2z cell{};
+    size_t          exceptions_version{0};
+
+    bool operator==(const key& other) const {
+      return store_epoch == other.store_epoch && cell == other.cell &&
+             exceptions_version == other.exceptions_version;
+    }
+  };
+
+  /**
+   * \brief The # of decay epochs after the one a result was computed in that
+   * it can still be reused for, given its decay floor: the largest n such that
+   * (1 - rho)^n > floor.
+   */
+  uint decay_window(double floor) const {
+    double rho = mc_store->pheromone_rho();
+    if (floor <= 0.0 || rho <= 0.0) {
+      return std::numeric_limits<uint>::max();
+    } else if (floor >= 1.0 || rho >= 1.0) {
+      return 0;
+    }
+    double n = std::ceil(std::log(floor) / std::log(1.0 - rho)) - 1.0;
+    if (n >= std::numeric_limits<uint>::max()) {
+      return std::numeric_limits<uint>::max();
+    }
+    return static_cast<uint>(std::max(n, 0.0));
+  }
+
+  /* clang-format off */
+  const ds::dpo_store* const     mc_store;
+  const rtypes::discretize_ratio mc_resolution;
+
+  selection_memo_counts*         m_counts;
+  bool                           m_valid{false};
+  key                            m_key{};
+  uint                           m_fill_epoch{0};
+  uint                           m_decay_window{0};
+  TResult                        m_result{};
+  /* clang-format on */
+};
+
+NS_END(fsm, fordyca);
+
+#endif /* INCLUDE_FORDYCA_FSM_SELECTION_MEMO_HPP_ */
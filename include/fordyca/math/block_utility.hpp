@@ -24,6 +24,8 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <cmath>
+
 #include "rcppsw/math/expression.hpp"
 #include "rcppsw/math/vector2.hpp"
 
@@ -67,6 +69,21 @@ class block_utility : public rmath::expression<double> {
     return calc(rloc, density, priority);
   }
 
+  /**
+   * \brief The utility of a block at (bx, by), for a robot at (rx, ry) and the
+   * nest at (nx, ny). Shared with \ref block_utility_batch, so that both
+   * always compute the same thing.
+   */
+  static double kernel(double bx, double by,
+                       double nx, double ny,
+                       double rx, double ry,
+                       double density,
+                       double priority) {
+    double to_nest = std::sqrt((bx - nx) * (bx - nx) + (by - ny) * (by - ny));
+    double to_robot = std::sqrt((bx - rx) * (bx - rx) + (by - ry) * (by - ry));
+    return (to_nest / to_robot) * std::exp(density * priority);
+  }
+
  private:
   /* clang-format off */
   const rmath::vector2d mc_block_loc;
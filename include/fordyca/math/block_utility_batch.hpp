@@ -0,0 +1,76 @@
+/**
+ * \file block_utility_batch.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_MATH_BLOCK_UTILITY_BATCH_HPP_
+#define INCLUDE_FORDYCA_MATH_BLOCK_UTILITY_BATCH_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <vector>
+
+#include "cosm/repr/pheromone_density.hpp"
+
+#include "fordyca/math/utility_batch.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, math);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class block_utility_batch
+ * \ingroup math
+ *
+ * \brief Calculates \ref block_utility for a set of known blocks at once, and
+ * selects the block with the highest utility.
+ */
+class block_utility_batch final : public utility_batch {
+ public:
+  explicit block_utility_batch(const rmath::vector2d& nest_loc,
+                               size_t n_hint = 0);
+
+  /**
+   * \brief Add a candidate block to the batch.
+   */
+  void add(const rmath::vector2d& block_loc,
+           const crepr::pheromone_density& density,
+           double priority);
+
+  /**
+   * \brief Compute the utility of all candidates for a robot at the specified
+   * location, and select the best one.
+   */
+  result calc(const rmath::vector2d& rloc);
+
+ private:
+  /* clang-format off */
+  const rmath::vector2d mc_nest_loc;
+  std::vector<double>   m_density{};
+  std::vector<double>   m_priority{};
+  /* clang-format on */
+};
+
+NS_END(math, fordyca);
+
+#endif /* INCLUDE_FORDYCA_MATH_BLOCK_UTILITY_BATCH_HPP_ */
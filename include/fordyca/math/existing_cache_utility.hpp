@@ -24,6 +24,8 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <cmath>
+
 #include "rcppsw/math/expression.hpp"
 #include "rcppsw/math/vector2.hpp"
 
@@ -68,6 +70,21 @@ class existing_cache_utility : public rmath::expression<double> {
     return calc(rloc, density, n_blocks);
   }
 
+  /**
+   * \brief The utility of a cache at (cx, cy) containing \p n_blocks blocks,
+   * for a robot at (rx, ry) and the nest at (nx, ny). Shared with \ref
+   * existing_cache_utility_batch, so that both always compute the same thing.
+   */
+  static double kernel(double cx, double cy,
+                       double nx, double ny,
+                       double rx, double ry,
+                       double density,
+                       double n_blocks) {
+    double to_robot = std::sqrt((cx - rx) * (cx - rx) + (cy - ry) * (cy - ry));
+    double to_nest = std::sqrt((cx - nx) * (cx - nx) + (cy - ny) * (cy - ny));
+    return (std::exp(density) * n_blocks) / (to_robot * to_nest);
+  }
+
  private:
   /* clang-format off */
   const rmath::vector2d mc_cache_loc;
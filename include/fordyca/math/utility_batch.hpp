@@ -0,0 +1,158 @@
+/**
+ * \file utility_batch.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_MATH_UTILITY_BATCH_HPP_
+#define INCLUDE_FORDYCA_MATH_UTILITY_BATCH_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "rcppsw/math/vector2.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, math);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class utility_batch
+ * \ingroup math
+ *
+ * \brief Base class for evaluating the utility of a set of candidate
+ * entities all at once, rather than one at a time.
+ *
+ * Candidate attributes are stored as structure-of-arrays, so that derived
+ * classes can compute all utilities in a single tight loop over contiguous
+ * memory with no per-candidate lookups/allocations, which the compiler can
+ * vectorize, and then select the best candidate.
+ *
+ * All utilities are of the form g(loc) * exp(density * c), so as pheromone
+ * densities decay by a common factor f the log-utility of each candidate is
+ * linear in f, which is used to compute how long a selection remains the best
+ * one under decay (\ref decay_floor()).
+ */
+class utility_batch {
+ public:
+  /**
+   * \brief Returned from \ref select() when no candidate has a positive
+   * utility.
+   */
+  static constexpr size_t kNoSelection = std::numeric_limits<size_t>::max();
+
+  struct result {
+    size_t index{kNoSelection};
+    double utility{0.0};
+  };
+
+  size_t size(void) const { return m_x.size(); }
+  bool empty(void) const { return m_x.empty(); }
+
+  /**
+   * \brief The utility of the candidate at the specified index, as of the last
+   * evaluation.
+   */
+  double utility(size_t i) const { return m_utility[i]; }
+
+  /**
+   * \brief Compute the factor all candidate densities can decay by (relative
+   * to the densities they were added with) before \p res may no longer be the
+   * best candidate. As long as the factor stays strictly above the returned
+   * value, \p res is still the result \ref select() would return.
+   *
+   * \return The decay floor in [0, inf); 0 if there is no selection, or no
+   * other candidate can overtake it via decay.
+   */
+  double decay_floor(const result& res) const {
+    if (kNoSelection == res.index) {
+      return 0.0;
+    }
+    double sw = m_density_exp[res.index];
+    double aw = std::log(m_utility[res.index]) - sw;
+    double floor = 0.0;
+    for (size_t i = 0; i < m_utility.size(); ++i) {
+      /*
+       * Only candidates whose density term shrinks more slowly than the
+       * selection's can overtake it as densities decay.
+       */
+      if (i == res.index || m_utility[i] <= 0.0 || m_density_exp[i] >= sw) {
+        continue;
+      }
+      double ai = std::log(m_utility[i]) - m_density_exp[i];
+      floor = std::max(floor, (ai - aw) / (sw - m_density_exp[i]));
+    } /* for(i..) */
+    return floor;
+  }
+
+ protected:
+  utility_batch(void) = default;
+  ~utility_batch(void) = default;
+
+  /**
+   * \brief Add the location of a candidate, and the exponent of the density
+   * term of its utility (i.e. density * c).
+   */
+  void loc_add(const rmath::vector2d& loc, double density_exp) {
+    m_x.push_back(loc.x());
+    m_y.push_back(loc.y());
+    m_density_exp.push_back(density_exp);
+  }
+
+  void reserve(size_t n) {
+    m_x.reserve(n);
+    m_y.reserve(n);
+    m_density_exp.reserve(n);
+    m_utility.reserve(n);
+  }
+
+  /**
+   * \brief Select the candidate with the highest (strictly positive) utility;
+   * ties are broken in favor of the candidate added first.
+   */
+  result select(void) const {
+    result res;
+    for (size_t i = 0; i < m_utility.size(); ++i) {
+      if (m_utility[i] > res.utility) {
+        res = {i, m_utility[i]};
+      }
+    } /* for(i..) */
+    return res;
+  }
+
+  /* clang-format off */
+  std::vector<double> m_x{};
+  std::vector<double> m_y{};
+  std::vector<double> m_density_exp{};
+  std::vector<double> m_utility{};
+  /* clang-format on */
+};
+
+NS_END(math, fordyca);
+
+#endif /* INCLUDE_FORDYCA_MATH_UTILITY_BATCH_HPP_ */
@@ -71,6 +71,18 @@ class dpo_perception_metrics : public virtual rmetrics::base_metrics {
    * currently knows about.
    */
   virtual crepr::pheromone_density avg_cache_density(void) const = 0;
+
+  /**
+   * \brief Return the # of blocks the robot forgot about during its last
+   * perception update because its DPO store was full.
+   */
+  virtual uint n_evicted_blocks(void) const = 0;
+
+  /**
+   * \brief Return the # of caches the robot forgot about during its last
+   * perception update because its DPO store was full.
+   */
+  virtual uint n_evicted_caches(void) const = 0;
 };
 
 NS_END(perception, metrics, fordyca);
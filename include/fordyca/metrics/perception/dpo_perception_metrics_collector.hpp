@@ -82,6 +82,8 @@ class dpo_perception_metrics_collector final
     std::atomic_uint    known_caches{0};
     std::atomic<double> block_density_sum{};
     std::atomic<double> cache_density_sum{};
+    std::atomic_uint    evicted_blocks{0};
+    std::atomic_uint    evicted_caches{0};
   };
 
   struct stats m_interval{};
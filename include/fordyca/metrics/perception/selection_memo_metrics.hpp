@@ -0,0 +1,66 @@
+/**
+ * \file selection_memo_metrics.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_METRICS_PERCEPTION_SELECTION_MEMO_METRICS_HPP_
+#define INCLUDE_FORDYCA_METRICS_PERCEPTION_SELECTION_MEMO_METRICS_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "rcppsw/metrics/base_metrics.hpp"
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics, perception);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+
+/**
+ * \class selection_memo_metrics
+ * \ingroup metrics perception
+ *
+ * \brief Defines the metrics to be collected from robots about how often the
+ * block/cache selections they make from their DPO store are answered from the
+ * result of the previous selection, instead of being recomputed.
+ */
+class selection_memo_metrics : public virtual rmetrics::base_metrics {
+ public:
+  selection_memo_metrics(void) = default;
+
+  /**
+   * \brief Return the # of block/cache selections the robot made during the
+   * last timestep which reused the previous result.
+   */
+  virtual uint n_memo_hits(void) const = 0;
+
+  /**
+   * \brief Return the # of block/cache selections the robot made during the
+   * last timestep which had to be recomputed.
+   */
+  virtual uint n_memo_misses(void) const = 0;
+};
+
+NS_END(perception, metrics, fordyca);
+
+#endif /* INCLUDE_FORDYCA_METRICS_PERCEPTION_SELECTION_MEMO_METRICS_HPP_ */
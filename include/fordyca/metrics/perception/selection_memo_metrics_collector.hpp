@@ -0,0 +1,90 @@
+/**
+ * \file selection_memo_metrics_collector.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_METRICS_PERCEPTION_SELECTION_MEMO_METRICS_COLLECTOR_HPP_
+#define INCLUDE_FORDYCA_METRICS_PERCEPTION_SELECTION_MEMO_METRICS_COLLECTOR_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <string>
+#include <list>
+#include <atomic>
+
+#include "rcppsw/metrics/base_metrics_collector.hpp"
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics, perception);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class selection_memo_metrics_collector
+ * \ingroup metrics perception
+ *
+ * \brief Collector for \ref selection_memo_metrics.
+ *
+ * Metrics CAN be collected in parallel from robots; concurrent updates to the
+ * gathered stats are supported. Metrics are written out at the specified
+ * collection interval.
+ */
+class selection_memo_metrics_collector final
+    : public rmetrics::base_metrics_collector {
+ public:
+  /**
+   * \param ofname_stem The output file name stem.
+   * \param interval Collection interval.
+   */
+  selection_memo_metrics_collector(const std::string& ofname_stem,
+                                   const rtypes::timestep& interval);
+
+  void reset(void) override;
+  void collect(const rmetrics::base_metrics& metrics) override;
+  void reset_after_interval(void) override;
+
+ private:
+  std::list<std::string> csv_header_cols(void) const override;
+  boost::optional<std::string> csv_line_build(void) override;
+
+  /* clang-format off */
+
+  /**
+   * \brief Container for holding collected statistics. Must be atomic so counts
+   * are valid in parallel metric collection contexts.
+   */
+  struct stats {
+    std::atomic_uint robot_count{0};
+    std::atomic_uint hits{0};
+    std::atomic_uint misses{0};
+    std::atomic_uint lookups{0};
+  };
+
+  struct stats m_interval{};
+  struct stats m_cum{};
+  /* clang-format on */
+};
+
+NS_END(perception, metrics, fordyca);
+
+#endif /* INCLUDE_FORDYCA_METRICS_PERCEPTION_SELECTION_MEMO_METRICS_COLLECTOR_HPP_ */
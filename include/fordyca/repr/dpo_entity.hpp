@@ -24,6 +24,7 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <cmath>
 #include <memory>
 #include <utility>
 
@@ -48,13 +49,25 @@ NS_START(fordyca, repr);
  *
  * When performing equality tests between instances, only the underlying entity
  * is considered (relevance is ignored).
+ *
+ * The tracked entity is either a private copy owned by this instance (version
+ * 0), or a handle to a shared, immutable snapshot from \ref
+ * ds::arena_snapshot_pool (version > 0), which must be detached via \ref
+ * ent_detach() before it is modified (copy-on-write).
+ *
+ * Once added to a \ref ds::dpo_map, the entity's pheromone density is stored
+ * relative to the map's decay epoch at which it was last brought up to date,
+ * and decayed on demand when read, so that the map does not have to touch
+ * every entity each timestep.
  */
 template <class T>
 class dpo_entity {
  public:
   dpo_entity(void) = default;
-  dpo_entity(std::unique_ptr<T> ent, const crepr::pheromone_density& density)
-      : m_ent(std::move(ent)), m_density(density) {}
+  dpo_entity(std::shared_ptr<T> ent,
+             const crepr::pheromone_density& density,
+             uint version = 0)
+      : m_ent(std::move(ent)), m_density(density), m_version(version) {}
 
   /**
    * \brief Compare two entities for equality. We must explicitly invoke
@@ -65,18 +78,93 @@ class dpo_entity {
     return m_ent->idcmp(*other.ent());
   }
 
-  T* ent(void) { return m_ent.get(); }
+  /**
+   * \brief Get a read-only handle to the tracked entity. Use \ref
+   * ent_detach() to get one that can be modified.
+   */
   const T* ent(void) const { return m_ent.get(); }
 
-  const crepr::pheromone_density& density(void) const { return m_density; }
-  crepr::pheromone_density& density(void) { return m_density; }
+  /**
+   * \brief Get the current pheromone density, with all decay since it was last
+   * brought up to date applied.
+   */
+  crepr::pheromone_density density(void) const {
+    crepr::pheromone_density density = m_density;
+    pheromone_decay(&density, elapsed());
+    return density;
+  }
+
+  /**
+   * \brief Set the pheromone density. For entities in a \ref ds::dpo_map, use
+   * \ref ds::dpo_map::density_update() instead.
+   */
+  void density(const crepr::pheromone_density& density) {
+    m_density = density;
+    m_synced = epoch();
+  }
+
+  /**
+   * \brief Bind the entity to the decay epoch of the \ref ds::dpo_map it is
+   * being added to. Its current density is considered up to date as of the
+   * current epoch.
+   */
+  void epoch_bind(std::shared_ptr<const uint> epoch) {
+    density_sync();
+    m_epoch = std::move(epoch);
+    m_synced = *m_epoch;
+  }
+
+  /**
+   * \brief The version of the arena snapshot this entity refers to, or 0 if
+   * the entity is a private copy.
+   */
+  uint version(void) const { return m_version; }
 
-  void density(const crepr::pheromone_density& density) { m_density = density; }
+  /**
+   * \brief Get a handle to the tracked entity that is safe to modify, making a
+   * private copy of it first if it is currently shared.
+   */
+  T* ent_detach(void) {
+    if (0 != m_version) {
+      m_ent = m_ent->clone();
+      m_version = 0;
+    }
+    return m_ent.get();
+  }
 
  private:
+  uint epoch(void) const { return (nullptr == m_epoch) ? 0 : *m_epoch; }
+  uint elapsed(void) const { return epoch() - m_synced; }
+
+  void density_sync(void) {
+    pheromone_decay(&m_density, elapsed());
+    m_synced = epoch();
+  }
+
+  /**
+   * \brief Apply \p elapsed epochs worth of decay to \p density. The first
+   * step applies any pheromone deposited since the last sync along with the
+   * decay; the remaining steps are pure exponential decay, and are applied in
+   * closed form.
+   */
+  static void pheromone_decay(crepr::pheromone_density* density,
+                              uint elapsed) {
+    if (0 == elapsed) {
+      return;
+    }
+    density->update();
+    if (elapsed > 1) {
+      density->pheromone_set(density->v() *
+                             std::pow(1.0 - density->rho(), elapsed - 1));
+    }
+  }
+
   /* clang-format off */
-  std::unique_ptr<T>       m_ent;
-  crepr::pheromone_density m_density;
+  std::shared_ptr<T>          m_ent;
+  crepr::pheromone_density    m_density;
+  uint                        m_version{0};
+  std::shared_ptr<const uint> m_epoch{nullptr};
+  uint                        m_synced{0};
   /* clang-format on */
 };
 
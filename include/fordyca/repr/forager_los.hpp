@@ -41,7 +41,11 @@ NS_START(fordyca, repr);
  * \ingroup repr
  *
  * \brief A line of sight for foraging applications, which computes the lists of
- * blocks and/or caches present in the LOS on request.
+ * blocks and/or caches present in the LOS once, upon construction.
+ *
+ * A LOS is constructed for each robot once per timestep, before its controller
+ * is run, and the part of the arena it views does not change while the
+ * controller is running, so the lists remain valid for the lifetime of the LOS.
  *
  * The line of sight itself is meant to be a read-only view of part of the
  * arena, but it also exposes non-const access to the blocks and caches within
@@ -49,14 +53,30 @@ NS_START(fordyca, repr);
  */
 class forager_los final : public crepr::los2D, public rer::client<forager_los> {
  public:
-  explicit forager_los(const const_grid_view& c_view)
-      : los2D(c_view), ER_CLIENT_INIT("fordyca.repr.forager_los") {}
+  explicit forager_los(const const_grid_view& c_view);
+
+  /**
+   * \brief Get the list of blocks currently in the LOS. Each block appears
+   * once, even if it spans multiple cells.
+   */
+  const cds::block3D_vectorno& blocks(void) const { return m_blocks; }
 
   /**
-   * \brief Get the list of blocks currently in the LOS.
+   * \brief Get the list of caches currently in the LOS. Each cache appears
+   * once, even though its host cell and extent cells all refer to it.
    */
-  cds::block3D_vectorno blocks(void) const;
-  cads::bcache_vectorno caches(void) const;
+  const cads::bcache_vectorno& caches(void) const { return m_caches; }
+
+ private:
+  /**
+   * \brief Scan the LOS and build the lists of blocks and caches in it.
+   */
+  void entities_extract(void);
+
+  /* clang-format off */
+  cds::block3D_vectorno m_blocks{};
+  cads::bcache_vectorno m_caches{};
+  /* clang-format on */
 };
 
 NS_END(repr, fordyca);
@@ -39,6 +39,7 @@
 #include "cosm/foraging/ds/block_cluster_vector.hpp"
 
 #include "fordyca/fordyca.hpp"
+#include "fordyca/ds/block_membership_index.hpp"
 #include "fordyca/metrics/caches/lifecycle_metrics.hpp"
 #include "fordyca/config/caches/caches_config.hpp"
 
@@ -106,6 +107,12 @@ class base_cache_manager : public metrics::caches::lifecycle_metrics,
       const cads::acache_vectorno& existing_caches,
       const cfds::block3D_cluster_vectorro& clusters)>;
 
+  /**
+   * \brief Allocate the blocks usable/absorbable for cache creation using the
+   * specified filters. The block membership index is rebuilt before any
+   * filter is applied, so filters can use \ref block_membership() to check
+   * if a block is in a cache/cluster in O(1).
+   */
   boost::optional<creation_blocks> creation_blocks_alloc(
       const cds::block3D_vectorno& all_blocks,
       const cads::acache_vectorno& existing_caches,
@@ -142,6 +149,9 @@ class base_cache_manager : public metrics::caches::lifecycle_metrics,
   void bloctree_update(const cads::acache_vectoro& caches);
 
   const config::caches::caches_config* config(void) const { return &mc_config; }
+  const ds::block_membership_index& block_membership(void) const {
+    return m_block_membership;
+  }
 
  private:
   /* clang-format off */
@@ -153,6 +163,7 @@ class base_cache_manager : public metrics::caches::lifecycle_metrics,
 
   carena::caching_arena_map * const   m_map;
   std::mutex                          m_mutex{};
+  ds::block_membership_index          m_block_membership{};
   /* clang-format on */
 };
 
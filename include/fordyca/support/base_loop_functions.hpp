@@ -35,12 +35,15 @@
 #include "rcppsw/math/radians.hpp"
 #include "rcppsw/math/rng.hpp"
 #include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/type_uuid.hpp"
 #include "rcppsw/utils/color.hpp"
 
 #include "cosm/pal/argos_sm_adaptor.hpp"
 
 #include "fordyca/config/loop_function_repository.hpp"
 #include "fordyca/fordyca.hpp"
+#include "fordyca/support/interaction_intent.hpp"
+#include "fordyca/support/interactor_status.hpp"
 #include "fordyca/support/tv/tv_manager.hpp"
 
 /*******************************************************************************
@@ -71,6 +74,15 @@ class foraging_oracle;
 
 NS_START(fordyca);
 
+namespace ds {
+class arena_snapshot_pool;
+class oracle_knowledge;
+} /* namespace ds */
+
+namespace controller {
+class foraging_controller;
+} /* namespace controller */
+
 namespace config {
 class loop_function_repository;
 namespace tv {
@@ -119,6 +131,12 @@ class base_loop_functions : public cpal::argos_sm_adaptor,
   }
   const cforacle::foraging_oracle* oracle(void) const { return m_oracle.get(); }
   const carena::caching_arena_map* arena_map(void) const RCPPSW_PURE;
+  const ds::arena_snapshot_pool* snapshot_pool(void) const {
+    return m_snapshots.get();
+  }
+  const ds::oracle_knowledge* oracle_knowledge(void) const {
+    return m_oracle_knowledge.get();
+  }
 
  protected:
   tv::tv_manager* tv_manager(void) { return m_tv_manager.get(); }
@@ -127,8 +145,70 @@ class base_loop_functions : public cpal::argos_sm_adaptor,
   convergence_calculator_type* conv_calculator(void) { return m_conv_calc.get(); }
   cforacle::foraging_oracle* oracle(void) { return m_oracle.get(); }
   carena::caching_arena_map* arena_map(void) RCPPSW_PURE;
+  ds::arena_snapshot_pool* snapshot_pool(void) { return m_snapshots.get(); }
   void config_parse(ticpp::Element& node) RCPPSW_COLD;
 
+  /**
+   * \brief Determine if the swarm has changed due to population dynamics since
+   * the last call: either its size is no longer \p n_robots, or robots have
+   * been killed (and possibly replaced by new ones). If robots have been
+   * killed, the oracle's knowledge of the arena is rebuilt, as they drop the
+   * blocks they were carrying.
+   */
+  bool swarm_changed(size_t n_robots);
+
+  /**
+   * \brief Attach the arena snapshot pool to the DPO stores of all robots
+   * which do not have it yet (e.g. robots added by population dynamics).
+   */
+  void snapshot_pool_attach(void);
+
+  /**
+   * \brief Get the ID of the block a robot is carrying, or \ref
+   * rtypes::constants::kNoUUID if it is not carrying one.
+   */
+  static rtypes::type_uuid
+  carried_block(const controller::foraging_controller* controller);
+
+  /**
+   * \brief Determine if the interaction a robot decided on during the parallel
+   * phase of the post-step can still be applied, or if it conflicts with an
+   * interaction applied before it in the merge phase (i.e. the block/cache it
+   * targeted has since been picked up/depleted by a robot with a lower ID).
+   *
+   * Robots whose interaction conflicts do not interact with the arena this
+   * timestep, and decide again next timestep from the updated arena state.
+   */
+  bool interaction_valid(const controller::foraging_controller* controller,
+                         const interaction_intent& intent) const;
+
+  /**
+   * \brief Notify the arena snapshot pool that a robot which was carrying \p
+   * carried before interacting with the arena (\ref carried_block()) has
+   * picked up/dropped a block, if what it is carrying has changed.
+   */
+  void snapshot_pool_notify(const rtypes::type_uuid& carried,
+                            const controller::foraging_controller* controller);
+
+  /**
+   * \brief Apply the changes a robot which was carrying \p carried before
+   * interacting with the arena has made to it to the oracle's knowledge of the
+   * free blocks/caches in the arena, instead of rebuilding it.
+   *
+   * \param status The result of the interaction, for changes which cannot be
+   *               inferred from what the robot is carrying (cache depletion).
+   */
+  void oracle_notify(const rtypes::type_uuid& carried,
+                     const controller::foraging_controller* controller,
+                     const interactor_status& status);
+
+  /**
+   * \brief Notify the snapshot pool and the oracle that blocks/caches have
+   * changed outside of robot interactions (e.g. cache creation), so that they
+   * rescan the arena before the next timestep.
+   */
+  void arena_changed(void);
+
   /*
    * If we are doing a powerlaw distribution we may need to create caches BEFORE
    * clusters, so that cluster mapping will avoid the placed caches, and we
@@ -168,12 +248,27 @@ class base_loop_functions : public cpal::argos_sm_adaptor,
    */
   void oracle_init(const coconfig::aggregate_oracle_config* oraclep) RCPPSW_COLD;
 
+  /**
+   * \brief Initialize the pool of arena snapshots shared between the DPO
+   * stores of all robots, so that they do not each need to clone every
+   * block/cache they see.
+   */
+  void snapshot_pool_init(void) RCPPSW_COLD;
+
   /* clang-format off */
   bool                                         m_delay_arena_map_init{false};
   config::loop_function_repository             m_config{};
   std::unique_ptr<tv::tv_manager>              m_tv_manager;
   std::unique_ptr<convergence_calculator_type> m_conv_calc;
   std::unique_ptr<cforacle::foraging_oracle>   m_oracle;
+  std::unique_ptr<ds::arena_snapshot_pool>     m_snapshots;
+  std::unique_ptr<ds::oracle_knowledge>        m_oracle_knowledge;
+
+  /**
+   * \brief The # of robots killed by population dynamics as of the last call
+   * to \ref swarm_changed().
+   */
+  size_t                                       m_n_killed{0};
   /* clang-format on */
 };
 
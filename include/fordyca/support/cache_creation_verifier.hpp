@@ -24,8 +24,13 @@
 /*******************************************************************************
  * Includes
  ******************************************************************************/
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "rcppsw/er/client.hpp"
+#include "rcppsw/math/range.hpp"
 #include "rcppsw/types/spatial_dist.hpp"
 
 #include "cosm/arena/ds/nest_vector.hpp"
@@ -54,6 +59,19 @@ NS_START(fordyca, support);
  * \brief Provides verification of newly created caches, indicating to calling
  *        classes if the newly created cache should be kept or discarded
  *        (according to configuration).
+ *
+ * Supports two modes of operation:
+ *
+ * - Full audit (\ref verify_single(), \ref sanity_checks()), in which ALL
+ *   checks are re-run on ALL caches each time.
+ *
+ * - Incremental (\ref verify_incremental()), in which the verifier remembers
+ *   the caches accepted so far during a creation pass, and checks a new cache
+ *   only against the caches and free blocks near it, plus the clusters and
+ *   nests. Previously accepted caches have already passed all checks, and
+ *   accepting a new cache can only reduce the set of free blocks, so this is
+ *   equivalent. When built with full event reporting, incremental verification
+ *   falls back to a full audit.
  */
 class cache_creation_verifier : public rer::client<cache_creation_verifier> {
  public:
@@ -72,6 +90,29 @@ class cache_creation_verifier : public rer::client<cache_creation_verifier> {
                      const cds::block3D_vectorno& c_all_blocks,
                      const cfds::block3D_cluster_vectorro& c_clusters) const;
 
+  /**
+   * \brief Start a new incremental creation pass: forget all previously
+   * accepted caches and index the specified blocks by location.
+   *
+   * \param c_all_blocks All blocks in the arena.
+   */
+  void reset(const cds::block3D_vectorno& c_all_blocks);
+
+  /**
+   * \brief Is the created cache OK given the caches accepted so far this
+   * creation pass, or should it be discarded? If it is OK, then it is
+   * accepted, and subsequently created caches will be verified against it.
+   */
+  bool verify_incremental(const carepr::arena_cache* cache,
+                          const cfds::block3D_cluster_vectorro& c_clusters);
+
+  /**
+   * \brief Re-index the specified blocks at their current locations, after
+   * they have been moved during the creation pass (i.e. redistributed after a
+   * cache was discarded).
+   */
+  void blocks_moved(const cds::block3D_vectorno& c_blocks);
+
   /**
    * \brief Basic sanity checks on a set of newly created caches.
    *
@@ -97,6 +138,34 @@ class cache_creation_verifier : public rer::client<cache_creation_verifier> {
                      const cads::nest_vectorro& c_nests) const RCPPSW_PURE;
 
  private:
+  using key_type = uint64_t;
+
+  key_type key(int i, int j) const {
+    return (static_cast<key_type>(static_cast<uint32_t>(i)) << 32) |
+           static_cast<uint32_t>(j);
+  }
+  int cell_coord(double v) const;
+
+  /**
+   * \brief Apply the specified callback to the keys of all index cells which
+   * the specified span overlaps.
+   */
+  template <typename TCallback>
+  void cells_visit(const rmath::ranged& xspan,
+                   const rmath::ranged& yspan,
+                   const TCallback& cb) const {
+    for (int i = cell_coord(xspan.lb()); i <= cell_coord(xspan.ub()); ++i) {
+      for (int j = cell_coord(yspan.lb()); j <= cell_coord(yspan.ub()); ++j) {
+        cb(key(i, j));
+      } /* for(j..) */
+    } /* for(i..) */
+  }
+
+  bool verify_result(const carepr::arena_cache* cache, bool sanity_ok) const;
+  bool verify_new(const carepr::arena_cache* cache,
+                  const cfds::block3D_cluster_vectorro& c_clusters) const;
+  void accept(const carepr::arena_cache* cache);
+
   bool sanity_check_internal_consistency(const carepr::arena_cache* cache) const
       RCPPSW_PURE;
   bool
@@ -113,10 +182,19 @@ class cache_creation_verifier : public rer::client<cache_creation_verifier> {
                                  const cads::nest_vectorro& nests) const;
 
   /* clang-format off */
-  const rtypes::spatial_dist mc_cache_dim;
-  const bool                 mc_strict_constraints;
+  const rtypes::spatial_dist                       mc_cache_dim;
+  const bool                                       mc_strict_constraints;
+
+  carena::caching_arena_map*                       m_map;
 
-  carena::caching_arena_map* m_map;
+  /* incremental verification state */
+  cds::block3D_vectorno                            m_all_blocks{};
+  cads::acache_vectorro                            m_accepted{};
+  std::unordered_set<int>                          m_accepted_blocks{};
+  std::unordered_map<key_type,
+                     cds::block3D_vectorno>        m_block_cells{};
+  std::unordered_map<key_type,
+                     cads::acache_vectorro>        m_cache_cells{};
   /* clang-format on */
 };
 NS_END(support, fordyca);
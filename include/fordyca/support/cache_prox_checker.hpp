@@ -29,6 +29,7 @@
 #include "cosm/arena/caching_arena_map.hpp"
 
 #include "fordyca//controller/foraging_controller.hpp"
+#include "fordyca/ds/cache_prox_index.hpp"
 #include "fordyca/events/cache_proximity.hpp"
 
 /*******************************************************************************
@@ -44,7 +45,8 @@ NS_START(fordyca, support);
  * \ingroup support
  *
  * \brief Check if a controller is too close to a cache for a block drop of some
- * kind.
+ * kind, using a \ref ds::cache_prox_index (rebuilt here if it is stale) rather
+ * than scanning all caches.
  */
 class cache_prox_checker : public rer::client<cache_prox_checker> {
  public:
@@ -55,10 +57,10 @@ class cache_prox_checker : public rer::client<cache_prox_checker> {
   };
 
   cache_prox_checker(const carena::caching_arena_map* const map,
-                     const rtypes::spatial_dist& prox_dist)
+                     ds::cache_prox_index* const index)
       : ER_CLIENT_INIT("fordyca.support.d2.cache_prox_checker"),
-        mc_prox_dist(prox_dist),
-        mc_map(map) {}
+        mc_map(map),
+        m_index(index) {}
 
   /* Not copy constructable/assignable by default */
   cache_prox_checker(const cache_prox_checker&) = delete;
@@ -92,14 +94,12 @@ class cache_prox_checker : public rer::client<cache_prox_checker> {
      * it.
      */
     mc_map->maybe_lock_rd(mc_map->cache_mtx(), need_lock);
-    for (const auto* cache : mc_map->caches()) {
-      if (mc_prox_dist >= (cache->rcenter2D() - c.rpos2D()).length()) {
-        result = { cache->id(),
-                   cache->rcenter2D(),
-                   cache->rcenter2D() - c.rpos2D() };
-        break;
-      }
-    } /* for(&b..) */
+    if (!m_index->is_current(mc_map->caches().size())) {
+      m_index->rebuild(mc_map->caches());
+    }
+    if (const auto* cache = m_index->query(c.rpos2D())) {
+      result = { cache->id, cache->center, cache->center - c.rpos2D() };
+    }
     mc_map->maybe_unlock_rd(mc_map->cache_mtx(), need_lock);
     return result;
   }
@@ -133,7 +133,7 @@ class cache_prox_checker : public rer::client<cache_prox_checker> {
               prox_status.id.v(),
               prox_status.loc.to_str().c_str(),
               prox_status.distance.length(),
-              mc_prox_dist.v());
+              m_index->prox_dist().v());
       notify(controller, prox_status.id, false);
 
       mc_map->unlock_rd(mc_map->cache_mtx());
@@ -164,8 +164,8 @@ class cache_prox_checker : public rer::client<cache_prox_checker> {
 
  private:
   /* clang-format off */
-  const rtypes::spatial_dist       mc_prox_dist;
   const carena::caching_arena_map* mc_map;
+  ds::cache_prox_index*            m_index;
   /* clang-format on */
 };
 
@@ -35,6 +35,9 @@
 
 #include "fordyca/repr/forager_los.hpp"
 #include "fordyca/support/base_loop_functions.hpp"
+#include "fordyca/support/interaction_buffer.hpp"
+#include "fordyca/support/interaction_intent_extractor.hpp"
+#include "fordyca/support/robot_dispatch_table.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -102,6 +105,9 @@ private:
     rmpl::typelist_wrap_apply<controller::d0::typelist,
                               ccops::metrics_extract,
                               d0_metrics_aggregator>::type>;
+  using intent_extractor_map_type = rds::type_map<
+    rmpl::typelist_wrap_apply<controller::d0::typelist,
+                              interaction_intent_extractor>::type>;
   /**
    * \brief These are friend classes because they are basically just pieces of
    * the loop functions pulled out for increased clarity/modularity, and are not
@@ -128,24 +134,46 @@ private:
    *
    * \note These operations are done in parallel for all robots (lock free).
    */
-  void robot_pre_step(chal::robot& robot);
+  void robot_pre_step(controller::foraging_controller* controller);
 
   /**
    * \brief Process a single robot on a timestep, after running its controller.
    *
-   * - Have it interact with the environment.
+   * - Decide how it will interact with the environment this timestep, if
+   *   at all, and defer the decision to the merge phase.
+   * - Otherwise, collect metrics from it.
+   *
+   * \note These operations are done in parallel for all robots (lock free).
+   */
+  void robot_post_step(controller::foraging_controller* controller);
+
+  /**
+   * \brief Process a single robot deferred during \ref robot_post_step():
+   *
+   * - Have it interact with the environment as it decided to (\p intent), if
+   *   that is still possible.
    * - Collect metrics from it.
    *
-   * \note These operations are done in parallel for all robots (with mutual
-   *       exclusion as needed).
+   * \note These operations are done serially, in robot ID order.
+   */
+  void robot_post_step_merge(controller::foraging_controller* controller,
+                             const interaction_intent& intent);
+
+  /**
+   * \brief Collect metrics from a robot, now that it has finished interacting
+   * with the environment and no more changes to its state will occur this
+   * timestep.
    */
-  void robot_post_step(chal::robot& robot);
+  void robot_metrics_collect(controller::foraging_controller* controller);
 
   /* clang-format off */
   std::unique_ptr<d0_metrics_aggregator>      m_metrics_agg;
   std::unique_ptr<interactor_map_type>        m_interactor_map;
   std::unique_ptr<metric_extraction_map_type> m_metrics_map;
   std::unique_ptr<los_updater_map_type>       m_los_update_map;
+  std::unique_ptr<intent_extractor_map_type>  m_intent_map;
+  interaction_buffer                          m_interactions{};
+  robot_dispatch_table                        m_dispatch{};
   /* clang-format on */
 };
 
@@ -25,6 +25,7 @@
  * Includes
  ******************************************************************************/
 #include "fordyca/support/free_block_pickup_interactor.hpp"
+#include "fordyca/support/interaction_intent.hpp"
 #include "fordyca/support/nest_block_drop_interactor.hpp"
 #include "fordyca/support/mpl/free_block_pickup_spec.hpp"
 #include "fordyca/support/mpl/nest_block_drop_spec.hpp"
@@ -74,15 +75,20 @@ class robot_arena_interactor final : public rer::client<robot_arena_interactor<T
    * \brief The actual handling function for the interactions.
    *
    * \param controller The controller to handle interactions for.
+   * \param intent The interaction the robot decided on this timestep.
    * \param t The current timestep.
    */
   interactor_status operator()(TController& controller,
+                               const interaction_intent& intent,
                                const rtypes::timestep& t) {
-    if (controller.is_carrying_block()) {
-      return m_nest_drop(controller, t);
-    } else { /* The foot-bot has no block item */
-      return m_free_pickup(controller, t);
-    }
+    switch (intent.kind) {
+      case interaction_kind::ekNEST_DROP:
+        return m_nest_drop(controller, t);
+      case interaction_kind::ekFREE_PICKUP:
+        return m_free_pickup(controller, t);
+      default:
+        return interactor_status::ekNO_EVENT;
+    } /* switch() */
   }
 
  private:
@@ -48,9 +48,11 @@ class robot_configurer : public boost::static_visitor<void> {
  public:
   using controller_type = TController;
   robot_configurer(const cvconfig::visualization_config* const config,
-                   cforacle::foraging_oracle* const oracle)
+                   cforacle::foraging_oracle* const oracle,
+                   const ds::oracle_knowledge* const knowledge)
       : mc_config(config),
-        mc_oracle(oracle) {}
+        mc_oracle(oracle),
+        mc_knowledge(knowledge) {}
 
   template<typename U = TController,
            RCPPSW_SFINAE_TYPELIST_REJECT(controller::d0::oracular_typelist,
@@ -70,7 +72,7 @@ class robot_configurer : public boost::static_visitor<void> {
       c->display_id(mc_config->robot_id);
     }
     if (nullptr != mc_oracle) {
-      auto receptor = std::make_unique<controller::cognitive::oracular_info_receptor>(mc_oracle);
+      auto receptor = std::make_unique<controller::cognitive::oracular_info_receptor>(mc_oracle, mc_knowledge);
       c->oracle_init(std::move(receptor));
     }
   }
@@ -79,6 +81,7 @@ class robot_configurer : public boost::static_visitor<void> {
   /* clang-format off */
   const cvconfig::visualization_config * const mc_config;
   const cforacle::foraging_oracle *            mc_oracle;
+  const ds::oracle_knowledge *                 mc_knowledge;
   /* clang-format on */
 };
 
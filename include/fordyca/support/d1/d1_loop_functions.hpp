@@ -26,11 +26,9 @@
  ******************************************************************************/
 #include <vector>
 #include <memory>
-#include <atomic>
 #include <utility>
 
 #include "cosm/controller/operations/robot_los_update.hpp"
-#include "cosm/controller/operations/task_id_extract.hpp"
 
 #include "fordyca/support/d0/d0_loop_functions.hpp"
 
@@ -53,12 +51,6 @@ class robot_arena_interactor;
 
 namespace detail {
 struct functor_maps_initializer;
-template<typename T>
-struct d1_subtask_status_extractor;
-using d1_subtask_status_map_type =
-    rds::type_map<rmpl::typelist_wrap_apply<controller::d1::typelist,
-                                            d1_subtask_status_extractor>::type>;
-
 } /* namespace detail */
 
 /*******************************************************************************
@@ -99,11 +91,6 @@ class d1_loop_functions : public d0::d0_loop_functions,
   void shared_init(ticpp::Element& node) RCPPSW_COLD;
 
  private:
-  struct cache_counts {
-    std::atomic_uint n_harvesters{0};
-    std::atomic_uint n_collectors{0};
-  };
-
   using interactor_map_type = rds::type_map<
    rmpl::typelist_wrap_apply<controller::d1::typelist,
                              robot_arena_interactor,
@@ -113,13 +100,13 @@ class d1_loop_functions : public d0::d0_loop_functions,
                               ccops::robot_los_update,
                               rds::grid2D_overlay<cds::cell2D>,
                               repr::forager_los>::type>;
-  using task_extractor_map_type = rds::type_map<
-    rmpl::typelist_wrap_apply<controller::d1::typelist,
-                              ccops::task_id_extract>::type>;
   using metric_extractor_map_type = rds::type_map<
     rmpl::typelist_wrap_apply<controller::d1::typelist,
                               ccops::metrics_extract,
                               d1_metrics_aggregator>::type>;
+  using intent_extractor_map_type = rds::type_map<
+    rmpl::typelist_wrap_apply<controller::d1::typelist,
+                              interaction_intent_extractor>::type>;
 
   /**
    * \brief These are friend classes because they are basically just pieces of
@@ -160,22 +147,42 @@ class d1_loop_functions : public d0::d0_loop_functions,
    *
    * \note These operations are done in parallel for all robots (lock free).
    */
-  void robot_pre_step(chal::robot& robot);
+  void robot_pre_step(controller::foraging_controller* controller);
 
   /**
    * \brief Process a single robot on a timestep, after running its controller.
    *
-   * - Have it interact with the environment.
+   * - Decide how it will interact with the environment this timestep
+   *   (including aborting its current task), if at all, and defer the
+   *   decision to the merge phase.
+   * - Otherwise, collect metrics from it.
+   *
+   * \note These operations are done in parallel for all robots (lock free).
+   */
+  void robot_post_step(controller::foraging_controller* controller);
+
+  /**
+   * \brief Process a single robot deferred during \ref robot_post_step():
+   *
+   * - Have it interact with the environment as it decided to (\p intent), if
+   *   that is still possible.
    * - Collect metrics from it.
    *
-   * \note These operations are done in parallel for all robots (with mutual
-   *       exclusion as needed).
+   * \note These operations are done serially, in robot ID order.
+   */
+  void robot_post_step_merge(controller::foraging_controller* controller,
+                             const interaction_intent& intent);
+
+  /**
+   * \brief Collect metrics from a robot, now that it has finished interacting
+   * with the environment and no more changes to its state will occur this
+   * timestep.
    */
-  void robot_post_step(chal::robot& robot);
+  void robot_metrics_collect(controller::foraging_controller* controller);
 
   /**
-   * \brief Extract the numerical ID of the task each robot is currently
-   * executing for use in convergence calculations.
+   * \brief Get the ID of the task each robot is currently executing from the
+   * task census for use in convergence calculations.
    *
    * \param uint Unused.
    */
@@ -194,23 +201,16 @@ class d1_loop_functions : public d0::d0_loop_functions,
    */
   bool caches_depleted(void) const RCPPSW_PURE;
 
-  /**
-   * \brief Collect task counts from controllers on timesteps one or more static
-   * caches have been depleted in order to calculate re-creation probabilities.
-   */
-  void caches_recreation_task_counts_collect(
-      const controller::foraging_controller* controller);
-
   /* clang-format off */
   std::unique_ptr<interactor_map_type>                m_interactor_map;
   std::unique_ptr<metric_extractor_map_type>          m_metric_extractor_map;
   std::unique_ptr<los_updater_map_type>               m_los_update_map;
-  std::unique_ptr<task_extractor_map_type>            m_task_extractor_map;
-  std::unique_ptr<detail::d1_subtask_status_map_type> m_subtask_status_map;
+  std::unique_ptr<intent_extractor_map_type>          m_intent_map;
+  interaction_buffer                                  m_interactions{};
+  robot_dispatch_table                                m_dispatch{};
 
   std::unique_ptr<d1_metrics_aggregator>              m_metrics_agg;
   std::unique_ptr<static_cache_manager>               m_cache_manager;
-  cache_counts                                        m_cache_counts{};
   /* clang-format on */
 };
 
@@ -34,8 +34,10 @@
 #include "cosm/ta/polled_task.hpp"
 
 #include "fordyca/support/d0/d0_metrics_aggregator.hpp"
+#include "fordyca/support/task_census.hpp"
 #include "fordyca/metrics/perception/dpo_perception_metrics.hpp"
 #include "fordyca/metrics/perception/mdpo_perception_metrics.hpp"
+#include "fordyca/metrics/perception/selection_memo_metrics.hpp"
 #include "fordyca//controller/foraging_controller.hpp"
 #include "fordyca/fsm/foraging_acq_goal.hpp"
 #include "fordyca/controller/cognitive/foraging_perception_subsystem.hpp"
@@ -96,7 +98,14 @@ class d1_metrics_aggregator : public d0::d0_metrics_aggregator,
    */
   void task_finish_or_abort_cb(const cta::polled_task* task);
 
-  void task_start_cb(const cta::polled_task*, const cta::ds::bi_tab* tab);
+  void task_start_cb(const cta::polled_task* task, const cta::ds::bi_tab* tab);
+
+  /**
+   * \brief The swarm-wide task census, kept current by the task
+   * start/finish/abort callbacks.
+   */
+  const task_census* census(void) const { return &m_census; }
+  task_census* census(void) { return &m_census; }
 
     /**
    * \brief Collect metrics from the d1 controller.
@@ -121,6 +130,15 @@ class d1_metrics_aggregator : public d0::d0_metrics_aggregator,
       if (nullptr != dpo) {
         collect("perception::dpo", *dpo);
       }
+      /*
+       * Only controllers which select blocks/caches from their DPO store
+       * provide these.
+       */
+      const auto *memo = dynamic_cast<const metrics::perception::selection_memo_metrics*>(
+          controller);
+      if (nullptr != memo) {
+        collect("perception::selection_memo", *memo);
+      }
     }
 
   /**
@@ -251,6 +269,10 @@ class d1_metrics_aggregator : public d0::d0_metrics_aggregator,
 
   void register_with_arena_dims2D(const cmconfig::metrics_config* mconfig,
                                   const rmath::vector2z& dims);
+
+  /* clang-format off */
+  task_census m_census{};
+  /* clang-format on */
 };
 
 NS_END(d1, support, fordyca);
@@ -59,9 +59,11 @@ class robot_configurer {
 
   robot_configurer(const cvconfig::visualization_config* const config,
                    cforacle::foraging_oracle* const oracle,
+                   const ds::oracle_knowledge* const knowledge,
                    TAggregator* const agg)
       : mc_config(config),
         m_oracle(oracle),
+        mc_knowledge(knowledge),
         m_agg(agg) {}
 
   template<typename U = TController,
@@ -83,6 +85,7 @@ class robot_configurer {
 
  protected:
   void metric_callbacks_bind(controller_type* const c) const {
+    task_census::bind(c->executive()->graph());
     c->executive()->task_finish_notify(
         std::bind(&TAggregator::task_finish_or_abort_cb,
                   m_agg,
@@ -114,7 +117,7 @@ class robot_configurer {
       m_oracle->tasking()->listener_add(c->executive());
     }
     if (nullptr != m_oracle) {
-      auto receptor = std::make_unique<controller::cognitive::oracular_info_receptor>(m_oracle);
+      auto receptor = std::make_unique<controller::cognitive::oracular_info_receptor>(m_oracle, mc_knowledge);
       c->oracle_init(std::move(receptor));
     }
   } /* controller_config_oracle() */
@@ -123,6 +126,7 @@ class robot_configurer {
   /* clang-format off */
   const cvconfig::visualization_config* const mc_config;
   cforacle::foraging_oracle* const            m_oracle;
+  const ds::oracle_knowledge* const           mc_knowledge;
 
   TAggregator* const                          m_agg;
   /* clang-format on */
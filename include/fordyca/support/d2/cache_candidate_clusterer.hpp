@@ -0,0 +1,118 @@
+/**
+ * \file cache_candidate_clusterer.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_SUPPORT_D2_CACHE_CANDIDATE_CLUSTERER_HPP_
+#define INCLUDE_FORDYCA_SUPPORT_D2_CACHE_CANDIDATE_CLUSTERER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+#include "rcppsw/math/vector2.hpp"
+#include "rcppsw/types/spatial_dist.hpp"
+
+#include "cosm/ds/block3D_vector.hpp"
+
+#include "fordyca/fordyca.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, support, d2);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class cache_candidate_clusterer
+ * \ingroup support d2
+ *
+ * \brief Groups the blocks available for dynamic cache creation into candidate
+ * caches using DBSCAN, with the minimum distance between blocks as epsilon and
+ * the minimum # of blocks for a cache as the minimum # of points.
+ *
+ * Block centers are bucketed into a uniform grid with cells as large as
+ * epsilon, so the neighborhood of a block is found by looking only at the 3x3
+ * cells around it, giving O(n) expected time for reasonable block densities.
+ *
+ * Blocks which are not density-reachable from at least \c min_pts blocks are
+ * noise, and are not part of any group. Every group returned therefore
+ * contains at least \c min_pts blocks.
+ */
+class cache_candidate_clusterer : public rer::client<cache_candidate_clusterer> {
+ public:
+  cache_candidate_clusterer(const rtypes::spatial_dist& eps, uint min_pts);
+
+  /* Not copy constructible/assignable by default */
+  cache_candidate_clusterer(const cache_candidate_clusterer&) = delete;
+  cache_candidate_clusterer& operator=(const cache_candidate_clusterer&) = delete;
+
+  /**
+   * \brief Compute the candidate cache groups for the specified blocks.
+   *
+   * Groups are returned in the order in which their first block appears in
+   * \p c_blocks, so the result is deterministic for a given input.
+   */
+  std::vector<cds::block3D_vectorno> operator()(
+      const cds::block3D_vectorno& c_blocks) const;
+
+  /**
+   * \brief Compute the groups for the specified block centers.
+   *
+   * \return The indices into \p centers of the blocks in each group, ordered
+   * as for \ref operator()().
+   */
+  std::vector<std::vector<size_t>> groups_calc(
+      const std::vector<rmath::vector2d>& centers) const;
+
+ private:
+  using key_type = uint64_t;
+  using grid_type = std::unordered_map<key_type, std::vector<size_t>>;
+
+  static constexpr int kUNVISITED = -2;
+  static constexpr int kNOISE = -1;
+
+  key_type key(int i, int j) const {
+    return (static_cast<key_type>(static_cast<uint32_t>(i)) << 32) |
+           static_cast<uint32_t>(j);
+  }
+  int cell_coord(double v) const;
+
+  /**
+   * \brief Get the indices of all blocks within epsilon of the specified
+   * block, including the block itself.
+   */
+  std::vector<size_t> neighbors(const grid_type& grid,
+                                const std::vector<rmath::vector2d>& centers,
+                                size_t index) const;
+
+  /* clang-format off */
+  const rtypes::spatial_dist mc_eps;
+  const uint                 mc_min_pts;
+  /* clang-format on */
+};
+
+NS_END(d2, support, fordyca);
+
+#endif /* INCLUDE_FORDYCA_SUPPORT_D2_CACHE_CANDIDATE_CLUSTERER_HPP_ */
@@ -69,7 +69,7 @@ class cache_site_block_drop_interactor : public rer::client<cache_site_block_dro
         m_cache_manager(cache_manager),
         m_penalty_handler(envd->penalty_handler(
             tv::block_op_src::ekCACHE_SITE_DROP)),
-        m_prox_checker(map_in, m_cache_manager->cache_proximity_dist()) {}
+        m_prox_checker(map_in, m_cache_manager->cache_prox_index()) {}
 
   cache_site_block_drop_interactor(
       cache_site_block_drop_interactor&&) = default;
@@ -100,11 +100,10 @@ class cache_site_block_drop_interactor : public rer::client<cache_site_block_dro
         ER_ASSERT(post_process_check(controller), "Post-drop check failed");
       }
     } else {
-      auto prox_dist = boost::make_optional(m_cache_manager->cache_proximity_dist());
       auto penalty_status = m_penalty_handler->penalty_init(controller,
                                                     t,
                                                     tv::block_op_src::ekCACHE_SITE_DROP,
-                                                    prox_dist);
+                                                    m_cache_manager->cache_prox_index());
 
       /*
        * The checking is redundant here, because it was already done during
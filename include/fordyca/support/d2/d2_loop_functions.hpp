@@ -27,7 +27,8 @@
 #include <vector>
 #include <memory>
 
-#include "cosm/controller/operations/task_id_extract.hpp"
+#include "rcppsw/math/vector2.hpp"
+
 
 #include "fordyca/support/d1/d1_loop_functions.hpp"
 
@@ -87,14 +88,13 @@ class d2_loop_functions final : public d1::d1_loop_functions,
                               ccops::robot_los_update,
                               rds::grid2D_overlay<cds::cell2D>,
                               repr::forager_los>::type>;
-  using task_extractor_map_type = rds::type_map<
-    rmpl::typelist_wrap_apply<controller::d2::typelist,
-                              ccops::task_id_extract>::type>;
-
   using metric_extractor_map_type = rds::type_map<
     rmpl::typelist_wrap_apply<controller::d2::typelist,
                               ccops::metrics_extract,
                               d2_metrics_aggregator>::type>;
+  using intent_extractor_map_type = rds::type_map<
+    rmpl::typelist_wrap_apply<controller::d2::typelist,
+                              interaction_intent_extractor>::type>;
 
   /**
    * \brief These are friend classes because they are basically just pieces of
@@ -118,17 +118,26 @@ class d2_loop_functions final : public d1::d1_loop_functions,
    * result of a robot block drop. If \c FALSE, then consider dynamic cache
    * creation in other situations.
    *
+   * If triggered by drops and a local radius is configured, then only the
+   * neighborhoods of the drop locations are considered, unless a periodic
+   * global pass is due this timestep.
+   *
    * \return \c TRUE if one or more caches were created, \c FALSE otherwise.
    */
   bool cache_creation_handle(bool on_drop) RCPPSW_COLD;
 
   /**
-   * \brief Extract the numerical ID of the task each robot is currently
-   * executing for use in convergence calculations.
+   * \brief Determine if the periodic dynamic cache creation pass over the
+   * whole arena is due this timestep.
+   */
+  bool cache_creation_global_due(void) const;
+
+  /**
+   * \brief Get the ID of the task each robot is currently executing from the
+   * task census for use in convergence calculations.
    *
-   * Cannot use d1 version as the binary layout of the controllers is not
-   * guaranteed to be the same, AND the task mappers will throw key errors if
-   * you try it.
+   * Cannot use d1 version, as the census is maintained by the d2 metrics
+   * aggregator.
    *
    * \param uint Unused.
    */
@@ -139,26 +148,56 @@ class d2_loop_functions final : public d1::d1_loop_functions,
    *
    * - Set its new position, time, LOS from ARGoS.
    */
-  void robot_pre_step(chal::robot& robot);
+  void robot_pre_step(controller::foraging_controller* controller);
 
   /**
    * \brief Process a single robot on a timestep, after running its controller:
    *
-   * - Have  it interact with the environment.
+   * - Decide how it will interact with the environment this timestep
+   *   (including aborting its current task), if at all, and defer the
+   *   decision to the merge phase.
+   * - Otherwise, collect metrics from it.
+   *
+   * \note These operations are done in parallel for all robots (lock free).
+   */
+  void robot_post_step(controller::foraging_controller* controller);
+
+  /**
+   * \brief Process a single robot deferred during \ref robot_post_step():
+   *
+   * - Have it interact with the environment as it decided to (\p intent), if
+   *   that is still possible.
    * - Collect metrics from it.
+   *
+   * \note These operations are done serially, in robot ID order, so no locking
+   * is needed when recording the locations of drops which trigger dynamic cache
+   * creation.
    */
-  void robot_post_step(chal::robot& robot);
+  void robot_post_step_merge(controller::foraging_controller* controller,
+                             const interaction_intent& intent);
+
+  /**
+   * \brief Collect metrics from a robot, now that it has finished interacting
+   * with the environment and no more changes to its state will occur this
+   * timestep.
+   */
+  void robot_metrics_collect(controller::foraging_controller* controller);
 
   /* clang-format off */
-  std::mutex                                 m_dynamic_cache_mtx{};
-  bool                                       m_dynamic_cache_create{false};
+  /**
+   * \brief Locations of robot block drops which triggered dynamic cache
+   * creation this timestep (empty if not triggered).
+   */
+  std::vector<rmath::vector2d>               m_cache_drop_locs{};
 
   std::unique_ptr<d2_metrics_aggregator>     m_metrics_agg;
   std::unique_ptr<dynamic_cache_manager>     m_cache_manager;
   std::unique_ptr<interactor_map_type>       m_interactor_map;
   std::unique_ptr<metric_extractor_map_type> m_metric_extractor_map;
   std::unique_ptr<los_updater_map_type>      m_los_update_map;
-  std::unique_ptr<task_extractor_map_type>   m_task_extractor_map;
+  std::unique_ptr<intent_extractor_map_type> m_intent_map;
+  interaction_buffer                         m_interactions{};
+  robot_dispatch_table                       m_dispatch{};
   /* clang-format on */
 };
 
@@ -106,18 +106,6 @@ class dynamic_cache_creator : public base_cache_creator,
     cds::block3D_vectorno used{};
   };
 
-  /**
-   * \brief Calculate the blocks to be used in the creation of a single new
-   * cache.
-   *
-   * \param c_usable_blocks The total list of all blocks available for cache
-   *                        creation when the creator was called.
-   * \param anchor The current anchor block.
-   */
-  cds::block3D_vectorno cache_i_blocks_alloc(
-      const cds::block3D_vectorno& c_usable_blocks,
-      cds::block3D_vectorno::iterator anchor) const;
-
   /**
    * \brief Calculate the blocks a cache will absorb as a result of its center
    * beyond moved to deconflict with other caches/clusters/etc.
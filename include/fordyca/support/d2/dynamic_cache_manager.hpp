@@ -25,6 +25,7 @@
  * Includes
  ******************************************************************************/
 #include <algorithm>
+#include <vector>
 
 #include "rcppsw/math/rng.hpp"
 #include "rcppsw/er/client.hpp"
@@ -33,6 +34,7 @@
 #include "cosm/arena/ds/cache_vector.hpp"
 #include "cosm/foraging/ds/block_cluster_vector.hpp"
 
+#include "fordyca/ds/cache_prox_index.hpp"
 #include "fordyca/support/cache_create_ro_params.hpp"
 #include "fordyca/config/caches/caches_config.hpp"
 #include "fordyca/support/base_cache_manager.hpp"
@@ -74,6 +76,23 @@ class dynamic_cache_manager final : public base_cache_manager,
   boost::optional<cads::acache_vectoro> create(const cache_create_ro_params& c_params,
                                               const cds::block3D_vectorno&  c_all_blocks);
 
+  /**
+   * \brief Create caches in the arena as needed according to free block
+   * configurations near the specified locations (i.e. where robots dropped
+   * blocks this timestep), rather than across the whole arena.
+   *
+   * Only free blocks within the configured local radius (plus the cache
+   * dimension) of a location, and existing caches close enough to conflict
+   * with caches created from them, are considered. The blocks are found by
+   * querying the arena grid around each location, rather than filtering the
+   * set of all free blocks.
+   *
+   * \return The created caches (if any were created).
+   */
+  boost::optional<cads::acache_vectoro> create_local(
+      const cache_create_ro_params& c_params,
+      const std::vector<rmath::vector2d>& c_locs);
+
   /**
    * \brief Get the minimum distance that must be maintained between two caches
    * in order for them to discrete. Equal to the maximum of (twice the cache
@@ -84,6 +103,16 @@ class dynamic_cache_manager final : public base_cache_manager,
     return std::max(config()->dimension * 2, config()->dynamic.min_dist);
   }
 
+  /**
+   * \brief Get the index of cache locations used for checking if new caches
+   * would be too close to existing caches (bucketed by \ref
+   * cache_proximity_dist()).
+   *
+   * The index is invalidated here when caches are created, and rebuilt lazily
+   * by its users.
+   */
+  ds::cache_prox_index* cache_prox_index(void) { return &m_prox_index; }
+
  private:
   /*
    * \brief Filter blocks eligible to be considered for cache
@@ -118,9 +147,18 @@ class dynamic_cache_manager final : public base_cache_manager,
       const cads::acache_vectorno& existing_caches,
       const cfds::block3D_cluster_vectorro&);
 
+  /**
+   * \brief Get the blocks in the arena whose centers are within the specified
+   * distance of any of the specified locations, in ID order.
+   */
+  cds::block3D_vectorno local_blocks_query(
+      const std::vector<rmath::vector2d>& c_locs,
+      double radius) const;
+
   /* clang-format off */
   rmath::rng*                         m_rng;
   carena::caching_arena_map*          m_map;
+  ds::cache_prox_index                m_prox_index;
   /* clang-format on */
 };
 
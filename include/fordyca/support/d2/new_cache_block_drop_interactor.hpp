@@ -66,7 +66,7 @@ class new_cache_block_drop_interactor : public rer::client<new_cache_block_drop_
         m_cache_manager(cache_manager),
         m_penalty_handler(envd->penalty_handler(
             tv::block_op_src::ekNEW_CACHE_DROP)),
-        m_prox_checker(map_in, m_cache_manager->cache_proximity_dist()) {}
+        m_prox_checker(map_in, m_cache_manager->cache_prox_index()) {}
 
   new_cache_block_drop_interactor(
       new_cache_block_drop_interactor&&) = default;
@@ -94,11 +94,10 @@ class new_cache_block_drop_interactor : public rer::client<new_cache_block_drop_
         ER_ASSERT(post_process_check(controller), "Post-drop check failed");
       }
     } else {
-      auto prox_dist = boost::make_optional(m_cache_manager->cache_proximity_dist());
       auto penalty_status = m_penalty_handler->penalty_init(controller,
                                                             t,
                                                             tv::block_op_src::ekNEW_CACHE_DROP,
-                                                            prox_dist);
+                                                            m_cache_manager->cache_prox_index());
       /*
        * The checking is redundant here, because it was already done during
        * penalty_init(), but it doesn't hurt. What we DO need from
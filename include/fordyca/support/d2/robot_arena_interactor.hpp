@@ -30,6 +30,7 @@
 #include "fordyca/support/existing_cache_block_drop_interactor.hpp"
 #include "fordyca/support/free_block_pickup_interactor.hpp"
 #include "fordyca/support/nest_block_drop_interactor.hpp"
+#include "fordyca/support/interaction_intent.hpp"
 #include "fordyca/support/interactor_status.hpp"
 #include "fordyca/tasks/task_status.hpp"
 #include "fordyca/support/task_abort_interactor.hpp"
@@ -108,32 +109,46 @@ class robot_arena_interactor final : public rer::client<robot_arena_interactor<T
    * \brief The actual handling function for interactions.
    *
    * \param controller The controller to handle interactions for.
+   * \param intent The interaction the robot decided on this timestep.
    * \param t The current timestep.
    */
-  interactor_status operator()(TController& controller, const rtypes::timestep& t) {
-    if (m_task_abort(controller)) {
-      /*
-       * This needs to be here, rather than in each robot's control step
-       * function, in order to avoid triggering erroneous handling of an aborted
-       * task in the loop functions when the executive has not aborted the newly
-       * allocated task *after* the previous task was aborted. See
-       * FORDYCA#532,FORDYCA#587.
-       */
-      controller.task_status_update(tasks::task_status::ekRUNNING);
-      return interactor_status::ekTASK_ABORT;
-    }
-
-    auto status = interactor_status::ekNO_EVENT;
-    if (controller.is_carrying_block()) {
-      status |= m_nest_drop(controller, t);
-      m_existing_cache_drop(controller, t);
-      status |= m_cache_site_drop(controller, t);
-      status |= m_new_cache_drop(controller, t);
-    } else { /* The foot-bot has no block item */
-      status |= m_free_pickup(controller, t);
-      status |= m_cached_pickup(controller, t);
-    }
-    return status;
+  interactor_status operator()(TController& controller,
+                               const interaction_intent& intent,
+                               const rtypes::timestep& t) {
+    switch (intent.kind) {
+      case interaction_kind::ekTASK_ABORT:
+        if (m_task_abort(controller)) {
+          /*
+           * This needs to be here, rather than in each robot's control step
+           * function, in order to avoid triggering erroneous handling of an
+           * aborted task in the loop functions when the executive has not
+           * aborted the newly allocated task *after* the previous task was
+           * aborted. See FORDYCA#532,FORDYCA#587.
+           */
+          controller.task_status_update(tasks::task_status::ekRUNNING);
+          return interactor_status::ekTASK_ABORT;
+        }
+        return interactor_status::ekNO_EVENT;
+      case interaction_kind::ekNEST_DROP:
+        return m_nest_drop(controller, t);
+      case interaction_kind::ekCACHE_DROP:
+        /*
+         * Dropping a block in a cache does not require oracular updates, so no
+         * need to track its status.
+         */
+        m_existing_cache_drop(controller, t);
+        return interactor_status::ekNO_EVENT;
+      case interaction_kind::ekCACHE_SITE_DROP:
+        return m_cache_site_drop(controller, t);
+      case interaction_kind::ekNEW_CACHE_DROP:
+        return m_new_cache_drop(controller, t);
+      case interaction_kind::ekFREE_PICKUP:
+        return m_free_pickup(controller, t);
+      case interaction_kind::ekCACHE_PICKUP:
+        return m_cached_pickup(controller, t);
+      default:
+        return interactor_status::ekNO_EVENT;
+    } /* switch() */
   }
 
 
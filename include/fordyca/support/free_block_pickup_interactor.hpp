@@ -84,7 +84,7 @@ class free_block_pickup_interactor final :
     return handler->penalty_init(controller,
                                  t,
                                  tv::block_op_src::ekFREE_PICKUP,
-                                 boost::none);
+                                 nullptr);
   }
 
   void robot_post_penalty_init_hook(TController& controller,
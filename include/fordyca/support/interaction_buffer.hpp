@@ -0,0 +1,146 @@
+/**
+ * \file interaction_buffer.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_SUPPORT_INTERACTION_BUFFER_HPP_
+#define INCLUDE_FORDYCA_SUPPORT_INTERACTION_BUFFER_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+#include "rcppsw/types/type_uuid.hpp"
+
+#include "fordyca/controller/controller_fwd.hpp"
+#include "fordyca/support/interaction_intent.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, support);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class interaction_buffer
+ * \ingroup support
+ *
+ * \brief Command buffer for robot arena interactions, used to split the loop
+ * function post-step into two phases:
+ *
+ * 1. A parallel phase, in which each robot decides from read-only state how it
+ *    will interact with the arena this timestep (\ref interaction_intent), and
+ *    if it will, the decision is deferred into the buffer of the thread
+ *    processing it. Each thread appends to its own buffer, so there is no
+ *    contention between threads; a lock is only taken the first time a thread
+ *    defers a robot, to create its buffer.
+ *
+ * 2. A serial merge phase, in which the per-thread buffers are gathered and
+ *    deferred decisions are validated against the current arena state and
+ *    applied in ascending robot ID order. Conflicts (two robots trying to pick
+ *    up the same block, etc.) are resolved in favor of the lower ID, which
+ *    makes results independent of the # of ARGoS threads and the order in
+ *    which they ran.
+ */
+class interaction_buffer : public rer::client<interaction_buffer> {
+ public:
+  interaction_buffer(void);
+
+  /* Not copy constructible/assignable by default */
+  interaction_buffer(const interaction_buffer&) = delete;
+  interaction_buffer& operator=(const interaction_buffer&) = delete;
+
+  /**
+   * \brief Prepare the buffer for a new timestep. Must be called before the
+   * parallel phase, and NOT from within it.
+   *
+   * \param n_robots The current swarm size (the max # of robots which can be
+   *                 deferred).
+   */
+  void reset(size_t n_robots);
+
+  /**
+   * \brief Defer applying the interaction the specified robot decided on until
+   * the merge phase. Safe to call concurrently from multiple threads.
+   */
+  void defer(controller::foraging_controller* c,
+             const interaction_intent& intent);
+
+  /**
+   * \brief Apply the specified callback to all deferred robots and their
+   * decisions, in ascending order of robot ID, and then empty the buffer. Not
+   * thread safe.
+   */
+  template <typename TCallback>
+  void merge(const TCallback& cb) {
+    gather();
+    for (auto& e : m_merged) {
+      cb(e.controller, e.intent);
+    } /* for(&e..) */
+    m_merged.clear();
+  }
+
+ private:
+  struct entry {
+    rtypes::type_uuid                 id{rtypes::constants::kNoUUID};
+    controller::foraging_controller* controller{nullptr};
+    interaction_intent               intent{};
+  };
+
+  using thread_buffer = std::vector<entry>;
+
+  /**
+   * \brief Get the buffer of the calling thread, creating it if needed.
+   */
+  thread_buffer* local(void);
+
+  /**
+   * \brief Move the contents of all per-thread buffers into \ref m_merged, in
+   * ascending order of robot ID. Not thread safe.
+   */
+  void gather(void);
+
+  /**
+   * \brief Source of the IDs which threads use to tell which instance the
+   * buffer they have cached belongs to.
+   */
+  static std::atomic_uint ms_instances;
+
+  /* clang-format off */
+  const uint                mc_instance;
+  std::mutex                m_mtx{};
+
+  /**
+   * \brief One buffer per thread which has deferred a robot. A deque, so that
+   * adding a buffer does not move the others while threads append to them.
+   */
+  std::deque<thread_buffer> m_buffers{};
+  std::vector<entry>        m_merged{};
+  /* clang-format on */
+};
+
+NS_END(support, fordyca);
+
+#endif /* INCLUDE_FORDYCA_SUPPORT_INTERACTION_BUFFER_HPP_ */
@@ -0,0 +1,80 @@
+/**
+ * \file interaction_intent.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_SUPPORT_INTERACTION_INTENT_HPP_
+#define INCLUDE_FORDYCA_SUPPORT_INTERACTION_INTENT_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "rcppsw/common/common.hpp"
+#include "rcppsw/types/type_uuid.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, support);
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+/**
+ * \brief The arena interaction a robot will attempt this timestep, which
+ * determines which interactor it is dispatched to during the merge phase.
+ */
+enum class interaction_kind {
+  /**
+   * \brief The robot will not interact with the arena this timestep.
+   */
+  ekNONE,
+  ekTASK_ABORT,
+  ekNEST_DROP,
+  ekFREE_PICKUP,
+  ekCACHE_PICKUP,
+  ekCACHE_DROP,
+  ekCACHE_SITE_DROP,
+  ekNEW_CACHE_DROP
+};
+
+/**
+ * \struct interaction_intent
+ * \ingroup support
+ *
+ * \brief The decision a robot made during the parallel phase of the post-step
+ * about how it will interact with the arena, together with the entity it
+ * targeted, as seen at that time:
+ *
+ * - Free block pickup: the block the robot is on.
+ * - Cached block pickup/drop: the cache the robot is in.
+ * - Nest/cache site/new cache drop, task abort: the block the robot is
+ *   carrying.
+ *
+ * The target is \ref rtypes::constants::kNoUUID if there was none, in which
+ * case the interactor handles it as it normally would (e.g. by sending a block
+ * vanished event).
+ */
+struct interaction_intent {
+  interaction_kind  kind{interaction_kind::ekNONE};
+  rtypes::type_uuid target{rtypes::constants::kNoUUID};
+};
+
+NS_END(support, fordyca);
+
+#endif /* INCLUDE_FORDYCA_SUPPORT_INTERACTION_INTENT_HPP_ */
@@ -0,0 +1,140 @@
+/**
+ * \file interaction_intent_extractor.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_SUPPORT_INTERACTION_INTENT_EXTRACTOR_HPP_
+#define INCLUDE_FORDYCA_SUPPORT_INTERACTION_INTENT_EXTRACTOR_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <type_traits>
+#include <boost/variant/static_visitor.hpp>
+
+#include "rcppsw/common/common.hpp"
+
+#include "cosm/arena/caching_arena_map.hpp"
+#include "cosm/repr/base_block3D.hpp"
+
+#include "fordyca/controller/cognitive/d1/bitd_dpo_controller.hpp"
+#include "fordyca/fsm/foraging_acq_goal.hpp"
+#include "fordyca/fsm/foraging_transport_goal.hpp"
+#include "fordyca/support/interaction_intent.hpp"
+#include "fordyca/tasks/task_status.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, support);
+
+/*******************************************************************************
+ * Struct Definitions
+ ******************************************************************************/
+/**
+ * \struct interaction_intent_extractor
+ * \ingroup support
+ *
+ * rief Determine, from read-only controller and arena state, how a robot
+ * will interact with the arena this timestep (block pickup/drop, cache
+ * pickup/drop, task abort), and which block/cache it targets.
+ *
+ * All arena interactors only do something if the robot has acquired its goal
+ * (and is therefore either waiting to start serving a penalty or is serving
+ * one), or has a pending task abort, so robots for which this returns ef
+ * interaction_kind::ekNONE can skip the interaction phase entirely.
+ *
+ * Run during the parallel phase of the post-step, in which nothing modifies
+ * the arena map, so no arena map locks are needed.
+ */
+template <class TController>
+struct interaction_intent_extractor
+    : public boost::static_visitor<interaction_intent> {
+  using controller_type = TController;
+
+  explicit interaction_intent_extractor(const carena::caching_arena_map* map)
+      : mc_map(map) {}
+
+  interaction_intent operator()(const TController* const c) const {
+    if (task_abort_pending(c)) {
+      return { interaction_kind::ekTASK_ABORT, carried(c) };
+    }
+    if (!c->goal_acquired()) {
+      return {};
+    }
+    if (c->is_carrying_block()) {
+      switch (c->block_transport_goal()) {
+        case fsm::foraging_transport_goal::ekNEST:
+          return { interaction_kind::ekNEST_DROP, carried(c) };
+        case fsm::foraging_transport_goal::ekEXISTING_CACHE:
+          return { interaction_kind::ekCACHE_DROP,
+                   mc_map->robot_on_cache(c->rpos2D()) };
+        case fsm::foraging_transport_goal::ekCACHE_SITE:
+          return { interaction_kind::ekCACHE_SITE_DROP, carried(c) };
+        case fsm::foraging_transport_goal::ekNEW_CACHE:
+          return { interaction_kind::ekNEW_CACHE_DROP, carried(c) };
+        default:
+          return {};
+      } /* switch() */
+    }
+    if (fsm::foraging_acq_goal::ekBLOCK == c->acquisition_goal()) {
+      return { interaction_kind::ekFREE_PICKUP,
+               mc_map->robot_on_block(c->rpos2D(), c->entity_acquired_id()) };
+    } else if (fsm::foraging_acq_goal::ekEXISTING_CACHE ==
+               c->acquisition_goal()) {
+      return { interaction_kind::ekCACHE_PICKUP,
+               mc_map->robot_on_cache(c->rpos2D()) };
+    }
+    return {};
+  }
+
+ private:
+  static rtypes::type_uuid carried(const TController* const c) {
+    return c->is_carrying_block() ? c->block()->id()
+                                  : rtypes::constants::kNoUUID;
+  }
+
+  /*
+   * If the controller is not derived from BITD-DPO, then it cannot abort
+   * tasks.
+   */
+  template <typename U = TController,
+            RCPPSW_SFINAE_DECLDEF(
+                !std::is_base_of<controller::cognitive::d1::bitd_dpo_controller,
+                                 U>::value)>
+  bool task_abort_pending(const U* const) const {
+    return false;
+  }
+
+  template <typename U = TController,
+            RCPPSW_SFINAE_DECLDEF(
+                std::is_base_of<controller::cognitive::d1::bitd_dpo_controller,
+                                U>::value)>
+  bool task_abort_pending(const U* const c) const {
+    return nullptr != c->current_task() &&
+           tasks::task_status::ekABORT_PENDING == c->task_status();
+  }
+
+  /* clang-format off */
+  const carena::caching_arena_map* mc_map;
+  /* clang-format on */
+};
+
+NS_END(support, fordyca);
+
+#endif /* INCLUDE_FORDYCA_SUPPORT_INTERACTION_INTENT_EXTRACTOR_HPP_ */
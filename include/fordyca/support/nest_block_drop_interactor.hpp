@@ -84,7 +84,7 @@ class nest_block_drop_interactor final
                           const rtypes::timestep& t,
                           penalty_handler_type* handler) override {
     handler->penalty_init(
-        controller, t, tv::block_op_src::ekNEST_DROP, boost::none);
+        controller, t, tv::block_op_src::ekNEST_DROP, nullptr);
   }
 
   bool robot_goal_acquired(const TController& controller) const override {
@@ -0,0 +1,149 @@
+/**
+ * \file robot_dispatch_table.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_SUPPORT_ROBOT_DISPATCH_TABLE_HPP_
+#define INCLUDE_FORDYCA_SUPPORT_ROBOT_DISPATCH_TABLE_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <functional>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+#include "rcppsw/types/timestep.hpp"
+
+#include "cosm/pal/argos_swarm_iterator.hpp"
+#include "cosm/pal/pal.hpp"
+
+#include "fordyca/controller/foraging_controller.hpp"
+#include "fordyca/support/interaction_intent.hpp"
+#include "fordyca/support/interactor_status.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, support);
+
+/*******************************************************************************
+ * Struct Definitions
+ ******************************************************************************/
+/**
+ * \struct robot_dispatch_slot
+ * \ingroup support
+ *
+ * \brief The per-timestep operations the loop functions perform on a robot,
+ * bound to the typed functors for its controller type. Each operation takes
+ * the controller as its base class and casts it to the bound type without
+ * RTTI.
+ */
+struct robot_dispatch_slot {
+  /* clang-format off */
+  std::function<void(controller::foraging_controller*)>       los_update{};
+  std::function<interaction_intent(
+      const controller::foraging_controller*)>                intent{};
+  std::function<interactor_status(controller::foraging_controller*,
+                                  const interaction_intent&,
+                                  const rtypes::timestep&)>   interact{};
+  std::function<void(controller::foraging_controller*)>       metrics_extract{};
+  /* clang-format on */
+};
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class robot_dispatch_table
+ * \ingroup support
+ *
+ * \brief Maps each robot directly to the \ref robot_dispatch_slot for its
+ * controller type, so that processing a robot each timestep does not require
+ * looking up its controller type in the typeid -> boost::variant functor maps
+ * and visiting the variant for every operation.
+ *
+ * Slots are registered per controller type during initialization, and robots
+ * are resolved to slots (indexed by robot ID) by \ref resolve(). Robots which
+ * have not been resolved (e.g. added by population dynamics this timestep) are
+ * still dispatched correctly, via a slower lookup by controller type.
+ */
+class robot_dispatch_table : public rer::client<robot_dispatch_table> {
+ public:
+  robot_dispatch_table(void)
+      : ER_CLIENT_INIT("fordyca.support.robot_dispatch_table") {}
+
+  /* Not copy constructible/assignable by default */
+  robot_dispatch_table(const robot_dispatch_table&) = delete;
+  robot_dispatch_table& operator=(const robot_dispatch_table&) = delete;
+
+  /**
+   * \brief Register the slot for the specified controller type. Must be called
+   * for all controller types before \ref resolve().
+   */
+  void type_register(const std::type_index& type, robot_dispatch_slot slot);
+
+  /**
+   * \brief Resolve all robots in the swarm to the slots for their controller
+   * types. Not thread safe.
+   */
+  template <typename TSwarmManager>
+  void resolve(const TSwarmManager* sm) {
+    m_robots.clear();
+    m_n_resolved = 0;
+    auto cb = [&](auto* c) { robot_resolve(c); };
+    cpal::argos_swarm_iterator::controllers<controller::foraging_controller,
+                                            cpal::iteration_order::ekSTATIC>(
+        sm, cb, cpal::kARGoSRobotType);
+  }
+
+  /**
+   * \brief Get the # of robots resolved to slots during the last call to \ref
+   * resolve(), for determining if the swarm has changed.
+   */
+  size_t n_resolved(void) const { return m_n_resolved; }
+
+  /**
+   * \brief Get the slot for the specified robot. Safe to call concurrently.
+   */
+  const robot_dispatch_slot& operator[](
+      const controller::foraging_controller* c) const {
+    auto id = static_cast<size_t>(c->entity_id().v());
+    if (id < m_robots.size() && nullptr != m_robots[id]) {
+      return *m_robots[id];
+    }
+    return type_slot(c);
+  }
+
+ private:
+  void robot_resolve(const controller::foraging_controller* c);
+  const robot_dispatch_slot& type_slot(
+      const controller::foraging_controller* c) const;
+
+  /* clang-format off */
+  size_t                                                   m_n_resolved{0};
+  std::vector<const robot_dispatch_slot*>                  m_robots{};
+  std::unordered_map<std::type_index, robot_dispatch_slot> m_types{};
+  /* clang-format on */
+};
+
+NS_END(support, fordyca);
+
+#endif /* INCLUDE_FORDYCA_SUPPORT_ROBOT_DISPATCH_TABLE_HPP_ */
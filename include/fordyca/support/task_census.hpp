@@ -0,0 +1,158 @@
+/**
+ * \file task_census.hpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+#ifndef INCLUDE_FORDYCA_SUPPORT_TASK_CENSUS_HPP_
+#define INCLUDE_FORDYCA_SUPPORT_TASK_CENSUS_HPP_
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <array>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "rcppsw/er/client.hpp"
+
+#include "cosm/pal/argos_swarm_iterator.hpp"
+#include "cosm/pal/pal.hpp"
+#include "cosm/ta/ds/bi_tdgraph.hpp"
+#include "cosm/ta/polled_task.hpp"
+
+#include "fordyca/controller/cognitive/d1/bitd_dpo_controller.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, support);
+
+/*******************************************************************************
+ * Class Definitions
+ ******************************************************************************/
+/**
+ * \class task_census
+ * \ingroup support
+ *
+ * \brief Swarm-wide count of the # of robots executing each task, maintained
+ * incrementally from the executive task start/finish/abort callbacks rather
+ * than by walking the swarm every timestep.
+ *
+ * Callbacks are invoked from within robot control steps, which ARGoS runs in
+ * parallel, so updates are lock free. The census ID of each task is resolved
+ * once via \ref bind() and stored on the task, so callbacks do not need to look
+ * tasks up by name. Robots added/removed by population
+ * dynamics do not generate callbacks, so the census must be re-seeded from the
+ * swarm via \ref seed() whenever the swarm changes.
+ */
+class task_census : public rer::client<task_census> {
+ public:
+  /**
+   * \brief The names of all tasks tracked, across all task decomposition graph
+   * depths. The index of a task in this list is its ID within the census.
+   */
+  static constexpr size_t kTaskCount = 7;
+  static const std::array<std::string, kTaskCount> kTaskNames;
+
+  task_census(void) : ER_CLIENT_INIT("fordyca.support.task_census") {}
+
+  /* Not copy constructible/assignable by default */
+  task_census(const task_census&) = delete;
+  task_census& operator=(const task_census&) = delete;
+
+  /**
+   * \brief Resolve the census ID of each task in a robot's task decomposition
+   * graph, and store it on the task. Must be called before the robot's task
+   * callbacks can be routed to the census.
+   */
+  static void bind(cta::ds::bi_tdgraph* graph);
+
+  /**
+   * \brief Record a robot starting the specified task, which must have been
+   * bound via \ref bind(). Safe to call concurrently.
+   */
+  void task_start(const cta::polled_task* task);
+
+  /**
+   * \brief Record a robot finishing or aborting the specified task, which must
+   * have been bound via \ref bind(). Safe to call concurrently.
+   */
+  void task_finish_or_abort(const cta::polled_task* task);
+
+  /**
+   * \brief Reset the census, and then count the task each robot in the swarm
+   * is currently executing. Not thread safe.
+   *
+   * Tasks are looked up by name, as robots added by population dynamics may
+   * not have been bound.
+   */
+  template <typename TSwarmManager>
+  void seed(const TSwarmManager* sm) {
+    reset();
+    auto cb = [&](auto* c) {
+      const auto* bitd =
+          dynamic_cast<const controller::cognitive::d1::bitd_dpo_controller*>(c);
+      if (nullptr == bitd) {
+        return;
+      }
+      const auto* task =
+          dynamic_cast<const cta::polled_task*>(bitd->current_task());
+      int index = (nullptr != task) ? task_index(task->name()) : -1;
+      if (-1 != index) {
+        ++m_counts[index];
+      }
+    };
+    cpal::argos_swarm_iterator::controllers<controller::foraging_controller,
+                                            cpal::iteration_order::ekSTATIC>(
+        sm, cb, cpal::kARGoSRobotType);
+  }
+
+  /**
+   * \brief Get the # of robots currently executing the task with the specified
+   * name.
+   */
+  size_t count(const std::string& name) const;
+
+  size_t n_harvesters(void) const;
+  size_t n_collectors(void) const;
+
+  /**
+   * \brief Get the distribution of tasks across the swarm, for use in task
+   * distribution entropy calculations: the census ID of the task each robot
+   * is executing, or -1 for robots not executing a task.
+   *
+   * \param n_robots The current swarm size.
+   */
+  std::vector<int> distribution(size_t n_robots) const;
+
+ private:
+  static int task_index(const std::string& name);
+  static int bound_index(const cta::polled_task* task);
+
+  void reset(void);
+  size_t count(int index) const;
+
+  /* clang-format off */
+  std::array<std::atomic_int, kTaskCount> m_counts{};
+  /* clang-format on */
+};
+
+NS_END(support, fordyca);
+
+#endif /* INCLUDE_FORDYCA_SUPPORT_TASK_CENSUS_HPP_ */
@@ -75,7 +75,7 @@ class block_op_filter : public rer::client<block_op_filter> {
    */
   op_filter_result operator()(const controller::foraging_controller& controller,
                               block_op_src src,
-                              boost::optional<rtypes::spatial_dist> cache_prox) {
+                              ds::cache_prox_index* cache_prox) {
     /*
      * If the robot has not acquired a block, or thinks it has but actually has
      * not, nothing to do. If a robot is carrying a block but is still
@@ -87,13 +87,13 @@ class block_op_filter : public rer::client<block_op_filter> {
       case block_op_src::ekNEST_DROP:
         return nest_drop_filter(controller);
       case block_op_src::ekCACHE_SITE_DROP:
-        ER_ASSERT(cache_prox && *cache_prox > 0.0,
-                  "Cache proximity distance not specified for cache site drop");
-        return cache_site_drop_filter(controller, *cache_prox);
+        ER_ASSERT(nullptr != cache_prox,
+                  "Cache proximity index not specified for cache site drop");
+        return cache_site_drop_filter(controller, cache_prox);
       case block_op_src::ekNEW_CACHE_DROP:
-        ER_ASSERT(cache_prox && *cache_prox > 0.0,
-                  "Cache proximity distance not specified for new cache drop");
-        return new_cache_drop_filter(controller, *cache_prox);
+        ER_ASSERT(nullptr != cache_prox,
+                  "Cache proximity index not specified for new cache drop");
+        return new_cache_drop_filter(controller, cache_prox);
       default:
         ER_FATAL_SENTINEL("Unhandled penalty type %d", static_cast<int>(src));
     } /* switch() */
@@ -156,7 +156,7 @@ class block_op_filter : public rer::client<block_op_filter> {
    * block/cache is too close.
    */
   op_filter_result cache_site_drop_filter(const controller::foraging_controller& controller,
-                                          const rtypes::spatial_dist& cache_prox) const {
+                                          ds::cache_prox_index* cache_prox) const {
     op_filter_result result;
     if (!(controller.goal_acquired() &&
           fsm::foraging_acq_goal::ekCACHE_SITE == controller.acquisition_goal() &&
@@ -183,7 +183,7 @@ class block_op_filter : public rer::client<block_op_filter> {
    * is too close to another cache to do a free block drop at the chosen site.
    */
   op_filter_result new_cache_drop_filter(const controller::foraging_controller& controller,
-                                         const rtypes::spatial_dist& cache_prox) const {
+                                         ds::cache_prox_index* cache_prox) const {
     op_filter_result result;
     if (!(controller.goal_acquired() &&
           fsm::foraging_acq_goal::ekNEW_CACHE == controller.acquisition_goal() &&
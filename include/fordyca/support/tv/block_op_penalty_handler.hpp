@@ -80,13 +80,14 @@ class block_op_penalty_handler final : public ctv::temporal_penalty_handler,
    * \param src The penalty source (i.e. what event caused this penalty to be
    *            applied).
    * \param t The current timestep.
-   * \param prox_dist The minimum distance that the cache site needs to be from
-   *                  all caches in the arena.
+   * \param cache_prox Index of the caches in the arena, used to check that a
+   *                   cache site/new cache is far enough away from all of
+   *                   them. NULL for operations not involving caches.
    */
   op_filter_status penalty_init(const controller::foraging_controller& controller,
                                 const rtypes::timestep& t,
                                 block_op_src src,
-                                const boost::optional<rtypes::spatial_dist>& cache_prox) {
+                                ds::cache_prox_index* cache_prox) {
     /*
      * Check if we have satisfied the conditions for a block operation, which
      * involves querying the area map.
@@ -36,6 +36,9 @@ class foraging_controller;
 namespace cosm::arena {
 class caching_arena_map;
 } /* namespace cosm::arena */
+namespace fordyca::ds {
+class arena_snapshot_pool;
+} /* namespace fordyca::ds */
 
 NS_START(fordyca, support, tv);
 
@@ -57,6 +60,7 @@ class fordyca_pd_adaptor final : rer::client<fordyca_pd_adaptor>,
                      cpal::argos_sm_adaptor* sm,
                      env_dynamics_type *envd,
                      carena::caching_arena_map* map,
+                     ds::arena_snapshot_pool* snapshots,
                      rmath::rng* rng);
 
   /* Not copy constructable/assignable by default */
@@ -66,9 +70,18 @@ class fordyca_pd_adaptor final : rer::client<fordyca_pd_adaptor>,
   /* ARGoS PD apdaptor overrides */
   void pre_kill_cleanup(cpal::argos_controller2D_adaptor* controller) override;
 
+  /**
+   * \brief The total # of robots killed so far. Robots can be killed and others
+   * added in the same timestep without the swarm size changing, so this is
+   * needed to detect all changes to the swarm.
+   */
+  size_t n_killed(void) const { return m_n_killed; }
+
  private:
   /* clang-format off */
   carena::caching_arena_map* m_map;
+  ds::arena_snapshot_pool*   m_snapshots;
+  size_t                     m_n_killed{0};
   /* clang-format on */
 };
 
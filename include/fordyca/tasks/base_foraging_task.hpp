@@ -57,6 +57,19 @@ class base_foraging_task
  public:
   base_foraging_task(void) = default;
   ~base_foraging_task(void) override = default;
+
+  /**
+   * \brief The ID of the task within the \ref support::task_census, resolved
+   * once when the census is bound to the robot's executive, or -1 if it has
+   * not been bound.
+   */
+  int census_index(void) const { return m_census_index; }
+  void census_index(int index) { m_census_index = index; }
+
+ private:
+  /* clang-format off */
+  int m_census_index{-1};
+  /* clang-format on */
 };
 
 NS_END(tasks, fordyca);
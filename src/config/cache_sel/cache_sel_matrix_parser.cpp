@@ -51,6 +51,7 @@ void cache_sel_matrix_parser::parse(const ticpp::Element& node) {
   XML_PARSE_ATTR(cnode, m_config, site_yrange);
   XML_PARSE_ATTR_DFLT(cnode, m_config, strict_constraints, true);
   XML_PARSE_ATTR(cnode, m_config, new_cache_tol);
+  XML_PARSE_ATTR_DFLT(cnode, m_config, site_solver, std::string("nlopt"));
 } /* parse() */
 
 bool cache_sel_matrix_parser::validate(void) const {
@@ -62,6 +63,8 @@ bool cache_sel_matrix_parser::validate(void) const {
   RCPPSW_CHECK(m_config->block_prox_dist > 0.0);
   RCPPSW_CHECK(m_config->nest_prox_dist > 0.0);
   RCPPSW_CHECK(m_config->new_cache_tol > 0.0);
+  RCPPSW_CHECK("grid" == m_config->site_solver ||
+               "nlopt" == m_config->site_solver);
   return true;
 
 error:
@@ -46,6 +46,8 @@ void dynamic_cache_parser::parse(const ticpp::Element& node) {
     XML_PARSE_ATTR(cnode, m_config, min_dist);
     XML_PARSE_ATTR(cnode, m_config, min_blocks);
     XML_PARSE_ATTR(cnode, m_config, robot_drop_only);
+    XML_PARSE_ATTR_DFLT(cnode, m_config, local_radius, rtypes::spatial_dist(0.0));
+    XML_PARSE_ATTR_DFLT(cnode, m_config, global_interval, 0U);
   }
 } /* parse() */
 
@@ -55,6 +57,7 @@ bool dynamic_cache_parser::validate(void) const {
   }
   RCPPSW_CHECK(m_config->min_dist > 0);
   RCPPSW_CHECK(m_config->min_blocks > 0);
+  RCPPSW_CHECK(m_config->local_radius.v() >= 0.0);
   return true;
 
 error:
@@ -26,6 +26,7 @@
 #include "cosm/subsystem/perception/config/xml/perception_parser.hpp"
 
 #include "fordyca/config/block_sel/block_sel_matrix_parser.hpp"
+#include "fordyca/config/perception/dpo_store_parser.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -41,6 +42,8 @@ dpo_controller_repository::dpo_controller_repository(void) {
       block_sel::block_sel_matrix_parser::kXMLRoot);
   parser_register<cspconfig::xml::perception_parser, cspconfig::perception_config>(
       cspconfig::xml::perception_parser::kXMLRoot);
+  parser_register<perception::dpo_store_parser, perception::dpo_store_config>(
+      perception::dpo_store_parser::kXMLRoot);
 }
 
 NS_END(d0, config, fordyca);
@@ -0,0 +1,46 @@
+/**
+ * \file dpo_store_parser.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/config/perception/dpo_store_parser.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, config, perception);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void dpo_store_parser::parse(const ticpp::Element& node) {
+  /* tag is optional */
+  if (nullptr == node.FirstChild(kXMLRoot, false)) {
+    return;
+  }
+  ticpp::Element snode = node_get(node, kXMLRoot);
+  m_config = std::make_unique<config_type>();
+
+  XML_PARSE_ATTR_DFLT(snode, m_config, max_blocks, 0UL);
+  XML_PARSE_ATTR_DFLT(snode, m_config, max_caches, 0UL);
+} /* parse() */
+
+NS_END(perception, config, fordyca);
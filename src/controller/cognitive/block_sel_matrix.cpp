@@ -35,25 +35,21 @@ NS_START(fordyca, controller, cognitive);
  ******************************************************************************/
 block_sel_matrix::block_sel_matrix(
     const config::block_sel::block_sel_matrix_config* config,
-    const rmath::vector2d& nest_loc) {
-  this->insert(std::make_pair(kNestLoc, nest_loc));
-  this->insert(std::make_pair(kCubePriority, config->priorities.cube));
-  this->insert(std::make_pair(kRampPriority, config->priorities.ramp));
-  this->insert(std::make_pair(kSelExceptions, std::vector<rtypes::type_uuid>()));
-  this->insert(std::make_pair(kPickupPolicy, config->pickup_policy));
-}
+    const rmath::vector2d& nest_loc)
+    : mc_nest_loc(nest_loc),
+      mc_cube_priority(config->priorities.cube),
+      mc_ramp_priority(config->priorities.ramp),
+      mc_pickup_policy(config->pickup_policy) {}
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
 void block_sel_matrix::sel_exception_add(const rtypes::type_uuid& id) {
-  boost::get<std::vector<rtypes::type_uuid>>(this->find(kSelExceptions)->second)
-      .push_back(id);
+  m_sel_exceptions.add(id);
 } /* sel_exception_add() */
 
 void block_sel_matrix::sel_exceptions_clear(void) {
-  boost::get<std::vector<rtypes::type_uuid>>(this->operator[](kSelExceptions))
-      .clear();
+  m_sel_exceptions.clear();
 } /* sel_exceptions_clear() */
 
 NS_END(cognitive, controller, fordyca);
@@ -25,13 +25,12 @@
 
 #include "cosm/repr/base_block3D.hpp"
 
-#include "fordyca/math/block_utility.hpp"
+#include "fordyca/math/block_utility_batch.hpp"
 
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca, controller, cognitive);
-using bselm = block_sel_matrix;
 
 /*******************************************************************************
  * Constructors/Destructor
@@ -46,12 +45,23 @@ block_selector::block_selector(const block_sel_matrix* const sel_matrix)
 const crepr::base_block3D*
 block_selector::operator()(const ds::dp_block_map& blocks,
                            const rmath::vector2d& position) {
-  double max_utility = 0.0;
-  const crepr::base_block3D* best = nullptr;
-
   ER_ASSERT(!blocks.empty(), "No known perceived blocks");
+
+  /*
+   * Look everything up in the selection matrix once, rather than once per
+   * block.
+   */
+  double cube_priority = mc_matrix->cube_priority();
+  double ramp_priority = mc_matrix->ramp_priority();
+  const auto& nest_loc = mc_matrix->nest_loc();
+  const auto& exceptions = mc_matrix->sel_exceptions();
+
+  math::block_utility_batch batch(nest_loc, blocks.size());
+  std::vector<const ds::dp_block_map::value_type*> candidates;
+  candidates.reserve(blocks.size());
+
   for (const auto& b : blocks.const_values_range()) {
-    if (block_is_excluded(position, b.ent())) {
+    if (block_is_excluded(position, b.ent(), exceptions)) {
       continue;
     }
 
@@ -59,34 +69,36 @@ block_selector::operator()(const ds::dp_block_map& blocks,
      * Only two options for right now: cube blocks or ramp blocks. This will
      * undoubtedly have to change in the future.
      */
-    double priority =
-        (crepr::block_type::ekCUBE == b.ent()->md()->type())
-            ? boost::get<double>(mc_matrix->find(bselm::kCubePriority)->second)
-            : boost::get<double>(mc_matrix->find(bselm::kRampPriority)->second);
-    rmath::vector2d nest_loc =
-        boost::get<rmath::vector2d>(mc_matrix->find(bselm::kNestLoc)->second);
+    double priority = (crepr::block_type::ekCUBE == b.ent()->md()->type())
+                          ? cube_priority
+                          : ramp_priority;
+    batch.add(b.ent()->ranchor2D(), b.density(), priority);
+    candidates.push_back(&b);
+  } /* for(block..) */
 
-    double utility = math::block_utility(b.ent()->ranchor2D(), nest_loc)(
-        position, b.density(), priority);
+  auto res = batch.calc(position);
+  m_decay_floor = batch.decay_floor(res);
 
+  for (size_t i = 0; i < candidates.size(); ++i) {
     ER_DEBUG("Utility for block%d@%s/%s, density=%f: %f",
-             b.ent()->id().v(),
-             rcppsw::to_string(b.ent()->ranchor2D()).c_str(),
-             rcppsw::to_string(b.ent()->danchor2D()).c_str(),
-             b.density().v(),
-             utility);
-    if (utility > max_utility) {
-      best = b.ent();
-      max_utility = utility;
-    }
-  } /* for(block..) */
+             candidates[i]->ent()->id().v(),
+             rcppsw::to_string(candidates[i]->ent()->ranchor2D()).c_str(),
+             rcppsw::to_string(candidates[i]->ent()->danchor2D()).c_str(),
+             candidates[i]->density().v(),
+             batch.utility(i));
+  } /* for(i..) */
+
+  const crepr::base_block3D* best = nullptr;
+  if (math::utility_batch::kNoSelection != res.index) {
+    best = candidates[res.index]->ent();
+  }
 
   ER_CHECKI(nullptr != best,
             "Best utility: block%d@%s/%s: %f",
             best->id().v(),
             rcppsw::to_string(best->ranchor2D()).c_str(),
             rcppsw::to_string(best->danchor2D()).c_str(),
-            max_utility);
+            res.utility);
 
   ER_CHECKW(nullptr != best, "No best block found: all known blocks excluded!");
   return best;
@@ -94,7 +106,8 @@ block_selector::operator()(const ds::dp_block_map& blocks,
 
 bool block_selector::block_is_excluded(
     const rmath::vector2d& position,
-    const crepr::base_block3D* const block) const {
+    const crepr::base_block3D* const block,
+    const sel_exception_list& exceptions) const {
   double block_dim = std::min(block->xrspan().span(), block->yrspan().span());
   /*
    * Use the center rather than the anchor to get a utility unaffected by the
@@ -109,11 +122,7 @@ bool block_selector::block_is_excluded(
              block_dim);
     return true;
   }
-  auto exceptions = boost::get<std::vector<rtypes::type_uuid>>(
-      mc_matrix->find(bselm::kSelExceptions)->second);
-  if (std::any_of(exceptions.begin(), exceptions.end(), [&](auto& id) {
-        return id == block->id();
-      })) {
+  if (exceptions.contains(block->id())) {
     ER_DEBUG("Ignoring block%d@%s/%s: On exception list",
              block->id().v(),
              block->ranchor2D().to_str().c_str(),
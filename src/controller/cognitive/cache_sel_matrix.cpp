@@ -36,45 +36,39 @@ NS_START(fordyca, controller, cognitive);
 cache_sel_matrix::cache_sel_matrix(
     const config::cache_sel::cache_sel_matrix_config* const config,
     const rmath::vector2d& nest_loc)
-    : ER_CLIENT_INIT("fordyca.controller.cache_sel_matrix") {
-  this->insert(std::make_pair(kNestLoc, nest_loc));
-  this->insert(std::make_pair(kCacheProxDist, config->cache_prox_dist));
-  this->insert(std::make_pair(kBlockProxDist, config->block_prox_dist));
-  this->insert(std::make_pair(kNestProxDist, config->nest_prox_dist));
-  this->insert(std::make_pair(kClusterProxDist, config->nest_prox_dist));
-  this->insert(std::make_pair(kSiteXRange, config->site_xrange));
-  this->insert(std::make_pair(kSiteYRange, config->site_yrange));
-  this->insert(
-      std::make_pair(kPickupExceptions, std::vector<rtypes::type_uuid>()));
-  this->insert(std::make_pair(kDropExceptions, std::vector<rtypes::type_uuid>()));
-  this->insert(std::make_pair(kPickupPolicy, config->pickup_policy));
-  this->insert(std::make_pair(kStrictConstraints, config->strict_constraints));
-  this->insert(std::make_pair(kNewCacheDropTolerance, config->new_cache_tol));
-}
+    : ER_CLIENT_INIT("fordyca.controller.cache_sel_matrix"),
+      mc_nest_loc(nest_loc),
+      mc_cache_prox_dist(config->cache_prox_dist),
+      /* There is no separate XML parameter for cluster proximity yet */
+      mc_cluster_prox_dist(config->nest_prox_dist),
+      mc_block_prox_dist(config->block_prox_dist),
+      mc_nest_prox_dist(config->nest_prox_dist),
+      mc_site_xrange(config->site_xrange),
+      mc_site_yrange(config->site_yrange),
+      mc_strict_constraints(config->strict_constraints),
+      mc_new_cache_tol(config->new_cache_tol),
+      mc_site_solver(config->site_solver),
+      mc_pickup_policy(config->pickup_policy) {}
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
 void cache_sel_matrix::sel_exception_add(const cache_sel_exception& ex) {
   switch (ex.type) {
-    case cache_sel_exception::ekPICKUP: {
-      auto& vec = boost::get<std::vector<rtypes::type_uuid>>(
-          this->find(kPickupExceptions)->second);
-      vec.push_back(ex.id);
-    } break;
-    case cache_sel_exception::ekDROP: {
-      auto& vec = boost::get<std::vector<rtypes::type_uuid>>(
-          this->find(kDropExceptions)->second);
-      vec.push_back(ex.id);
-    } break;
+    case cache_sel_exception::ekPICKUP:
+      m_pickup_exceptions.add(ex.id);
+      break;
+    case cache_sel_exception::ekDROP:
+      m_drop_exceptions.add(ex.id);
+      break;
     default:
       ER_FATAL_SENTINEL("Bad exception type %d", ex.type);
   } /* switch() */
 } /* sel_exception_add() */
 
 void cache_sel_matrix::sel_exceptions_clear(void) {
-  boost::get<std::vector<rtypes::type_uuid>>(this->at(kPickupExceptions)).clear();
-  boost::get<std::vector<rtypes::type_uuid>>(this->at(kDropExceptions)).clear();
+  m_pickup_exceptions.clear();
+  m_drop_exceptions.clear();
 } /* sel_exceptions_clear() */
 
 NS_END(cognitive, controller, fordyca);
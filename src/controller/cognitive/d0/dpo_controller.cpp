@@ -35,10 +35,13 @@
 
 #include "fordyca/config/block_sel/block_sel_matrix_config.hpp"
 #include "fordyca/config/d0/dpo_controller_repository.hpp"
+#include "fordyca/config/perception/dpo_store_config.hpp"
 #include "fordyca/config/strategy/strategy_config.hpp"
 #include "fordyca/controller/cognitive/block_sel_matrix.hpp"
 #include "fordyca/controller/cognitive/dpo_perception_subsystem.hpp"
+#include "fordyca/ds/dpo_store.hpp"
 #include "fordyca/fsm/d0/dpo_fsm.hpp"
+#include "fordyca/fsm/selection_memo.hpp"
 #include "fordyca/strategy/explore/block_factory.hpp"
 
 /*******************************************************************************
@@ -53,7 +56,8 @@ dpo_controller::dpo_controller(void)
     : ER_CLIENT_INIT("fordyca.controller.d0.dpo"),
       m_block_sel_matrix(),
       m_perception(),
-      m_fsm() {}
+      m_fsm(),
+      m_memo_counts(std::make_unique<fsm::selection_memo_counts>()) {}
 
 dpo_controller::~dpo_controller(void) = default;
 
@@ -123,9 +127,10 @@ void dpo_controller::shared_init(
   const auto* block_matrix =
       config_repo.config_get<config::block_sel::block_sel_matrix_config>();
   const auto* nest = config_repo.config_get<crepr::config::nest_config>();
+  const auto* store = config_repo.config_get<fcperception::dpo_store_config>();
 
   /* DPO perception subsystem */
-  m_perception = std::make_unique<dpo_perception_subsystem>(perception);
+  m_perception = std::make_unique<dpo_perception_subsystem>(perception, store);
 
   /* block selection matrix */
   m_block_sel_matrix =
@@ -136,13 +141,17 @@ void dpo_controller::private_init(
     const config::d0::dpo_controller_repository& config_repo) {
   const auto* strat_config =
       config_repo.config_get<fcstrategy::strategy_config>();
+  auto memo_resolution = config_repo.config_get<cspconfig::perception_config>()
+                             ->occupancy_grid.resolution;
 
   fstrategy::foraging_strategy::params strategy_params(
       saa(), nullptr, nullptr, nullptr, rutils::color());
   fsm::fsm_ro_params fsm_ro_params = { .bsel_matrix = block_sel_matrix(),
                                        .csel_matrix = nullptr,
                                        .store = perception()->dpo_store(),
-                                       .strategy_config = *strat_config };
+                                       .strategy_config = *strat_config,
+                                       .memo_counts = memo_counts(),
+                                       .memo_resolution = memo_resolution };
   m_fsm = std::make_unique<fsm::d0::dpo_fsm>(
       &fsm_ro_params,
       saa(),
@@ -182,6 +191,17 @@ RCPPSW_WRAP_DEF_OVERRIDE(dpo_controller, acquisition_loc3D, *m_fsm, const);
 RCPPSW_WRAP_DEF_OVERRIDE(dpo_controller, vector_loc3D, *m_fsm, const);
 RCPPSW_WRAP_DEF_OVERRIDE(dpo_controller, explore_loc3D, *m_fsm, const);
 
+/*******************************************************************************
+ * Selection Memo Metrics
+ ******************************************************************************/
+uint dpo_controller::n_memo_hits(void) const {
+  return m_memo_counts->n_hits(perception()->dpo_store()->decay_epoch());
+} /* n_memo_hits() */
+
+uint dpo_controller::n_memo_misses(void) const {
+  return m_memo_counts->n_misses(perception()->dpo_store()->decay_epoch());
+} /* n_memo_misses() */
+
 /*******************************************************************************
  * Block Transportation Metrics
  ******************************************************************************/
@@ -111,12 +111,17 @@ void mdpo_controller::private_init(
   const auto* strat_config =
       config_repo.config_get<fcstrategy::strategy_config>();
 
+  auto memo_resolution = config_repo.config_get<cspconfig::perception_config>()
+                             ->occupancy_grid.resolution;
+
   fstrategy::foraging_strategy::params strategy_params(
       saa(), nullptr, nullptr, perception()->dpo_store(), rutils::color());
   fsm::fsm_ro_params fsm_ro_params = { .bsel_matrix = block_sel_matrix(),
                                        .csel_matrix = nullptr,
                                        .store = perception()->dpo_store(),
-                                       .strategy_config = *strat_config };
+                                       .strategy_config = *strat_config,
+                                       .memo_counts = memo_counts(),
+                                       .memo_resolution = memo_resolution };
   dpo_controller::fsm(std::make_unique<fsm::d0::dpo_fsm>(
       &fsm_ro_params,
       saa(),
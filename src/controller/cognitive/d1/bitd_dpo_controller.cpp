@@ -136,7 +136,8 @@ void bitd_dpo_controller::private_init(
   m_executive = task_executive_builder(block_sel_matrix(),
                                        m_cache_sel_matrix.get(),
                                        saa(),
-                                       perception())(config_repo, rng());
+                                       perception(),
+                                       memo_counts())(config_repo, rng());
   executive()->task_abort_notify(std::bind(
       &bitd_dpo_controller::task_abort_cb, this, std::placeholders::_1));
   executive()->task_start_notify(std::bind(
@@ -29,6 +29,7 @@
 #include "cosm/arena/repr/light_type_index.hpp"
 #include "cosm/repr/base_block3D.hpp"
 #include "cosm/spatial/strategy/nest_acq/factory.hpp"
+#include "cosm/subsystem/perception/config/perception_config.hpp"
 #include "cosm/subsystem/saa_subsystemQ3D.hpp"
 #include "cosm/ta/bi_tdgraph_allocator.hpp"
 #include "cosm/ta/bi_tdgraph_executive.hpp"
@@ -63,12 +64,14 @@ task_executive_builder::task_executive_builder(
     const controller::cognitive::block_sel_matrix* bsel_matrix,
     const controller::cognitive::cache_sel_matrix* csel_matrix,
     csubsystem::saa_subsystemQ3D* const saa,
-    foraging_perception_subsystem* const perception)
+    foraging_perception_subsystem* const perception,
+    fsm::selection_memo_counts* const memo_counts)
     : ER_CLIENT_INIT("fordyca.controller.d1.task_executive_builder"),
       mc_csel_matrix(csel_matrix),
       mc_bsel_matrix(bsel_matrix),
       m_saa(saa),
-      m_perception(perception) {}
+      m_perception(perception),
+      m_memo_counts(memo_counts) {}
 
 task_executive_builder::~task_executive_builder(void) = default;
 
@@ -83,6 +86,8 @@ task_executive_builder::tasking_map task_executive_builder::d1_tasks_create(
       config_repo.config_get<cta::config::task_alloc_config>();
   const auto* strat_config =
       config_repo.config_get<fcstrategy::strategy_config>();
+  auto memo_resolution = config_repo.config_get<cspconfig::perception_config>()
+                             ->occupancy_grid.resolution;
   auto cache_color = carepr::light_type_index()[carepr::light_type_index::kCache];
   fstrategy::foraging_strategy::params strategy_cachep(
       saa(), nullptr, mc_csel_matrix, m_perception->dpo_store(), cache_color);
@@ -99,7 +104,9 @@ task_executive_builder::tasking_map task_executive_builder::d1_tasks_create(
   fsm::fsm_ro_params params = { .bsel_matrix = block_sel_matrix(),
                                 .csel_matrix = mc_csel_matrix,
                                 .store = m_perception->dpo_store(),
-                                .strategy_config = *strat_config };
+                                .strategy_config = *strat_config,
+                                .memo_counts = m_memo_counts,
+                                .memo_resolution = memo_resolution };
 
   auto generalist_fsm = std::make_unique<fsm::d0::free_block_to_nest_fsm>(
       &params,
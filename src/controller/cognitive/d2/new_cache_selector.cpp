@@ -26,13 +26,12 @@
 #include "cosm/arena/repr/base_cache.hpp"
 
 #include "fordyca/controller/cognitive/cache_sel_matrix.hpp"
-#include "fordyca/math/new_cache_utility.hpp"
+#include "fordyca/math/existing_cache_utility_batch.hpp"
 
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca, controller, cognitive, d2);
-using cselm = cache_sel_matrix;
 
 /*******************************************************************************
  * Constructors/Destructor
@@ -48,11 +47,18 @@ new_cache_selector::new_cache_selector(
 const crepr::base_block3D*
 new_cache_selector::operator()(const ds::dp_block_map& new_caches,
                                const ds::dp_cache_map& existing_caches,
-                               const rmath::vector2d& position) const {
-  const crepr::base_block3D* best = nullptr;
+                               const rmath::vector2d& position) {
   ER_ASSERT(!new_caches.empty(), "No known new caches");
 
-  double max_utility = 0.0;
+  /*
+   * A new cache has the utility of an existing cache containing a single
+   * block, so the batch for existing caches is used for new caches too.
+   */
+  math::existing_cache_utility_batch batch(mc_matrix->nest_loc(),
+                                           new_caches.size());
+  std::vector<const ds::dp_block_map::value_type*> candidates;
+  candidates.reserve(new_caches.size());
+
   for (const auto& c : new_caches.const_values_range()) {
     if (new_cache_is_excluded(existing_caches, new_caches, c.ent())) {
       continue;
@@ -61,31 +67,34 @@ new_cache_selector::operator()(const ds::dp_block_map& new_caches,
      * Use the center rather than the anchor to get a utility unaffected by the
      * relative position of the block and the robot
      */
-    math::new_cache_utility u(
-        c.ent()->rcenter2D(),
-        boost::get<rmath::vector2d>(mc_matrix->find(cselm::kNestLoc)->second));
+    batch.add(c.ent()->rcenter2D(), c.density(), 1);
+    candidates.push_back(&c);
+  } /* for(new_cache..) */
 
-    double utility = u.calc(position, c.density());
-    ER_ASSERT(utility > 0.0, "Bad utility calculation");
+  auto res = batch.calc(position);
+  m_decay_floor = batch.decay_floor(res);
+
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    ER_ASSERT(batch.utility(i) > 0.0, "Bad utility calculation");
     ER_DEBUG("Utility for new cache%d@%s/%s, density=%f: %f",
-             c.ent()->id().v(),
-             rcppsw::to_string(c.ent()->ranchor2D()).c_str(),
-             rcppsw::to_string(c.ent()->danchor2D()).c_str(),
-             c.density().v(),
-             utility);
-
-    if (utility > max_utility) {
-      best = c.ent();
-      max_utility = utility;
-    }
-  } /* for(new_cache..) */
+             candidates[i]->ent()->id().v(),
+             rcppsw::to_string(candidates[i]->ent()->ranchor2D()).c_str(),
+             rcppsw::to_string(candidates[i]->ent()->danchor2D()).c_str(),
+             candidates[i]->density().v(),
+             batch.utility(i));
+  } /* for(i..) */
+
+  const crepr::base_block3D* best = nullptr;
+  if (math::utility_batch::kNoSelection != res.index) {
+    best = candidates[res.index]->ent();
+  }
 
   ER_CHECKI(nullptr != best,
             "Best utility: new cache%d@%s/%s: %f",
             best->id().v(),
             rcppsw::to_string(best->ranchor2D()).c_str(),
             rcppsw::to_string(best->danchor2D()).c_str(),
-            max_utility);
+            res.utility);
 
   ER_CHECKW(nullptr != best,
             "No best new cache found: all known new caches excluded!");
@@ -96,10 +105,8 @@ bool new_cache_selector::new_cache_is_excluded(
     const ds::dp_cache_map& existing_caches,
     const ds::dp_block_map& blocks,
     const crepr::base_block3D* const new_cache) const {
-  auto cache_prox = boost::get<rtypes::spatial_dist>(
-      mc_matrix->find(cselm::kCacheProxDist)->second);
-  auto cluster_prox = boost::get<rtypes::spatial_dist>(
-      mc_matrix->find(cselm::kClusterProxDist)->second);
+  auto cache_prox = mc_matrix->cache_prox_dist();
+  auto cluster_prox = mc_matrix->cluster_prox_dist();
 
   /*
    * Use the center rather than the anchor to get a distance unaffected by the
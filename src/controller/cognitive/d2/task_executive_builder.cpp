@@ -27,6 +27,7 @@
 #include "cosm/arena/repr/light_type_index.hpp"
 #include "cosm/repr/base_block3D.hpp"
 #include "cosm/spatial/strategy/nest_acq/factory.hpp"
+#include "cosm/subsystem/perception/config/perception_config.hpp"
 #include "cosm/subsystem/saa_subsystemQ3D.hpp"
 #include "cosm/ta/bi_tdgraph_allocator.hpp"
 #include "cosm/ta/bi_tdgraph_executive.hpp"
@@ -61,8 +62,13 @@ task_executive_builder::task_executive_builder(
     const controller::cognitive::block_sel_matrix* bsel_matrix,
     const controller::cognitive::cache_sel_matrix* csel_matrix,
     csubsystem::saa_subsystemQ3D* const saa,
-    foraging_perception_subsystem* const perception)
-    : d1::task_executive_builder(bsel_matrix, csel_matrix, saa, perception),
+    foraging_perception_subsystem* const perception,
+    fsm::selection_memo_counts* const memo_counts)
+    : d1::task_executive_builder(bsel_matrix,
+                                 csel_matrix,
+                                 saa,
+                                 perception,
+                                 memo_counts),
       ER_CLIENT_INIT("fordyca.controller.d2.task_executive_builder") {}
 
 task_executive_builder::~task_executive_builder(void) = default;
@@ -78,6 +84,8 @@ task_executive_builder::tasking_map task_executive_builder::d2_tasks_create(
       config_repo.config_get<cta::config::task_alloc_config>();
   const auto* strat_config =
       config_repo.config_get<fcstrategy::strategy_config>();
+  auto memo_resolution = config_repo.config_get<cspconfig::perception_config>()
+                             ->occupancy_grid.resolution;
   auto cache_color = carepr::light_type_index()[carepr::light_type_index::kCache];
 
   fsexplore::block_factory block_factory;
@@ -95,7 +103,9 @@ task_executive_builder::tasking_map task_executive_builder::d2_tasks_create(
   fsm::fsm_ro_params params = { .bsel_matrix = block_sel_matrix(),
                                 .csel_matrix = cache_sel_matrix(),
                                 .store = perception()->dpo_store(),
-                                .strategy_config = *strat_config };
+                                .strategy_config = *strat_config,
+                                .memo_counts = memo_counts(),
+                                .memo_resolution = memo_resolution };
   auto cache_starter_fsm = std::make_unique<fsm::d2::block_to_cache_site_fsm>(
       &params,
       saa(),
@@ -23,11 +23,14 @@
  ******************************************************************************/
 #include "fordyca/controller/cognitive/dpo_perception_subsystem.hpp"
 
+#include <list>
+
 #include "cosm/arena/repr/arena_cache.hpp"
 #include "cosm/arena/repr/base_cache.hpp"
 
 #include "fordyca/controller/cognitive/los_proc_verify.hpp"
 #include "fordyca/controller/cognitive/oracular_info_receptor.hpp"
+#include "fordyca/ds/arena_snapshot_pool.hpp"
 #include "fordyca/ds/dpo_store.hpp"
 #include "fordyca/events/block_found.hpp"
 #include "fordyca/events/cache_found.hpp"
@@ -41,10 +44,18 @@ NS_START(fordyca, controller, cognitive);
  * Constructors/Destructor
  ******************************************************************************/
 dpo_perception_subsystem::dpo_perception_subsystem(
-    const cspconfig::perception_config* const config)
+    const cspconfig::perception_config* const config,
+    const fcperception::dpo_store_config* const store_config)
     : ER_CLIENT_INIT("fordyca.controller.dpo_perception"),
       foraging_perception_subsystem(config),
-      m_store(std::make_unique<ds::dpo_store>(&config->pheromone)) {}
+      m_store(std::make_unique<ds::dpo_store>(&config->pheromone)) {
+  if (nullptr != store_config) {
+    ER_INFO("DPO store capacity: blocks=%zu,caches=%zu (0=unlimited)",
+            store_config->max_blocks,
+            store_config->max_caches);
+    m_store->capacity(store_config->max_blocks, store_config->max_caches);
+  }
+}
 
 dpo_perception_subsystem::~dpo_perception_subsystem(void) = default;
 
@@ -52,12 +63,17 @@ dpo_perception_subsystem::~dpo_perception_subsystem(void) = default;
  * Member Functions
  ******************************************************************************/
 void dpo_perception_subsystem::update(oracular_info_receptor* const receptor) {
+  /* eviction metrics are per-update */
+  m_store->evictions_reset();
   process_los(los(), receptor);
   ER_ASSERT(los_proc_verify(los())(dpo_store()), "LOS verification failed");
   m_store->decay_all();
 } /* update() */
 
-void dpo_perception_subsystem::reset(void) { m_store->clear_all(); }
+void dpo_perception_subsystem::reset(void) {
+  m_store->clear_all();
+  m_los_stamp = {};
+}
 
 void dpo_perception_subsystem::process_los(
     const repr::forager_los* const c_los,
@@ -73,23 +89,82 @@ void dpo_perception_subsystem::process_los(
     receptor->dpo_store_update(m_store.get());
   }
 
+  /*
+   * If nothing in the LOS has changed since we last processed it (e.g. we are
+   * serving a penalty, or moving within a single cell), then all processing it
+   * again would do is refresh the densities of what is in it.
+   */
+  bool unchanged = los_unchanged(c_los);
+
   /*
    * Depending on oracle configuration, we may be able to skip processing parts
    * of our LOS, as they will be a subset of the updates we get from the oracle.
    */
   if (nullptr == receptor ||
       (nullptr != receptor && !receptor->entities_blocks_enabled())) {
-    process_los_blocks(c_los);
+    if (!(unchanged && los_blocks_refresh(c_los))) {
+      process_los_blocks(c_los);
+    }
   }
   if (nullptr == receptor ||
       (nullptr != receptor && !receptor->entities_caches_enabled())) {
-    process_los_caches(c_los);
+    if (!(unchanged && los_caches_refresh(c_los))) {
+      process_los_caches(c_los);
+    }
   }
 } /* process_los() */
 
+bool dpo_perception_subsystem::los_unchanged(
+    const repr::forager_los* const c_los) {
+  /* without the snapshot pool, we have no way of knowing */
+  const auto* pool = m_store->snapshot_pool();
+  if (nullptr == pool) {
+    return false;
+  }
+  los_stamp stamp = { c_los->abs_ll(),
+                      c_los->abs_ur(),
+                      pool->region_epoch(c_los->abs_ll(), c_los->abs_ur()),
+                      true };
+  bool unchanged = m_los_stamp.valid && m_los_stamp.ll == stamp.ll &&
+                   m_los_stamp.ur == stamp.ur &&
+                   m_los_stamp.epoch == stamp.epoch;
+  m_los_stamp = stamp;
+  return unchanged;
+} /* los_unchanged() */
+
+bool dpo_perception_subsystem::los_blocks_refresh(
+    const repr::forager_los* const c_los) {
+  /* check first, so that nothing is refreshed twice on fallback */
+  for (const auto* block : c_los->blocks()) {
+    const auto* known = m_store->find(block);
+    if (nullptr == known || !known->ent()->dloccmp(*block)) {
+      return false;
+    }
+  } /* for(*block..) */
+  for (const auto* block : c_los->blocks()) {
+    m_store->block_density_refresh(block);
+  } /* for(*block..) */
+  return true;
+} /* los_blocks_refresh() */
+
+bool dpo_perception_subsystem::los_caches_refresh(
+    const repr::forager_los* const c_los) {
+  /* check first, so that nothing is refreshed twice on fallback */
+  for (const auto* cache : c_los->caches()) {
+    const auto* known = m_store->find(cache);
+    if (nullptr == known || known->ent()->id() != cache->id()) {
+      return false;
+    }
+  } /* for(*cache..) */
+  for (const auto* cache : c_los->caches()) {
+    m_store->cache_density_refresh(cache);
+  } /* for(*cache..) */
+  return true;
+} /* los_caches_refresh() */
+
 void dpo_perception_subsystem::process_los_caches(
     const repr::forager_los* const c_los) {
-  cads::bcache_vectorno los_caches = c_los->caches();
+  const auto& los_caches = c_los->caches();
   ER_DEBUG("Caches in DPO store: [%s]",
            rcppsw::to_string(m_store->caches()).c_str());
   if (!los_caches.empty()) {
@@ -119,12 +194,7 @@ void dpo_perception_subsystem::process_los_caches(
 
 void dpo_perception_subsystem::process_los_blocks(
     const repr::forager_los* const c_los) {
-  /*
-   * Because this is computed, rather than a returned reference to a member
-   * variable, we can't use separate begin()/end() calls with it, and need to
-   * explicitly assign it.
-   */
-  auto los_blocks = c_los->blocks();
+  const auto& los_blocks = c_los->blocks();
   ER_DEBUG("Blocks in DPO store: [%s]",
            rcppsw::to_string(m_store->blocks()).c_str());
   if (!los_blocks.empty()) {
@@ -137,7 +207,7 @@ void dpo_perception_subsystem::process_los_blocks(
    */
   los_tracking_sync(c_los, los_blocks);
 
-  for (auto* block : c_los->blocks()) {
+  for (auto* block : los_blocks) {
     ER_ASSERT(!block->is_out_of_sight(),
               "Block%d@%s/%s out of sight in LOS?",
               block->id().v(),
@@ -167,10 +237,10 @@ void dpo_perception_subsystem::los_tracking_sync(
    * the corresponding cache should also be in our LOS. If it is not, then our
    * tracked version is out of date and needs to be removed.
    */
-  auto range = m_store->caches().values_range();
-  auto it = range.begin();
-
-  while (it != range.end()) {
+  std::list<const carepr::base_cache*> rms;
+  for (auto it = m_store->caches().values_range().begin();
+       it != m_store->caches().values_range().end();
+       ++it) {
     ER_TRACE("Check tracked DPO cache%d@%s/%s xspan=%s,yspan=%s w/LOS "
              "xspan=%s,yspan=%s",
              it->ent()->id().v(),
@@ -205,21 +275,20 @@ void dpo_perception_subsystem::los_tracking_sync(
               rcppsw::to_string(c_los->xspan()).c_str(),
               rcppsw::to_string(c_los->yspan()).c_str());
 
-      /*
-       * Copy iterator object + iterator increment MUST be before removal to
-       * avoid iterator invalidation and undefined behavior (I've seen both a
-       * segfault and infinite loop). See FORDYCA#589.
-       */
-      carepr::base_cache* tmp = (*it).ent();
-      ++it;
-      m_store->cache_remove(tmp);
-      ER_ASSERT(nullptr == m_store->find(tmp),
-                "Cache%d still exists in store after removal",
-                tmp->id().v());
-    } else {
-      ++it;
+      rms.push_back(it->ent());
     }
-  } /* while(it..) */
+  } /* for(it..) */
+
+  /*
+   * Removal MUST be after iteration, as removing an object from the store
+   * moves other objects around and invalidates iterators. See FORDYCA#589.
+   */
+  for (auto* c : rms) {
+    m_store->cache_remove(c);
+    ER_ASSERT(nullptr == m_store->find(c),
+              "Cache%d still exists in store after removal",
+              c->id().v());
+  } /* for(*c..) */
 } /* los_tracking_sync() */
 
 void dpo_perception_subsystem::los_tracking_sync(
@@ -234,17 +303,16 @@ void dpo_perception_subsystem::los_tracking_sync(
    * has moved since we last saw it (since that is limited to at most a single
    * block, it is handled by the \ref block_found event).
    */
-  auto range = m_store->blocks().values_range();
-  auto it = range.begin();
-
-  while (it != range.end()) {
+  std::list<const crepr::base_block3D*> rms;
+  for (auto it = m_store->blocks().values_range().begin();
+       it != m_store->blocks().values_range().end();
+       ++it) {
     ER_TRACE("Examining block%d@%s/%s",
              it->ent()->id().v(),
              rcppsw::to_string(it->ent()->ranchor2D()).c_str(),
              rcppsw::to_string(it->ent()->danchor2D()).c_str());
 
     if (!c_los->contains_abs(it->ent()->danchor2D())) {
-      ++it;
       continue;
     }
     /*
@@ -262,18 +330,17 @@ void dpo_perception_subsystem::los_tracking_sync(
               it->ent()->id().v(),
               rcppsw::to_string(it->ent()->ranchor2D()).c_str(),
               rcppsw::to_string(it->ent()->danchor2D()).c_str());
-      /*
-       * Copy iterator object + iterator increment MUST be before removal to
-       * avoid iterator invalidation and undefined behavior (I've seen both a
-       * segfault and infinite loop). See FORDYCA#589.
-       */
-      crepr::base_block3D* tmp = (*it).ent();
-      ++it;
-      m_store->block_remove(tmp);
-    } else {
-      ++it;
+      rms.push_back(it->ent());
     }
-  } /* while(it..) */
+  } /* for(it..) */
+
+  /*
+   * Removal MUST be after iteration, as removing an object from the store
+   * moves other objects around and invalidates iterators. See FORDYCA#589.
+   */
+  for (auto* b : rms) {
+    m_store->block_remove(b);
+  } /* for(*b..) */
 } /* los_tracking_sync() */
 
 /*******************************************************************************
@@ -288,31 +355,23 @@ uint dpo_perception_subsystem::n_known_caches(void) const {
 } /* n_known_caches() */
 
 crepr::pheromone_density dpo_perception_subsystem::avg_block_density(void) const {
-  auto range = m_store->blocks().const_values_range();
-  if (m_store->blocks().empty()) {
-    return crepr::pheromone_density();
-  }
-  return std::accumulate(range.begin(),
-                         range.end(),
-                         crepr::pheromone_density(),
-                         [&](const auto& accum, const auto& block) {
-                           return accum + block.density();
-                         }) /
-         m_store->blocks().size();
+  crepr::pheromone_density avg;
+  avg.pheromone_set(m_store->blocks().density_avg());
+  return avg;
 } /* avg_block_density() */
 
 crepr::pheromone_density dpo_perception_subsystem::avg_cache_density(void) const {
-  auto range = m_store->caches().const_values_range();
-  if (m_store->caches().empty()) {
-    return crepr::pheromone_density();
-  }
-  return std::accumulate(range.begin(),
-                         range.end(),
-                         crepr::pheromone_density(),
-                         [&](const auto& accum, const auto& cache) {
-                           return accum + cache.density();
-                         }) /
-         m_store->caches().size();
+  crepr::pheromone_density avg;
+  avg.pheromone_set(m_store->caches().density_avg());
+  return avg;
 } /* avg_cache_density() */
 
+uint dpo_perception_subsystem::n_evicted_blocks(void) const {
+  return m_store->n_evicted_blocks();
+} /* n_evicted_blocks() */
+
+uint dpo_perception_subsystem::n_evicted_caches(void) const {
+  return m_store->n_evicted_caches();
+} /* n_evicted_caches() */
+
 NS_END(cognitive, controller, fordyca);
@@ -47,7 +47,13 @@ bool los_proc_verify::operator()(const ds::dpo_store* const c_dpo) const {
    * processing from our DPO store, but will trigger an unconditional assert()
    * here. The fix is to only assert() if there is not a cache that contains the
    * block's location, and it is therefore not occluded.
+   *
+   * If the store is bounded and had to evict blocks/caches this timestep, then
+   * the ones in the LOS may not all be in it, so they are not checked.
    */
+  if (0 != c_dpo->n_evicted_blocks() || 0 != c_dpo->n_evicted_caches()) {
+    return true;
+  }
   for (const auto& cache : c_dpo->caches().const_values_range()) {
     for (auto* block : mc_los->blocks()) {
       if (!cache.ent()->contains_point2D(block->ranchor2D())) {
@@ -99,18 +105,16 @@ bool los_proc_verify::operator()(const ds::dpo_semantic_map* const c_map) const
    * Verify that for each cell that contained a block in the LOS, the
    * corresponding cell in the map also contains the same block.
    */
+  using map_state = ds::occupancy_grid::cell_state_type;
   for (auto* block : mc_los->blocks()) {
-    const auto& cell =
-        c_map->access<ds::occupancy_grid::kCell>(block->danchor2D());
-
-    ER_ASSERT(cell.state_has_block(),
+    ER_ASSERT(map_state::ekHAS_BLOCK == c_map->cell_state(block->danchor2D()),
               "Cell@%s not in HAS_BLOCK state",
               block->danchor2D().to_str().c_str());
-    ER_ASSERT(cell.block3D()->id() == block->id(),
+    ER_ASSERT(c_map->cell_entity(block->danchor2D()) == block->id(),
               "Cell@%s has wrong block ID (%d vs %d)",
               block->danchor2D().to_str().c_str(),
               block->id().v(),
-              cell.block3D()->id().v());
+              c_map->cell_entity(block->danchor2D()).v());
   } /* for(&block..) */
 
   /*
@@ -119,23 +123,25 @@ bool los_proc_verify::operator()(const ds::dpo_semantic_map* const c_map) const
    */
   for (uint i = 0; i < mc_los->xsize(); ++i) {
     for (uint j = 0; j < mc_los->ysize(); ++j) {
-      rmath::vector2z d = mc_los->access(i, j).loc();
       const auto& cell1 = mc_los->access(i, j);
-      const auto& cell2 = c_map->access<ds::occupancy_grid::kCell>(d);
+      rmath::vector2z d = cell1.loc();
+      map_state state2 = c_map->cell_state(d);
 
-      if (cell1.state_has_block() || cell1.state_is_empty()) {
-        ER_ASSERT(cell1.fsm().current_state() == cell2.fsm().current_state(),
-                  "LOS/DPO map disagree on state of cell@%s: %d/%d",
+      if (cell1.state_is_empty()) {
+        ER_ASSERT(map_state::ekEMPTY == state2,
+                  "LOS/DPO map disagree on state of cell@%s: EMPTY/%d",
+                  d.to_str().c_str(),
+                  static_cast<int>(state2));
+      } else if (cell1.state_has_block()) {
+        ER_ASSERT(map_state::ekHAS_BLOCK == state2,
+                  "LOS/DPO map disagree on state of cell@%s: HAS_BLOCK/%d",
+                  d.to_str().c_str(),
+                  static_cast<int>(state2));
+        ER_ASSERT(cell1.block3D()->id() == c_map->cell_entity(d),
+                  "LOS/DPO map disagree on block id in cell@%s: %d/%d",
                   d.to_str().c_str(),
-                  cell1.fsm().current_state(),
-                  cell2.fsm().current_state());
-        if (cell1.state_has_block()) {
-          ER_ASSERT(cell1.block3D()->id() == cell2.block3D()->id(),
-                    "LOS/DPO map disagree on block id in cell@%s: %d/%d",
-                    d.to_str().c_str(),
-                    cell1.block3D()->id().v(),
-                    cell2.block3D()->id().v());
-        }
+                  cell1.block3D()->id().v(),
+                  c_map->cell_entity(d).v());
       }
     } /* for(j..) */
   } /* for(i..) */
@@ -59,7 +59,7 @@ mdpo_perception_subsystem::mdpo_perception_subsystem(
  * Member Functions
  ******************************************************************************/
 void mdpo_perception_subsystem::update(oracular_info_receptor* const receptor) {
-  update_cell_stats(los());
+  los_diff_scan(los());
   process_los(los(), receptor);
   ER_ASSERT(los_proc_verify(los())(map()), "LOS verification failed");
   m_map->decay_all();
@@ -97,12 +97,7 @@ void mdpo_perception_subsystem::process_los(
 
 void mdpo_perception_subsystem::process_los_blocks(
     const repr::forager_los* const c_los) {
-  /*
-   * Because this is computed, rather than a returned reference to a member
-   * variable, we can't use separate begin()/end() calls with it, and need to
-   * explicitly assign it.
-   */
-  auto blocks = c_los->blocks();
+  const auto& blocks = c_los->blocks();
   if (!blocks.empty()) {
     auto accum =
         std::accumulate(blocks.begin(),
@@ -123,52 +118,46 @@ void mdpo_perception_subsystem::process_los_blocks(
    * the cell does not contain a block, then someone else picked up the block
    * between then and now, and it needs to update its internal repr
    * accordingly.
+   *
+   * The map may have changed since the diff was built (e.g. from oracle
+   * updates), so each difference is re-checked before it is applied.
    */
-  for (uint i = 0; i < c_los->xsize(); ++i) {
-    for (uint j = 0; j < c_los->ysize(); ++j) {
-      rmath::vector2z d = c_los->access(i, j).loc();
-      if (!c_los->access(i, j).state_has_block() &&
-          m_map->access<occupancy_grid::kCell>(d).state_has_block()) {
-        auto* los_entity = c_los->access(i, j).entity();
-        ER_ASSERT(crepr::entity_dimensionality::ek3D ==
-                      los_entity->dimensionality(),
-                  "LOS block%d is not 3D!",
-                  los_entity->id().v());
-        auto* map_block = m_map->access<occupancy_grid::kCell>(d).block3D();
-        ER_DEBUG("Correct block%d %s/%s discrepency",
-                 map_block->id().v(),
-                 map_block->ranchor2D().to_str().c_str(),
-                 map_block->danchor2D().to_str().c_str());
-        m_map->block_remove(map_block);
-      } else if (c_los->access(i, j).state_is_known() &&
-                 !m_map->access<occupancy_grid::kCell>(d).state_is_known()) {
-        ER_TRACE("Cell@%s now known to be empty", d.to_str().c_str());
-        events::cell2D_empty_visitor e(d);
-        e.visit(*m_map);
-      }
-    } /* for(j..) */
-  } /* for(i..) */
+  for (const auto& diff : m_los_diff) {
+    auto* known = m_map->cell_block(diff.loc);
+    if (los_diff_type::ekBLOCK_VANISHED == diff.type && nullptr != known) {
+      const auto* map_block = known->ent();
+      ER_DEBUG("Correct block%d %s/%s discrepency",
+               map_block->id().v(),
+               map_block->ranchor2D().to_str().c_str(),
+               map_block->danchor2D().to_str().c_str());
+      m_map->block_remove(known->ent());
+    } else if (los_diff_type::ekCELL_KNOWN == diff.type &&
+               occupancy_grid::cell_state_type::ekUNKNOWN ==
+                   m_map->cell_state(diff.loc)) {
+      ER_TRACE("Cell@%s now known to be empty", diff.loc.to_str().c_str());
+      events::cell2D_empty_visitor e(diff.loc);
+      e.visit(*m_map);
+    }
+  } /* for(&diff..) */
 
-  for (auto* block : c_los->blocks()) {
+  for (auto* block : blocks) {
     ER_ASSERT(!block->is_out_of_sight(),
               "Block%d out of sight in LOS?",
               block->id().v());
-    auto& cell = m_map->access<occupancy_grid::kCell>(block->danchor2D());
-    if (!cell.state_has_block()) {
+    if (occupancy_grid::cell_state_type::ekHAS_BLOCK !=
+        m_map->cell_state(block->danchor2D())) {
       ER_INFO("Discovered block%d@%s/%s",
               block->id().v(),
               block->ranchor2D().to_str().c_str(),
               block->danchor2D().to_str().c_str());
-    } else if (cell.state_has_block()) {
+    } else {
       ER_DEBUG("Block%d@%s/%s already known",
                block->id().v(),
                block->ranchor2D().to_str().c_str(),
                block->danchor2D().to_str().c_str());
-      auto range = m_map->blocks().const_values_range();
-      auto it = std::find_if(range.begin(), range.end(), [&](const auto& b1) {
-        return b1.ent()->id() == cell.block3D()->id();
-      });
-      ER_ASSERT(it != range.end(), "Known block%d not in PAM", block->id().v());
+      ER_ASSERT(nullptr != m_map->cell_block(block->danchor2D()),
+                "Known block%d not in PAM",
+                block->id().v());
     }
     events::block_found_visitor op(block);
     op.visit(*m_map);
@@ -177,12 +166,7 @@ void mdpo_perception_subsystem::process_los_blocks(
 
 void mdpo_perception_subsystem::process_los_caches(
     const repr::forager_los* const c_los) {
-  /*
-   * Because this is computed, rather than a returned reference to a member
-   * variable, we can't use separate begin()/end() calls with it, and need to
-   * explicitly assign it.
-   */
-  auto los_caches = c_los->caches();
+  const auto& los_caches = c_los->caches();
   if (!los_caches.empty()) {
     ER_DEBUG("Caches in LOS: [%s]", rcppsw::to_string(los_caches).c_str());
     ER_DEBUG("Caches in DPO store: [%s]",
@@ -195,20 +179,17 @@ void mdpo_perception_subsystem::process_los_caches(
    * the cell does not contain a cache, then the cache was depleted between then
    * and now, and it needs to update its internal repr accordingly.
    */
-  for (uint i = 0; i < c_los->xsize(); ++i) {
-    for (uint j = 0; j < c_los->ysize(); ++j) {
-      rmath::vector2z d = c_los->access(i, j).loc();
-      if (!c_los->access(i, j).state_has_cache() &&
-          map()->access<occupancy_grid::kCell>(d).state_has_cache()) {
-        auto* cache = map()->access<occupancy_grid::kCell>(d).cache();
-        ER_DEBUG("Correct cache%d@%s/%s discrepency",
-                 cache->id().v(),
-                 cache->rcenter2D().to_str().c_str(),
-                 cache->dcenter2D().to_str().c_str());
-        map()->cache_remove(cache);
-      }
-    } /* for(j..) */
-  } /* for(i..) */
+  for (const auto& diff : m_los_diff) {
+    auto* known = map()->cell_cache(diff.loc);
+    if (los_diff_type::ekCACHE_VANISHED == diff.type && nullptr != known) {
+      const auto* cache = known->ent();
+      ER_DEBUG("Correct cache%d@%s/%s discrepency",
+               cache->id().v(),
+               cache->rcenter2D().to_str().c_str(),
+               cache->dcenter2D().to_str().c_str());
+      map()->cache_remove(known->ent());
+    }
+  } /* for(&diff..) */
 
   for (auto& cache : los_caches) {
     /*
@@ -221,49 +202,68 @@ void mdpo_perception_subsystem::process_los_caches(
              cache->rcenter2D().to_str().c_str(),
              cache->dcenter2D().to_str().c_str(),
              cache->n_blocks());
-    auto& cell = map()->access<occupancy_grid::kCell>(cache->dcenter2D());
+    const auto* known = map()->cell_cache(cache->dcenter2D());
 
-    if (!cell.state_has_cache()) {
+    if (nullptr == known) {
       ER_INFO("Discovered cache%d@%s/%s: %zu blocks",
               cache->id().v(),
               cache->rcenter2D().to_str().c_str(),
               cache->dcenter2D().to_str().c_str(),
               cache->n_blocks());
-    } else if (cell.state_has_cache() &&
-               cell.cache()->n_blocks() != cache->n_blocks()) {
+    } else if (known->ent()->n_blocks() != cache->n_blocks()) {
       ER_INFO("Fixed cache%d@%s/%s block count: %zu -> %zu",
               cache->id().v(),
               cache->rcenter2D().to_str().c_str(),
               cache->dcenter2D().to_str().c_str(),
               cache->n_blocks(),
-              cell.cache()->n_blocks());
+              known->ent()->n_blocks());
     }
     events::cache_found_visitor op(cache);
     op.visit(*m_map);
   } /* for(cache..) */
 } /* process_los_caches() */
 
-void mdpo_perception_subsystem::update_cell_stats(
+void mdpo_perception_subsystem::los_diff_scan(
     const repr::forager_los* const c_los) {
+  m_los_diff.clear();
+
+  /*
+   * Row-major order over the LOS, which matches the layout of both the LOS
+   * and the map. Only the packed state of each map cell is needed, so cells
+   * are not materialized.
+   */
+  using map_state = ds::packed_cell_grid::state;
   for (uint i = 0; i < c_los->xsize(); ++i) {
     for (uint j = 0; j < c_los->ysize(); ++j) {
-      rmath::vector2z d = c_los->access(i, j).loc();
-      if (c_los->access(i, j).state_is_empty() &&
-          m_map->access<occupancy_grid::kCell>(d).state_is_known() &&
-          !m_map->access<occupancy_grid::kCell>(d).state_is_empty()) {
-        m_cell_stats[cfsm::cell2D_state::ekST_EMPTY]++;
-      } else if (c_los->access(i, j).state_has_block() &&
-                 m_map->access<occupancy_grid::kCell>(d).state_is_known() &&
-                 !m_map->access<occupancy_grid::kCell>(d).state_has_block()) {
-        m_cell_stats[cfsm::cell2D_state::ekST_HAS_BLOCK]++;
-      } else if (c_los->access(i, j).state_has_cache() &&
-                 m_map->access<occupancy_grid::kCell>(d).state_is_known() &&
-                 !m_map->access<occupancy_grid::kCell>(d).state_has_cache()) {
-        m_cell_stats[cfsm::cell2D_state::ekST_HAS_CACHE]++;
+      const auto& los_cell = c_los->access(i, j);
+      rmath::vector2z d = los_cell.loc();
+      map_state state = m_map->cell_state(d);
+      bool map_known = map_state::ekUNKNOWN != state;
+      bool map_block = map_state::ekHAS_BLOCK == state;
+      bool map_cache = map_state::ekHAS_CACHE == state;
+
+      /* inaccuracies in the map, as of the start of the timestep */
+      if (map_known) {
+        if (los_cell.state_is_empty() && map_state::ekEMPTY != state) {
+          m_cell_stats[cfsm::cell2D_state::ekST_EMPTY]++;
+        } else if (los_cell.state_has_block() && !map_block) {
+          m_cell_stats[cfsm::cell2D_state::ekST_HAS_BLOCK]++;
+        } else if (los_cell.state_has_cache() && !map_cache) {
+          m_cell_stats[cfsm::cell2D_state::ekST_HAS_CACHE]++;
+        }
+      }
+
+      if (!los_cell.state_has_block() && map_block) {
+        m_los_diff.push_back({ los_diff_type::ekBLOCK_VANISHED, d });
+      } else if (los_cell.state_is_known() && !map_known) {
+        m_los_diff.push_back({ los_diff_type::ekCELL_KNOWN, d });
+      }
+      if (!los_cell.state_has_cache() && map_cache) {
+        m_los_diff.push_back({ los_diff_type::ekCACHE_VANISHED, d });
       }
     } /* for(j..) */
   } /* for(i..) */
-} /* update_cell_stats() */
+} /* los_diff_scan() */
 
 ds::dpo_store* mdpo_perception_subsystem::dpo_store(void) {
   return m_map->store();
@@ -23,6 +23,8 @@
  ******************************************************************************/
 #include "fordyca/controller/cognitive/oracular_info_receptor.hpp"
 
+#include <unordered_set>
+
 #include "cosm/arena/repr/base_cache.hpp"
 #include "cosm/foraging/oracle/foraging_oracle.hpp"
 #include "cosm/oracle/entities_oracle.hpp"
@@ -32,7 +34,9 @@
 #include "cosm/ta/polled_task.hpp"
 #include "cosm/ta/time_estimate.hpp"
 
+#include "fordyca/ds/arena_snapshot_pool.hpp"
 #include "fordyca/ds/dpo_store.hpp"
+#include "fordyca/ds/oracle_knowledge.hpp"
 #include "fordyca/events/block_found.hpp"
 #include "fordyca/events/cache_found.hpp"
 
@@ -45,37 +49,99 @@ NS_START(fordyca, controller, cognitive);
  * Member Functions
  ******************************************************************************/
 void oracular_info_receptor::dpo_store_update(ds::dpo_store* const store) {
+  /*
+   * Everything of a type the oracle tells us about is current, so it does not
+   * decay; refreshing all of it every timestep would make syncing O(arena).
+   */
+  store->decay_enable(!entities_blocks_enabled(), !entities_caches_enabled());
+
+  const auto* pool = store->snapshot_pool();
+  if (nullptr != pool && m_synced && pool->journal_covers(m_epoch)) {
+    dpo_store_delta_update(store, pool);
+  } else {
+    dpo_store_full_update(store);
+  }
+  if (nullptr != pool) {
+    m_epoch = pool->epoch();
+    m_synced = true;
+  }
+} /* dpo_store_update() */
+
+void oracular_info_receptor::dpo_store_full_update(ds::dpo_store* const store) {
   if (entities_blocks_enabled()) {
-    auto blocks = mc_oracle->blocks()->ask();
-    if (!blocks.empty()) {
-      ER_DEBUG("Blocks in receptor: [%s]",
-               cforacle::foraging_oracle::blocks_oracle_type::knowledge_to_string(
-                   "b", blocks)
-                   .c_str());
-      ER_DEBUG("Blocks in DPO store: [%s]",
-               rcppsw::to_string(store->blocks()).c_str());
-    }
-    for (auto* b : blocks) {
+    ER_DEBUG("Free blocks in receptor: %zu, in DPO store: %zu",
+             mc_knowledge->blocks().size(),
+             store->blocks().size());
+    for (auto* b : mc_knowledge->blocks()) {
       events::block_found_visitor visitor(b);
       visitor.visit(*store);
-    } /* for(&e..) */
+    } /* for(*b..) */
   }
   if (entities_caches_enabled()) {
-    auto caches = mc_oracle->caches()->ask();
-    if (!caches.empty()) {
-      ER_DEBUG("Caches in receptor: [%s]",
-               cforacle::foraging_oracle::caches_oracle_type::knowledge_to_string(
-                   "c", caches)
-                   .c_str());
-      ER_DEBUG("Caches in DPO store: [%s]",
-               rcppsw::to_string(store->caches()).c_str());
-    }
-    for (auto* c : caches) {
+    ER_DEBUG("Caches in receptor: %zu, in DPO store: %zu",
+             mc_knowledge->caches().size(),
+             store->caches().size());
+    for (auto* c : mc_knowledge->caches()) {
       events::cache_found_visitor visitor(c);
       visitor.visit(*store);
-    } /* for(&e..) */
+    } /* for(*c..) */
   }
-} /* dpo_store_update() */
+} /* dpo_store_full_update() */
+
+void oracular_info_receptor::dpo_store_delta_update(
+    ds::dpo_store* const store,
+    const ds::arena_snapshot_pool* const pool) {
+  using change_type = ds::arena_snapshot_pool::change_type;
+
+  /* changes are applied in order, so only the last one for an entity counts */
+  std::unordered_set<int> touched_blocks;
+  std::unordered_set<int> touched_caches;
+
+  if (entities_blocks_enabled()) {
+    auto it = pool->block_changes_since(m_epoch);
+    for (; it != pool->block_changes().end(); ++it) {
+      touched_blocks.insert(it->id.v());
+    } /* for(it..) */
+
+    for (int id : touched_blocks) {
+      auto snap = pool->block(rtypes::type_uuid(id));
+      if (0 == snap.version) {
+        continue;
+      }
+      if (pool->block_is_free(rtypes::type_uuid(id))) {
+        events::block_found_visitor visitor(snap.ent.get());
+        visitor.visit(*store);
+      } else {
+        /* picked up by a robot or dropped in a cache since we last synced */
+        store->block_remove(snap.ent.get());
+      }
+    } /* for(id..) */
+  }
+
+  if (entities_caches_enabled()) {
+    auto it = pool->cache_changes_since(m_epoch);
+    for (; it != pool->cache_changes().end(); ++it) {
+      touched_caches.insert(it->id.v());
+    } /* for(it..) */
+
+    for (int id : touched_caches) {
+      auto snap = pool->cache(rtypes::type_uuid(id));
+      if (0 != snap.version) {
+        events::cache_found_visitor visitor(snap.ent.get());
+        visitor.visit(*store);
+      } else if (auto* known = store->caches().find(rtypes::type_uuid(id))) {
+        /* depleted since we last synced */
+        store->cache_remove(known->ent());
+      }
+    } /* for(id..) */
+  }
+
+  ER_DEBUG("Applied %zu block, %zu cache changes since epoch %u (now %u)",
+           touched_blocks.size(),
+           touched_caches.size(),
+           m_epoch,
+           pool->epoch());
+} /* dpo_store_delta_update() */
 
 void oracular_info_receptor::tasking_hooks_register(
     cta::bi_tdgraph_executive* const executive) {
@@ -0,0 +1,380 @@
+/**
+ * \file arena_snapshot_pool.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/ds/arena_snapshot_pool.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+#include "cosm/arena/caching_arena_map.hpp"
+#include "cosm/arena/repr/arena_cache.hpp"
+#include "cosm/repr/base_block3D.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, ds);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+template <typename TEntity>
+void arena_snapshot_pool::tiles_touch(const TEntity* const ent, uint epoch) {
+  /* blocks carried by robots are not in any cell */
+  if constexpr (std::is_base_of<crepr::base_block3D, TEntity>::value) {
+    if (ent->is_out_of_sight()) {
+      return;
+    }
+  }
+  auto cell = [&](double v) {
+    return static_cast<size_t>(std::max(0.0, std::floor(v / m_resolution)));
+  };
+  auto xspan = ent->xrspan();
+  auto yspan = ent->yrspan();
+  for (size_t x = cell(xspan.lb()) / kTileDim; x <= cell(xspan.ub()) / kTileDim;
+       ++x) {
+    for (size_t y = cell(yspan.lb()) / kTileDim;
+         y <= cell(yspan.ub()) / kTileDim;
+         ++y) {
+      m_tiles[tile_key(x, y)] = epoch;
+    } /* for(y..) */
+  } /* for(x..) */
+} /* tiles_touch() */
+
+void arena_snapshot_pool::update(const carena::caching_arena_map* const map) {
+  size_t n_new = 0;
+  size_t n_removed = 0;
+
+  /* all changes found during this update belong to the next epoch */
+  uint epoch = m_epoch + 1;
+  m_resolution = map->grid_resolution().v();
+
+  /* blocks are never removed from the arena, only moved */
+  if (m_blocks_rescan) {
+    for (const auto* b : map->blocks()) {
+      n_new += static_cast<size_t>(block_refresh(b, epoch));
+    } /* for(*b..) */
+    m_blocks_rescan = false;
+  } else {
+    for (int id : m_pending_blocks) {
+      auto it = m_blocks.find(id);
+      if (m_blocks.end() != it) {
+        n_new += static_cast<size_t>(block_refresh(it->second.arena, epoch));
+      }
+    } /* for(id..) */
+  }
+  m_pending_blocks.clear();
+
+  if (m_caches_rescan || !m_pending_caches.empty()) {
+    auto res = caches_refresh(map, epoch);
+    n_new += res.first;
+    n_removed += res.second;
+  }
+
+  if (n_new > 0 || n_removed > 0) {
+    m_epoch = epoch;
+    journal_trim();
+  }
+
+  ER_TRACE("Took %zu new snapshots, dropped %zu (epoch=%u,n_blocks=%zu,n_caches=%zu)",
+           n_new,
+           n_removed,
+           m_epoch,
+           m_blocks.size(),
+           m_caches.size());
+} /* update() */
+
+void arena_snapshot_pool::block_changed(const rtypes::type_uuid& id) {
+  if (rtypes::constants::kNoUUID != id) {
+    m_pending_blocks.push_back(id.v());
+  }
+} /* block_changed() */
+
+bool arena_snapshot_pool::block_refresh(const crepr::base_block3D* const block,
+                                        uint epoch) {
+  auto& entry = m_blocks[block->id().v()];
+  entry.arena = block;
+  if (0 != entry.snap.version && entry.loc == block->danchor2D()) {
+    return false;
+  }
+  m_block_changes.push_back({ epoch,
+                              block->id(),
+                              0 == entry.snap.version ? change_type::ekADDED
+                                                      : change_type::ekMODIFIED });
+  /* both where the block was, and where it is now */
+  if (0 != entry.snap.version) {
+    tiles_touch(entry.snap.ent.get(), epoch);
+  }
+  tiles_touch(block, epoch);
+  entry.snap = { block->clone(), ++m_version };
+  entry.loc = block->danchor2D();
+
+  /*
+   * The cache the block was in (if it was picked up from one), and the cache
+   * it is now in (if it was dropped in one) have changed too. Blocks in caches
+   * are always at the cache's center.
+   */
+  auto cached = m_cached_blocks.find(block->id().v());
+  if (m_cached_blocks.end() != cached) {
+    m_pending_caches.insert(cached->second);
+  }
+  if (!block->is_out_of_sight()) {
+    auto center = m_cache_centers.find(
+        tile_key(block->danchor2D().x(), block->danchor2D().y()));
+    if (m_cache_centers.end() != center) {
+      m_pending_caches.insert(center->second);
+    }
+  }
+  return true;
+} /* block_refresh() */
+
+std::pair<size_t, size_t> arena_snapshot_pool::caches_refresh(
+    const carena::caching_arena_map* const map,
+    uint epoch) {
+  size_t n_new = 0;
+  size_t n_removed = 0;
+
+  for (auto& pair : m_caches) {
+    pair.second.seen = false;
+  } /* for(&pair..) */
+
+  for (const auto* c : map->caches()) {
+    auto& entry = m_caches[c->id().v()];
+    entry.seen = true;
+
+    /* only caches which might have changed need their blocks compared */
+    if (0 != entry.snap.version && !m_caches_rescan &&
+        m_pending_caches.end() == m_pending_caches.find(c->id().v())) {
+      continue;
+    }
+    if (0 != entry.snap.version && cache_blocks_equal(c, entry.blocks)) {
+      continue;
+    }
+    m_cache_changes.push_back({ epoch,
+                                c->id(),
+                                0 == entry.snap.version ? change_type::ekADDED
+                                                        : change_type::ekMODIFIED });
+    cached_blocks_remove(entry.blocks, c->id());
+    std::vector<rtypes::type_uuid> released = std::move(entry.blocks);
+    entry.blocks.clear();
+    for (const auto* b : c->blocks()) {
+      entry.blocks.push_back(b->id());
+    } /* for(*b..) */
+    cached_blocks_add(entry.blocks, c->id());
+    blocks_released(released, epoch);
+
+    if (0 != entry.snap.version) {
+      tiles_touch(entry.snap.ent.get(), epoch);
+    }
+    tiles_touch(c, epoch);
+    m_cache_centers[tile_key(c->dcenter2D().x(), c->dcenter2D().y())] =
+        c->id().v();
+    entry.snap = { c->clone(), ++m_version };
+    ++n_new;
+  } /* for(*c..) */
+
+  /* depleted caches */
+  for (auto it = m_caches.begin(); it != m_caches.end();) {
+    if (!it->second.seen) {
+      m_cache_changes.push_back(
+          { epoch, rtypes::type_uuid(it->first), change_type::ekREMOVED });
+      cached_blocks_remove(it->second.blocks, rtypes::type_uuid(it->first));
+      blocks_released(it->second.blocks, epoch);
+      const auto* snap = it->second.snap.ent.get();
+      auto center = m_cache_centers.find(
+          tile_key(snap->dcenter2D().x(), snap->dcenter2D().y()));
+      if (m_cache_centers.end() != center && it->first == center->second) {
+        m_cache_centers.erase(center);
+      }
+      tiles_touch(snap, epoch);
+      it = m_caches.erase(it);
+      ++n_removed;
+    } else {
+      ++it;
+    }
+  } /* for(it..) */
+
+  m_pending_caches.clear();
+  m_caches_rescan = false;
+  return { n_new, n_removed };
+} /* caches_refresh() */
+
+void arena_snapshot_pool::reset(void) {
+  m_blocks.clear();
+  m_caches.clear();
+  m_cached_blocks.clear();
+  m_cache_centers.clear();
+  m_pending_blocks.clear();
+  m_pending_caches.clear();
+  m_blocks_rescan = true;
+  m_caches_rescan = true;
+
+  /*
+   * The journal no longer describes how to get from any previous epoch to the
+   * current one, so everyone has to resynchronize from scratch.
+   */
+  m_block_changes.clear();
+  m_cache_changes.clear();
+  m_journal_start = ++m_epoch;
+
+  /* similarly, all tiles have to be considered changed */
+  m_tiles.clear();
+  m_tiles_floor = m_epoch;
+} /* reset() */
+
+uint arena_snapshot_pool::region_epoch(const rmath::vector2z& ll,
+                                       const rmath::vector2z& ur) const {
+  uint epoch = m_tiles_floor;
+  for (size_t x = ll.x() / kTileDim; x <= ur.x() / kTileDim; ++x) {
+    for (size_t y = ll.y() / kTileDim; y <= ur.y() / kTileDim; ++y) {
+      auto it = m_tiles.find(tile_key(x, y));
+      if (m_tiles.end() != it) {
+        epoch = std::max(epoch, it->second);
+      }
+    } /* for(y..) */
+  } /* for(x..) */
+  return epoch;
+} /* region_epoch() */
+
+arena_snapshot_pool::snapshot<crepr::base_block3D>
+arena_snapshot_pool::block(const crepr::base_block3D* const block) const {
+  auto it = m_blocks.find(block->id().v());
+  if (m_blocks.end() == it || it->second.loc != block->danchor2D()) {
+    return {};
+  }
+  return it->second.snap;
+} /* block() */
+
+arena_snapshot_pool::snapshot<carepr::base_cache>
+arena_snapshot_pool::cache(const carepr::base_cache* const cache) const {
+  auto it = m_caches.find(cache->id().v());
+  if (m_caches.end() == it || it->second.blocks.size() != cache->n_blocks() ||
+      it->second.snap.ent->dcenter2D() != cache->dcenter2D()) {
+    return {};
+  }
+  return it->second.snap;
+} /* cache() */
+
+arena_snapshot_pool::snapshot<crepr::base_block3D>
+arena_snapshot_pool::block(const rtypes::type_uuid& id) const {
+  auto it = m_blocks.find(id.v());
+  return (m_blocks.end() == it) ? snapshot<crepr::base_block3D>{}
+                                : it->second.snap;
+} /* block() */
+
+arena_snapshot_pool::snapshot<carepr::base_cache>
+arena_snapshot_pool::cache(const rtypes::type_uuid& id) const {
+  auto it = m_caches.find(id.v());
+  return (m_caches.end() == it) ? snapshot<carepr::base_cache>{}
+                                : it->second.snap;
+} /* cache() */
+
+bool arena_snapshot_pool::block_is_free(const rtypes::type_uuid& id) const {
+  auto it = m_blocks.find(id.v());
+  return m_blocks.end() != it && !it->second.snap.ent->is_out_of_sight() &&
+         m_cached_blocks.end() == m_cached_blocks.find(id.v());
+} /* block_is_free() */
+
+bool arena_snapshot_pool::cache_blocks_equal(
+    const carepr::base_cache* const cache,
+    const std::vector<rtypes::type_uuid>& ids) {
+  if (cache->n_blocks() != ids.size()) {
+    return false;
+  }
+  auto it = ids.begin();
+  for (const auto* b : cache->blocks()) {
+    if (b->id() != *it++) {
+      return false;
+    }
+  } /* for(*b..) */
+  return true;
+} /* cache_blocks_equal() */
+
+void arena_snapshot_pool::cached_blocks_add(
+    const std::vector<rtypes::type_uuid>& ids,
+    const rtypes::type_uuid& cache_id) {
+  for (const auto& id : ids) {
+    m_cached_blocks[id.v()] = cache_id.v();
+  } /* for(&id..) */
+} /* cached_blocks_add() */
+
+void arena_snapshot_pool::cached_blocks_remove(
+    const std::vector<rtypes::type_uuid>& ids,
+    const rtypes::type_uuid& cache_id) {
+  for (const auto& id : ids) {
+    /* the block may already have been moved to another cache */
+    auto it = m_cached_blocks.find(id.v());
+    if (m_cached_blocks.end() != it && cache_id.v() == it->second) {
+      m_cached_blocks.erase(it);
+    }
+  } /* for(&id..) */
+} /* cached_blocks_remove() */
+
+void arena_snapshot_pool::blocks_released(
+    const std::vector<rtypes::type_uuid>& ids,
+    uint epoch) {
+  for (const auto& id : ids) {
+    /*
+     * Blocks which moved (e.g. the one picked up from the cache) or are in
+     * another cache have already been/do not need to be journaled.
+     */
+    auto it = m_blocks.find(id.v());
+    if (m_blocks.end() == it || 0 == it->second.snap.version ||
+        m_cached_blocks.end() != m_cached_blocks.find(id.v())) {
+      continue;
+    }
+    const auto* snap = it->second.snap.ent.get();
+    if (snap->is_out_of_sight() ||
+        it->second.arena->danchor2D() != it->second.loc) {
+      continue;
+    }
+    m_block_changes.push_back({ epoch, id, change_type::ekMODIFIED });
+    tiles_touch(snap, epoch);
+  } /* for(&id..) */
+} /* blocks_released() */
+
+arena_snapshot_pool::journal_type::const_iterator
+arena_snapshot_pool::changes_since(const journal_type& journal, uint epoch) {
+  /* journal entries are always appended in epoch order */
+  return std::partition_point(
+      journal.begin(), journal.end(), [&](const change& c) {
+        return c.epoch <= epoch;
+      });
+} /* changes_since() */
+
+void arena_snapshot_pool::journal_trim(void) {
+  if (m_epoch <= kJournalDepth) {
+    return;
+  }
+  uint cutoff = m_epoch - kJournalDepth;
+  while (!m_block_changes.empty() && m_block_changes.front().epoch <= cutoff) {
+    m_block_changes.pop_front();
+  } /* while(..) */
+  while (!m_cache_changes.empty() && m_cache_changes.front().epoch <= cutoff) {
+    m_cache_changes.pop_front();
+  } /* while(..) */
+  m_journal_start = std::max(m_journal_start, cutoff);
+} /* journal_trim() */
+
+NS_END(ds, fordyca);
@@ -0,0 +1,67 @@
+/**
+ * \file block_membership_index.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/ds/block_membership_index.hpp"
+
+#include <algorithm>
+
+#include "cosm/arena/repr/arena_cache.hpp"
+#include "cosm/foraging/repr/block_cluster.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, ds);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void block_membership_index::build(
+    const cads::acache_vectorno& caches,
+    const cfds::block3D_cluster_vectorro& clusters) {
+  /* keep the allocation around between builds */
+  std::fill(m_memberships.begin(), m_memberships.end(), membership{});
+
+  for (const auto* cache : caches) {
+    for (const auto* block : cache->blocks()) {
+      access(block->id()).cache = cache->id();
+    } /* for(*block..) */
+  } /* for(*cache..) */
+
+  for (const auto* clust : clusters) {
+    for (const auto* block : clust->blocks()) {
+      access(block->id()).cluster = clust->id();
+    } /* for(*block..) */
+  } /* for(*clust..) */
+} /* build() */
+
+block_membership_index::membership&
+block_membership_index::access(const rtypes::type_uuid& id) {
+  auto idx = static_cast<size_t>(id.v());
+  if (idx >= m_memberships.size()) {
+    m_memberships.resize(idx + 1);
+  }
+  return m_memberships[idx];
+} /* access() */
+
+NS_END(ds, fordyca);
@@ -0,0 +1,92 @@
+/**
+ * \file cache_prox_index.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/ds/cache_prox_index.hpp"
+
+#include <cmath>
+
+#include "cosm/arena/repr/arena_cache.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, ds);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+cache_prox_index::cache_prox_index(const rtypes::spatial_dist& prox_dist)
+    : ER_CLIENT_INIT("fordyca.ds.cache_prox_index"), mc_prox_dist(prox_dist) {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void cache_prox_index::rebuild(const cads::acache_vectorno& caches) {
+  m_buckets.clear();
+  for (const auto* cache : caches) {
+    const auto& center = cache->rcenter2D();
+    m_buckets[key(bucket_coord(center.x()), bucket_coord(center.y()))]
+        .push_back({ cache->id(), center });
+  } /* for(*cache..) */
+
+  m_n_entries = caches.size();
+  m_valid = true;
+  ER_DEBUG("Rebuilt index: %zu caches in %zu buckets",
+           m_n_entries,
+           m_buckets.size());
+} /* rebuild() */
+
+const cache_prox_index::entry*
+cache_prox_index::query(const rmath::vector2d& loc) const {
+  int x = bucket_coord(loc.x());
+  int y = bucket_coord(loc.y());
+  const entry* best = nullptr;
+  double best_dist = mc_prox_dist.v();
+
+  /*
+   * Buckets are as large as the proximity distance, so any cache close enough
+   * to matter must be in the neighborhood of the bucket containing loc.
+   */
+  for (int i = x - 1; i <= x + 1; ++i) {
+    for (int j = y - 1; j <= y + 1; ++j) {
+      auto it = m_buckets.find(key(i, j));
+      if (m_buckets.end() == it) {
+        continue;
+      }
+      for (const auto& e : it->second) {
+        double dist = (e.center - loc).length();
+        if (dist <= best_dist) {
+          best_dist = dist;
+          best = &e;
+        }
+      } /* for(&e..) */
+    } /* for(j..) */
+  } /* for(i..) */
+  return best;
+} /* query() */
+
+int cache_prox_index::bucket_coord(double v) const {
+  return static_cast<int>(std::floor(v / mc_prox_dist.v()));
+} /* bucket_coord() */
+
+NS_END(ds, fordyca);
@@ -35,6 +35,21 @@ NS_START(fordyca, ds);
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
+rtypes::type_uuid
+dpo_map_traits<crepr::base_block3D>::id(const crepr::base_block3D& block) {
+  return block.id();
+} /* id() */
+
+rmath::vector2z
+dpo_map_traits<crepr::base_block3D>::loc(const crepr::base_block3D& block) {
+  return block.danchor2D();
+} /* loc() */
+
+rmath::vector2d
+dpo_map_traits<crepr::base_block3D>::rloc(const crepr::base_block3D& block) {
+  return block.rcenter2D();
+} /* rloc() */
+
 std::string dp_block_map::to_str(void) const {
   auto range = const_values_range();
   return std::accumulate(range.begin(),
@@ -35,6 +35,21 @@ NS_START(fordyca, ds);
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
+rtypes::type_uuid
+dpo_map_traits<carepr::base_cache>::id(const carepr::base_cache& cache) {
+  return cache.id();
+} /* id() */
+
+rmath::vector2z
+dpo_map_traits<carepr::base_cache>::loc(const carepr::base_cache& cache) {
+  return cache.dcenter2D();
+} /* loc() */
+
+rmath::vector2d
+dpo_map_traits<carepr::base_cache>::rloc(const carepr::base_cache& cache) {
+  return cache.rcenter2D();
+} /* rloc() */
+
 std::string dp_cache_map::to_str(void) const {
   auto range = const_values_range();
   return std::accumulate(range.begin(),
@@ -23,15 +23,36 @@
  ******************************************************************************/
 #include "fordyca/ds/dpo_semantic_map.hpp"
 
-#include "cosm/arena/repr/base_cache.hpp"
+#include <algorithm>
+#include <cmath>
 
-#include "fordyca/events/cell2D_empty.hpp"
+#include "cosm/arena/repr/base_cache.hpp"
 
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca, ds);
 
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+#if (LIBRA_ER == LIBRA_ER_ALL)
+/**
+ * \brief Determine if the densities of the same object in the map and the store
+ * agree. The map decays densities in closed form at its own sync points and
+ * stores them in single precision, while the store decays them one step at a
+ * time in double precision, so they can differ by a few single precision ulps,
+ * which is more than machine epsilon for densities > 1; a relative tolerance is
+ * needed.
+ */
+static bool densities_agree(const crepr::pheromone_density& d1,
+                            const crepr::pheromone_density& d2) {
+  constexpr double kREL_TOL = 1e-5;
+  double scale = std::max({ 1.0, std::fabs(d1.v()), std::fabs(d2.v()) });
+  return std::fabs(d1.v() - d2.v()) <= kREL_TOL * scale;
+} /* densities_agree() */
+#endif
+
 /*******************************************************************************
  * Constructors/Destructor
  ******************************************************************************/
@@ -44,39 +65,72 @@ dpo_semantic_map::dpo_semantic_map(const cspconfig::perception_config* c_config,
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-bool dpo_semantic_map::cache_remove(carepr::base_cache* const victim) {
+bool dpo_semantic_map::cache_remove(const carepr::base_cache* const victim) {
+  /* victim may be the store's copy, which is gone after removal */
+  rmath::vector2z dcenter = victim->dcenter2D();
   if (m_store.cache_remove(victim)) {
-    ER_DEBUG("Updating cell@%s for removed cache",
-             victim->dcenter2D().to_str().c_str());
-    cdops::cell2D_empty_visitor op(victim->dcenter2D());
-    op.visit(decoratee().access<occupancy_grid::kCell>(victim->dcenter2D()));
+    ER_DEBUG("Updating cell@%s for removed cache", dcenter.to_str().c_str());
+    decoratee().cell_update(dcenter, occupancy_grid::cell_state_type::ekEMPTY);
     return true;
   }
   return false;
 } /* cache_remove() */
 
-bool dpo_semantic_map::block_remove(crepr::base_block3D* const victim) {
+bool dpo_semantic_map::block_remove(const crepr::base_block3D* const victim) {
+  /* victim may be the store's copy, which is gone after removal */
+  rmath::vector2z danchor = victim->danchor2D();
   if (m_store.block_remove(victim)) {
-    ER_DEBUG("Updating cell@%s for removed block",
-             victim->danchor2D().to_str().c_str());
-    events::cell2D_empty_visitor op(victim->danchor2D());
-    op.visit(access<occupancy_grid::kCell>(victim->danchor2D()));
+    ER_DEBUG("Updating cell@%s for removed block", danchor.to_str().c_str());
+    decoratee().cell_update(danchor, occupancy_grid::cell_state_type::ekEMPTY);
     return true;
   }
   return false;
 } /* block_remove() */
 
+const dp_block_map::value_type*
+dpo_semantic_map::cell_block(const rmath::vector2z& d) const {
+  if (occupancy_grid::cell_state_type::ekHAS_BLOCK != cell_state(d)) {
+    return nullptr;
+  }
+  return m_store.blocks().find(cell_entity(d));
+} /* cell_block() */
+
+dp_block_map::value_type* dpo_semantic_map::cell_block(const rmath::vector2z& d) {
+  if (occupancy_grid::cell_state_type::ekHAS_BLOCK != cell_state(d)) {
+    return nullptr;
+  }
+  return m_store.blocks().find(cell_entity(d));
+} /* cell_block() */
+
+const dp_cache_map::value_type*
+dpo_semantic_map::cell_cache(const rmath::vector2z& d) const {
+  if (occupancy_grid::cell_state_type::ekHAS_CACHE != cell_state(d)) {
+    return nullptr;
+  }
+  return m_store.caches().find(cell_entity(d));
+} /* cell_cache() */
+
+dp_cache_map::value_type* dpo_semantic_map::cell_cache(const rmath::vector2z& d) {
+  if (occupancy_grid::cell_state_type::ekHAS_CACHE != cell_state(d)) {
+    return nullptr;
+  }
+  return m_store.caches().find(cell_entity(d));
+} /* cell_cache() */
+
 void dpo_semantic_map::decay_all(void) {
   decoratee().update();
   m_store.decay_all();
 
+  /*
+   * Both the map and the store decay densities lazily, so only compute them to
+   * verify they agree if the asserts below are compiled in.
+   */
+#if (LIBRA_ER == LIBRA_ER_ALL)
   for (const auto& b : m_store.blocks().const_values_range()) {
     const rmath::vector2z& loc = b.ent()->danchor2D();
-    crepr::pheromone_density& map_density =
-        decoratee().access<occupancy_grid::kPheromone>(loc);
+    crepr::pheromone_density map_density = decoratee().density(loc);
 
-    ER_ASSERT(std::fabs((map_density - b.density()).v()) <=
-                  std::numeric_limits<double>::epsilon(),
+    ER_ASSERT(densities_agree(map_density, b.density()),
               "FATAL: Map density@%s and DP block%d density disagree: %f vs %f",
               loc.to_str().c_str(),
               b.ent()->id().v(),
@@ -86,17 +140,16 @@ void dpo_semantic_map::decay_all(void) {
 
   for (auto&& c : m_store.caches().const_values_range()) {
     const rmath::vector2z& loc = c.ent()->dcenter2D();
-    crepr::pheromone_density& map_density =
-        decoratee().access<occupancy_grid::kPheromone>(loc);
+    crepr::pheromone_density map_density = decoratee().density(loc);
 
-    ER_ASSERT(std::fabs((map_density - c.density()).v()) <=
-                  std::numeric_limits<double>::epsilon(),
+    ER_ASSERT(densities_agree(map_density, c.density()),
               "FATAL: Map density@%s and DP cache%d density disagree: %f vs %f",
               loc.to_str().c_str(),
               c.ent()->id().v(),
               map_density.v(),
               c.density().v());
   } /* for(&c..) */
+#endif
 } /* decay_all() */
 
 NS_END(ds, fordyca);
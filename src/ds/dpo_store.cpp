@@ -23,12 +23,13 @@
  ******************************************************************************/
 #include "fordyca/ds/dpo_store.hpp"
 
-#include <boost/range/adaptor/map.hpp>
 #include <numeric>
 
 #include "cosm/arena/repr/base_cache.hpp"
 #include "cosm/repr/base_block3D.hpp"
 
+#include "fordyca/ds/arena_snapshot_pool.hpp"
+
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
@@ -53,6 +54,19 @@ dpo_store::cache_update(dpo_entity<carepr::base_cache> cache) {
   ER_TRACE("Updating cache%d@%s",
            cache.ent()->id().v(),
            cache.ent()->dcenter2D().to_str().c_str());
+
+  /*
+   * If we are already tracking the same snapshot of the cache, it cannot have
+   * changed since we last saw it, so there is nothing to replace.
+   */
+  auto* known = m_caches.find(cache.ent()->dcenter2D());
+  if (nullptr != known && 0 != cache.version() &&
+      known->version() == cache.version()) {
+    m_caches.density_update(*known, cache.density());
+    res.reason = ekCACHE_UPDATED;
+    return res;
+  }
+
   /*
    * If we are currently tracking the cache, we unconditionally remove it,
    * because the # blocks in the cache could have changed since we last saw
@@ -63,25 +77,26 @@ dpo_store::cache_update(dpo_entity<carepr::base_cache> cache) {
   } else {
     res.reason = ekNEW_CACHE_ADDED;
   }
-  m_caches.obj_add({ cache.ent()->dcenter2D(), std::move(cache) });
+  if (!m_caches.obj_add(std::move(cache))) {
+    /* store is full of caches with higher densities */
+    res = { .status = false,
+            .reason = ekNO_CHANGE,
+            .old_loc = rmath::vector2z() };
+  }
   return res;
 } /* cache_update() */
 
-bool dpo_store::cache_remove(carepr::base_cache* const victim) {
-  auto range = m_caches.const_values_range();
+bool dpo_store::cache_remove(const carepr::base_cache* const victim) {
+  auto* known = m_caches.find(victim->id());
 
-  auto it = std::find_if(range.begin(), range.end(), [&](const auto& c) {
-    return c.ent()->idcmp(*victim);
-  });
-
-  if (it != range.end()) {
+  if (nullptr != known) {
     ER_TRACE("Removing cache%d@%s",
-             it->ent()->id().v(),
-             it->ent()->dcenter2D().to_str().c_str());
+             known->ent()->id().v(),
+             known->ent()->dcenter2D().to_str().c_str());
     if (1 == m_caches.size()) {
-      m_last_cache_loc = boost::make_optional(it->ent()->rcenter2D());
+      m_last_cache_loc = boost::make_optional(known->ent()->rcenter2D());
     }
-    m_caches.obj_remove(it->ent()->dcenter2D());
+    m_caches.obj_remove(known->ent()->dcenter2D());
     return true;
   }
   return false;
@@ -89,20 +104,6 @@ bool dpo_store::cache_remove(carepr::base_cache* const victim) {
 
 dpo_store::update_res_t
 dpo_store::block_update(dpo_entity<crepr::base_block3D> block_in) {
-  auto range = m_blocks.values_range();
-
-  auto it1 = std::find_if(range.begin(),
-                          range.end(),
-                          [&block_in](const dpo_entity<crepr::base_block3D>& b) {
-                            return b.ent()->idcmp(*block_in.ent());
-                          });
-  auto it2 = std::find_if(range.begin(),
-                          range.end(),
-                          [&block_in](const dpo_entity<crepr::base_block3D>& b) {
-                            return b.ent()->dloccmp(*block_in.ent()) &&
-                                   !b.ent()->idcmp(*block_in.ent());
-                          });
-
   /*
    * A different block is currently tracked where the new block was seen, and
    * so the old block needs to be removed, as it is out of date information
@@ -111,15 +112,18 @@ dpo_store::block_update(dpo_entity<crepr::base_block3D> block_in) {
    * list) or not, in order to avoid transient assert() triggering during LOS
    * processing.
    */
-  if (it2 != range.end()) {
+  auto* at_loc = m_blocks.find(block_in.ent()->danchor2D());
+  if (nullptr != at_loc && !at_loc->ent()->idcmp(*block_in.ent())) {
     ER_TRACE("Remove old block%d@%s: new block%d found there",
-             it2->ent()->id().v(),
+             at_loc->ent()->id().v(),
              block_in.ent()->danchor2D().to_str().c_str(),
              block_in.ent()->id().v());
-    block_remove(it2->ent());
+    block_remove(at_loc->ent());
   }
 
-  if (range.end() != it1) { /* block is known */
+  /* lookup must be after the removal above, which can move objects around */
+  auto* known = m_blocks.find(block_in.ent()->id());
+  if (nullptr != known) { /* block is known */
     ER_TRACE("Known incoming block%d@%s",
              block_in.ent()->id().v(),
              block_in.ent()->danchor2D().to_str().c_str());
@@ -127,23 +131,24 @@ dpo_store::block_update(dpo_entity<crepr::base_block3D> block_in) {
      * Unless a given block's location has changed, there is no need to update
      * the state of the world.
      */
-    if (block_in.ent()->danchor2D() != it1->ent()->danchor2D()) {
+    if (block_in.ent()->danchor2D() != known->ent()->danchor2D()) {
       ER_TRACE("Block%d has moved: %s -> %s",
                block_in.ent()->id().v(),
-               it1->ent()->danchor2D().to_str().c_str(),
+               known->ent()->danchor2D().to_str().c_str(),
                block_in.ent()->danchor2D().to_str().c_str());
-      block_remove(it1->ent());
 
       /*
-       * it1 will point to new block after this, so we need to save the old
+       * known will not be valid after this, so we need to save the old
        * location beforehand.
        */
-      rmath::vector2z old_loc = it1->ent()->danchor2D();
+      rmath::vector2z old_loc = known->ent()->danchor2D();
+      block_remove(known->ent());
+
       ER_TRACE("Add block%d@%s (n_blocks=%zu)",
                block_in.ent()->id().v(),
                block_in.ent()->danchor2D().to_str().c_str(),
                m_blocks.size());
-      m_blocks.obj_add({ block_in.ent()->id(), std::move(block_in) });
+      m_blocks.obj_add(std::move(block_in));
 
       return update_res_t{ true, ekBLOCK_MOVED, old_loc };
     }
@@ -151,44 +156,98 @@ dpo_store::block_update(dpo_entity<crepr::base_block3D> block_in) {
      * Even if the block's location has not changed, if we have seen it again we
      * need to update its density.
      */
-    dp_block_map::value_type* known = m_blocks.find(block_in.ent()->id());
-    if (nullptr != known) {
-      known->density(block_in.density());
-      ER_TRACE("Update density of known block%d@%s to %f",
-               block_in.ent()->id().v(),
-               block_in.ent()->danchor2D().to_str().c_str(),
-               block_in.density().v());
-    }
+    m_blocks.density_update(*known, block_in.density());
+    ER_TRACE("Update density of known block%d@%s to %f",
+             block_in.ent()->id().v(),
+             block_in.ent()->danchor2D().to_str().c_str(),
+             block_in.density().v());
   } else { /* block is not known */
     ER_TRACE("Unknown incoming block%d", block_in.ent()->id().v());
-    m_blocks.obj_add({ block_in.ent()->id(), std::move(block_in) });
+    RCPPSW_UNUSED rtypes::type_uuid id = block_in.ent()->id();
+    RCPPSW_UNUSED rmath::vector2z loc = block_in.ent()->danchor2D();
+    if (!m_blocks.obj_add(std::move(block_in))) {
+      ER_TRACE("Reject block%d@%s: store full of higher density blocks",
+               id.v(),
+               loc.to_str().c_str());
+      return { false, ekNO_CHANGE, rmath::vector2z() };
+    }
     ER_TRACE("Add block%d@%s (n_blocks=%zu)",
-             block_in.ent()->id().v(),
-             block_in.ent()->danchor2D().to_str().c_str(),
+             id.v(),
+             loc.to_str().c_str(),
              m_blocks.size());
     return { true, ekNEW_BLOCK_ADDED, rmath::vector2z() };
   }
   return { false, ekNO_CHANGE, rmath::vector2z() };
 } /* block_update() */
 
-bool dpo_store::block_remove(crepr::base_block3D* const victim) {
-  auto range = m_blocks.const_values_range();
-  auto it = std::find_if(range.begin(), range.end(), [&](const auto& b) {
-    return b.ent()->idcmp(*victim);
-  });
-  if (it != range.end()) {
+bool dpo_store::block_remove(const crepr::base_block3D* const victim) {
+  auto* known = m_blocks.find(victim->id());
+  if (nullptr != known) {
     ER_TRACE("Removing block%d@%s",
              victim->id().v(),
              victim->danchor2D().to_str().c_str());
     if (1 == m_blocks.size()) {
-      m_last_block_loc = boost::make_optional(it->ent()->ranchor2D());
+      m_last_block_loc = boost::make_optional(known->ent()->ranchor2D());
     }
-    m_blocks.obj_remove(it->ent()->id());
+    m_blocks.obj_remove(known->ent()->id());
     return true;
   }
   return false;
 } /* block_remove() */
 
+bool dpo_store::block_density_refresh(const crepr::base_block3D* const block) {
+  auto* known = m_blocks.find(block->id());
+  if (nullptr == known || !known->ent()->dloccmp(*block)) {
+    return false;
+  }
+  m_blocks.density_update(*known, density_refreshed(known->density()));
+  return true;
+} /* block_density_refresh() */
+
+bool dpo_store::cache_density_refresh(const carepr::base_cache* const cache) {
+  auto* known = m_caches.find(cache->dcenter2D());
+  if (nullptr == known || known->ent()->id() != cache->id()) {
+    return false;
+  }
+  m_caches.density_update(*known, density_refreshed(known->density()));
+  return true;
+} /* cache_density_refresh() */
+
+crepr::pheromone_density
+dpo_store::density_refreshed(crepr::pheromone_density density) const {
+  /* same as for found blocks/caches which have not changed */
+  if (mc_repeat_deposit) {
+    density.pheromone_add(crepr::pheromone_density::kUNIT_QUANTITY);
+  } else {
+    density.pheromone_set(kNRD_MAX_PHEROMONE);
+  }
+  return density;
+} /* density_refreshed() */
+
+dpo_store::dpo_entity<crepr::base_block3D>
+dpo_store::block_snapshot(const crepr::base_block3D* const block,
+                          const crepr::pheromone_density& density) const {
+  if (nullptr != mc_snapshots) {
+    auto snap = mc_snapshots->block(block);
+    if (0 != snap.version) {
+      return { std::move(snap.ent), density, snap.version };
+    }
+  }
+  return { block->clone(), density };
+} /* block_snapshot() */
+
+dpo_store::dpo_entity<carepr::base_cache>
+dpo_store::cache_snapshot(const carepr::base_cache* const cache,
+                          const crepr::pheromone_density& density) const {
+  if (nullptr != mc_snapshots) {
+    auto snap = mc_snapshots->cache(cache);
+    if (0 != snap.version) {
+      return { std::move(snap.ent), density, snap.version };
+    }
+  }
+  return { cache->clone(), density };
+} /* cache_snapshot() */
+
 void dpo_store::decay_all(void) {
   m_blocks.decay_all();
   m_caches.decay_all();
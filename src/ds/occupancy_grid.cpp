@@ -23,6 +23,10 @@
  ******************************************************************************/
 #include "fordyca/ds/occupancy_grid.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "fordyca/events/cell2D_unknown.hpp"
 
 /*******************************************************************************
@@ -36,92 +40,244 @@ NS_START(fordyca, ds);
 occupancy_grid::occupancy_grid(const cspconfig::perception_config* c_config,
                                const std::string& robot_id)
     : ER_CLIENT_INIT("fordyca.ds.occupancy_grid"),
-      stacked_grid2D(rmath::vector2d(0.0, 0.0),
-                     c_config->occupancy_grid.dims,
-                     c_config->occupancy_grid.resolution,
-                     c_config->occupancy_grid.resolution),
       m_pheromone_repeat_deposit(c_config->pheromone.repeat_deposit),
-      m_robot_id(robot_id) {
-  ER_INFO("real=(%fx%f), discrete=(%zux%zu), resolution=%f",
+      m_pheromone_rho(c_config->pheromone.rho),
+      m_robot_id(robot_id),
+      m_resolution(c_config->occupancy_grid.resolution),
+      m_rdims(c_config->occupancy_grid.dims),
+      m_ddims(rmath::dvec2zvec(m_rdims, m_resolution.v())),
+      m_ytiles((m_ddims.y() + kTileDim - 1) / kTileDim),
+      m_tiles(((m_ddims.x() + kTileDim - 1) / kTileDim) * m_ytiles, nullptr),
+      m_cells(m_ddims.x(), m_ddims.y()) {
+  ER_INFO("real=(%fx%f), discrete=(%zux%zu), resolution=%f, tiles=%zu",
           xrsize(),
           yrsize(),
           xdsize(),
           ydsize(),
-          resolution().v());
-
-  for (uint i = 0; i < xdsize(); ++i) {
-    for (uint j = 0; j < ydsize(); ++j) {
-      cell_init(i, j, c_config->pheromone.rho);
-    } /* for(j..) */
-  } /* for(i..) */
+          resolution().v(),
+          m_tiles.size());
+  m_unknown_density.rho(m_pheromone_rho);
 }
 
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
+void occupancy_grid::cell_update(const rmath::vector2z& d,
+                                 cell_state_type state,
+                                 const rtypes::type_uuid& id) {
+  bool was_known = cell_state_type::ekUNKNOWN != cell_state(d);
+  bool is_known = cell_state_type::ekUNKNOWN != state;
+  m_cells.cell_update(d.x(), d.y(), state, id);
+
+  if (!was_known && is_known) {
+    ++m_known_cell_count;
+    ER_ASSERT(m_known_cell_count <= xdsize() * ydsize(),
+              "Known cell count (%u) >= arena dimensions (%zux%zu)",
+              m_known_cell_count,
+              xdsize(),
+              ydsize());
+  } else if (was_known && !is_known) {
+    ER_ASSERT(m_known_cell_count >= 1,
+              "Known cell count (%u) < 1 before cell@%s became unknown",
+              m_known_cell_count,
+              d.to_str().c_str());
+    --m_known_cell_count;
+  }
+} /* cell_update() */
+
 void occupancy_grid::update(void) {
-  uint xmax = xdsize();
-  uint ymax = ydsize();
-
-  for (uint i = 0; i < xmax; ++i) {
-    for (uint j = 0; j < ymax; ++j) {
-      access<kPheromone>(i, j).update();
-    } /* for(j..) */
-  } /* for(i..) */
-
-  for (uint i = 0; i < xmax; ++i) {
-    for (uint j = 0; j < ymax; ++j) {
-      cell_state_update(i, j);
-    } /* for(j..) */
-  } /* for(i..) */
+  ++m_timestep;
+
+  /*
+   * Cells modified during the last timestep may have had pheromone deposited
+   * or their density reset, so their predicted expiry is no longer valid.
+   */
+  for (size_t idx : m_touched) {
+    size_t i = idx / ydsize();
+    size_t j = idx % ydsize();
+    tile_alloc(i, j).touched.reset(tile_offset(i, j));
+    cell_state_update(i, j);
+  } /* for(idx..) */
+  m_touched.clear();
+
+  /*
+   * cell_state_update() always reschedules a cell strictly in the future, so
+   * this terminates.
+   */
+  while (!m_live.empty() && m_live.begin()->first <= m_timestep) {
+    size_t idx = m_live.begin()->second;
+    cell_state_update(idx / ydsize(), idx % ydsize());
+  } /* while(!m_live.empty()..) */
 } /* update() */
 
+crepr::pheromone_density occupancy_grid::density(
+    const rmath::vector2z& d) const {
+  const tile* t = tile_find(d.x(), d.y());
+  if (nullptr == t) {
+    return m_unknown_density;
+  }
+  size_t offset = tile_offset(d.x(), d.y());
+  crepr::pheromone_density density = pheromone_load(*t, offset);
+  pheromone_decay(density, m_timestep - t->synced[offset]);
+  return density;
+} /* density() */
+
+void occupancy_grid::pheromone_reset(const rmath::vector2z& d) {
+  tile& t = pheromone_touch(d.x(), d.y());
+  size_t offset = tile_offset(d.x(), d.y());
+  t.densities[offset] = 0.0F;
+  t.deposits[offset] = 0.0F;
+} /* pheromone_reset() */
+
+void occupancy_grid::pheromone_add(const rmath::vector2z& d, double quantity) {
+  tile& t = pheromone_touch(d.x(), d.y());
+  t.deposits[tile_offset(d.x(), d.y())] += static_cast<float>(quantity);
+} /* pheromone_add() */
+
+void occupancy_grid::pheromone_set(const rmath::vector2z& d, double value) {
+  tile& t = pheromone_touch(d.x(), d.y());
+  t.densities[tile_offset(d.x(), d.y())] = static_cast<float>(value);
+} /* pheromone_set() */
+
 void occupancy_grid::reset(void) {
-  uint xmax = xdsize();
-  uint ymax = ydsize();
-  for (uint i = 0; i < xmax; ++i) {
-    for (uint j = 0; j < ymax; ++j) {
-      access<kCell>(i, j).reset();
-    } /* for(j..) */
-  } /* for(i..) */
-} /* Reset */
-
-void occupancy_grid::cell_init(uint i, uint j, double pheromone_rho) {
-  access<kPheromone>(i, j).rho(pheromone_rho);
-  cds::cell2D& cell = access<kCell>(i, j);
-  cell.loc(rmath::vector2z(i, j));
-} /* cell_init() */
-
-void occupancy_grid::cell_state_update(uint i, uint j) {
-  crepr::pheromone_density& density = access<kPheromone>(i, j);
-  cds::cell2D& cell = access<kCell>(i, j);
+  m_cells.reset();
+
+  /*
+   * All cells are now UNKNOWN with zero density, so none of them can still be
+   * pending re-evaluation or scheduled to expire.
+   */
+  m_touched.clear();
+  m_live.clear();
+  m_known_cell_count = 0;
+  m_tile_pool.clear();
+  std::fill(m_tiles.begin(), m_tiles.end(), nullptr);
+} /* reset() */
+
+occupancy_grid::tile& occupancy_grid::tile_alloc(size_t i, size_t j) {
+  tile*& t = m_tiles[tile_index(i, j)];
+  if (nullptr == t) {
+    /*
+     * The timestep of the new tile's cells is irrelevant: their densities are
+     * 0, which stays 0 no matter how many decay steps are applied.
+     */
+    t = &m_tile_pool.emplace_back();
+    ER_TRACE("Allocated tile for cell@(%zu, %zu) for %s (%zu total)",
+             i,
+             j,
+             m_robot_id.c_str(),
+             m_tile_pool.size());
+  }
+  return *t;
+} /* tile_alloc() */
+
+crepr::pheromone_density occupancy_grid::pheromone_load(const tile& t,
+                                                        size_t offset) const {
+  crepr::pheromone_density density(m_pheromone_rho);
+  density.pheromone_set(t.densities[offset]);
+  density.pheromone_add(t.deposits[offset]);
+  return density;
+} /* pheromone_load() */
+
+void occupancy_grid::pheromone_sync(size_t i, size_t j) {
+  tile& t = tile_alloc(i, j);
+  size_t offset = tile_offset(i, j);
+  uint elapsed = m_timestep - t.synced[offset];
+  if (0 == elapsed) {
+    return;
+  }
+  crepr::pheromone_density density = pheromone_load(t, offset);
+  pheromone_decay(density, elapsed);
+  t.densities[offset] = static_cast<float>(density.v());
+  t.deposits[offset] = 0.0F;
+  t.synced[offset] = m_timestep;
+} /* pheromone_sync() */
+
+occupancy_grid::tile& occupancy_grid::pheromone_touch(size_t i, size_t j) {
+  pheromone_sync(i, j);
+  tile& t = tile_alloc(i, j);
+  size_t offset = tile_offset(i, j);
+  if (!t.touched.test(offset)) {
+    t.touched.set(offset);
+    m_touched.push_back(flat_index(i, j));
+  }
+  return t;
+} /* pheromone_touch() */
+
+void occupancy_grid::pheromone_decay(crepr::pheromone_density& density,
+                                     uint elapsed) const {
+  if (0 == elapsed) {
+    return;
+  }
+  /*
+   * The first step applies any pheromone deposited since the last sync along
+   * with the decay; the remaining steps are pure exponential decay, and can be
+   * applied in closed form.
+   */
+  density.update();
+  if (elapsed > 1) {
+    density.pheromone_set(density.v() *
+                          std::pow(1.0 - m_pheromone_rho, elapsed - 1));
+  }
+} /* pheromone_decay() */
+
+uint occupancy_grid::pheromone_ttl(double v) const {
+  double decay = 1.0 - m_pheromone_rho;
+  if (decay >= 1.0) { /* no decay--cell will never become unknown */
+    return 0;
+  } else if (decay <= 0.0) {
+    return 1;
+  }
+  auto steps = static_cast<uint>(
+      std::floor(std::log(kEPSILON / v) / std::log(decay)) + 1);
+  return std::max(1U, steps);
+} /* pheromone_ttl() */
+
+void occupancy_grid::cell_state_update(size_t i, size_t j) {
+  pheromone_sync(i, j);
+
+  tile& t = tile_alloc(i, j);
+  size_t offset = tile_offset(i, j);
+  double density = t.densities[offset];
+
+  if (0 != t.expires[offset]) {
+    m_live.erase({ t.expires[offset], flat_index(i, j) });
+    t.expires[offset] = 0;
+  }
 
   if (!m_pheromone_repeat_deposit) {
-    ER_ASSERT(density.v() <= 1.0,
-              "Repeat pheromone deposit detected for cell@(%u, %u) (%f > "
+    ER_ASSERT(density <= 1.0,
+              "Repeat pheromone deposit detected for cell@(%zu, %zu) (%f > "
               "1.0, state=%d)",
               i,
               j,
-              density.v(),
-              cell.fsm().current_state());
+              density,
+              static_cast<int>(m_cells.cell_state(i, j)));
   }
 
   /*
-   * If the cell state is already unknown, don't resend the event. Doesn't
-   * matter for just a few robots, but it does when you have hundreds. We could
-   * also check if the cell state is known, but that is slower than checking if
-   * the density has already been reset.
+   * If the density has already been reset (e.g. the cell is known to be
+   * empty), then there is nothing to decay, and the cell is not live.
    */
-  if (density.v() < kEPSILON &&
-      density.v() > std::numeric_limits<double>::min()) {
-    ER_TRACE("Relevance of cell(%u, %u) is within %f of 0 for %s",
+  if (density <= std::numeric_limits<float>::min()) {
+    return;
+  }
+
+  if (density < kEPSILON) {
+    ER_TRACE("Relevance of cell(%zu, %zu) is within %f of 0 for %s",
              i,
              j,
              kEPSILON,
              m_robot_id.c_str());
-    events::cell2D_unknown_visitor op(cell.loc());
+    events::cell2D_unknown_visitor op(rmath::vector2z(i, j));
     op.visit(*this);
-    density.reset();
+    t.densities[offset] = 0.0F;
+    return;
+  }
+
+  uint ttl = pheromone_ttl(density);
+  if (0 != ttl) {
+    t.expires[offset] = m_timestep + ttl;
+    m_live.insert({ t.expires[offset], flat_index(i, j) });
   }
 } /* cell_state_update() */
 
@@ -0,0 +1,160 @@
+/**
+ * \file oracle_knowledge.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/ds/oracle_knowledge.hpp"
+
+#include <algorithm>
+
+#include "cosm/arena/caching_arena_map.hpp"
+#include "cosm/arena/repr/arena_cache.hpp"
+#include "cosm/repr/base_block3D.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, ds);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void oracle_knowledge::rebuild(carena::caching_arena_map* const map) {
+  m_blocks.clear();
+  m_caches.clear();
+  m_block_slots.clear();
+  m_cache_slots.clear();
+  m_arena_blocks.clear();
+  m_cached_blocks.clear();
+  m_cache_blocks.clear();
+  m_cache_centers.clear();
+
+  for (auto* c : map->caches()) {
+    slot_add(&m_caches, &m_cache_slots, c);
+    auto& ids = m_cache_blocks[c->id().v()];
+    for (const auto* b : c->blocks()) {
+      ids.push_back(b->id().v());
+      m_cached_blocks[b->id().v()] = c->id().v();
+    } /* for(*b..) */
+    m_cache_centers[cell_key(c->dcenter2D())] = c->id().v();
+  } /* for(*c..) */
+
+  for (auto* b : map->blocks()) {
+    m_arena_blocks[b->id().v()] = b;
+    if (!b->is_out_of_sight() &&
+        m_cached_blocks.end() == m_cached_blocks.find(b->id().v())) {
+      slot_add(&m_blocks, &m_block_slots, b);
+    }
+  } /* for(*b..) */
+  m_stale = false;
+
+  ER_DEBUG("Rebuilt: n_free_blocks=%zu,n_caches=%zu",
+           m_blocks.size(),
+           m_caches.size());
+} /* rebuild() */
+
+rtypes::type_uuid oracle_knowledge::block_pickup(const rtypes::type_uuid& id) {
+  auto it = m_cached_blocks.find(id.v());
+  if (m_cached_blocks.end() == it) {
+    slot_remove(&m_blocks, &m_block_slots, id);
+    return rtypes::constants::kNoUUID;
+  }
+  rtypes::type_uuid cache_id(it->second);
+  m_cached_blocks.erase(it);
+
+  auto& ids = m_cache_blocks[cache_id.v()];
+  ids.erase(std::remove(ids.begin(), ids.end(), id.v()), ids.end());
+  return cache_id;
+} /* block_pickup() */
+
+void oracle_knowledge::block_drop(const rtypes::type_uuid& id) {
+  auto it = m_arena_blocks.find(id.v());
+  if (m_arena_blocks.end() == it) {
+    ER_WARN("Dropped block%d unknown: invalidating", id.v());
+    m_stale = true;
+    return;
+  }
+  auto* block = it->second;
+  if (block->is_out_of_sight()) {
+    return;
+  }
+  auto center = m_cache_centers.find(cell_key(block->danchor2D()));
+  if (m_cache_centers.end() != center &&
+      m_cache_slots.end() != m_cache_slots.find(center->second)) {
+    m_cached_blocks[id.v()] = center->second;
+    m_cache_blocks[center->second].push_back(id.v());
+  } else {
+    slot_add(&m_blocks, &m_block_slots, block);
+  }
+} /* block_drop() */
+
+void oracle_knowledge::cache_depleted(const rtypes::type_uuid& id) {
+  auto slot = m_cache_slots.find(id.v());
+  if (m_cache_slots.end() == slot) {
+    return;
+  }
+  /*
+   * The cache has already been removed from the arena, so it cannot be
+   * dereferenced to find its center; the stale center entry is ignored in
+   * \ref block_drop(), and cleared by the rebuild that cache creation causes.
+   */
+  slot_remove(&m_caches, &m_cache_slots, id);
+
+  /* whatever was left in the cache is now a free block */
+  for (int block_id : m_cache_blocks[id.v()]) {
+    m_cached_blocks.erase(block_id);
+    auto it = m_arena_blocks.find(block_id);
+    if (m_arena_blocks.end() != it && !it->second->is_out_of_sight()) {
+      slot_add(&m_blocks, &m_block_slots, it->second);
+    }
+  } /* for(block_id..) */
+  m_cache_blocks.erase(id.v());
+} /* cache_depleted() */
+
+template <typename TVector>
+void oracle_knowledge::slot_add(TVector* const vec,
+                                std::unordered_map<int, size_t>* const slots,
+                                typename TVector::value_type entity) {
+  if (slots->end() != slots->find(entity->id().v())) {
+    return;
+  }
+  (*slots)[entity->id().v()] = vec->size();
+  vec->push_back(entity);
+} /* slot_add() */
+
+template <typename TVector>
+void oracle_knowledge::slot_remove(TVector* const vec,
+                                   std::unordered_map<int, size_t>* const slots,
+                                   const rtypes::type_uuid& id) {
+  auto it = slots->find(id.v());
+  if (slots->end() == it) {
+    return;
+  }
+  size_t slot = it->second;
+  slots->erase(it);
+  if (slot != vec->size() - 1) {
+    (*vec)[slot] = vec->back();
+    (*slots)[(*vec)[slot]->id().v()] = slot;
+  }
+  vec->pop_back();
+} /* slot_remove() */
+
+NS_END(ds, fordyca);
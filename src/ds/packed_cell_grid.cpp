@@ -0,0 +1,77 @@
+/**
+ * \file packed_cell_grid.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/ds/packed_cell_grid.hpp"
+
+#include <algorithm>
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, ds);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+packed_cell_grid::packed_cell_grid(size_t xdsize, size_t ydsize)
+    : ER_CLIENT_INIT("fordyca.ds.packed_cell_grid"),
+      m_ytiles((ydsize + kTileDim - 1) / kTileDim),
+      m_tiles(((xdsize + kTileDim - 1) / kTileDim) * m_ytiles, nullptr) {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void packed_cell_grid::cell_update(size_t i,
+                                   size_t j,
+                                   state s,
+                                   const rtypes::type_uuid& id) {
+  bool has_entity = (state::ekHAS_BLOCK == s || state::ekHAS_CACHE == s);
+  ER_ASSERT(has_entity == (rtypes::constants::kNoUUID != id),
+            "Cell@(%zu, %zu) in state %d cannot contain entity%d",
+            i,
+            j,
+            static_cast<int>(s),
+            id.v());
+  tile*& t = m_tiles[tile_index(i, j)];
+
+  /* unallocated tiles are all UNKNOWN */
+  if (nullptr == t) {
+    if (state::ekUNKNOWN == s) {
+      return;
+    }
+    t = &m_tile_pool.emplace_back();
+  }
+  size_t offset = tile_offset(i, j);
+  size_t shift = (offset & 0x3) << 1;
+  t->states[offset >> 2] =
+      static_cast<uint8_t>((t->states[offset >> 2] & ~(0x3 << shift)) |
+                           (static_cast<uint8_t>(s) << shift));
+  t->ids[offset] = id.v();
+} /* cell_update() */
+
+void packed_cell_grid::reset(void) {
+  std::fill(m_tiles.begin(), m_tiles.end(), nullptr);
+  m_tile_pool.clear();
+} /* reset() */
+
+NS_END(ds, fordyca);
@@ -24,7 +24,6 @@
 #include "fordyca/events/block_found.hpp"
 
 #include "cosm/arena/repr/base_cache.hpp"
-#include "cosm/ds/operations/cell2D_empty.hpp"
 #include "cosm/repr/base_block3D.hpp"
 #include "cosm/repr/pheromone_density.hpp"
 
@@ -62,16 +61,10 @@ void block_found::visit(ds::dpo_store& store) {
    * If the cell in the arena that we thought contained a cache now contains a
    * block, remove the out-of-date cache.
    */
-  auto it = store.caches().values_range().begin();
-  while (it != store.caches().values_range().end()) {
-    if (m_block->danchor2D() == it->ent()->dcenter2D()) {
-      carepr::base_cache* tmp = (*it).ent();
-      ++it;
-      store.cache_remove(tmp);
-    } else {
-      ++it;
-    }
-  } /* while(it..) */
+  auto* stale = store.caches().find(m_block->danchor2D());
+  if (nullptr != stale) {
+    store.cache_remove(stale->ent());
+  }
 
   crepr::pheromone_density density(store.pheromone_rho());
   auto* known = store.find(m_block);
@@ -106,8 +99,7 @@ void block_found::visit(ds::dpo_store& store) {
     density.pheromone_set(ds::dpo_store::kNRD_MAX_PHEROMONE);
   }
 
-  store.block_update(
-      repr::dpo_entity<crepr::base_block3D>(m_block->clone(), density));
+  store.block_update(store.block_snapshot(m_block, density));
 } /* visit() */
 
 /*******************************************************************************
@@ -131,18 +123,6 @@ void block_found::visit(cfsm::cell2D_fsm& fsm) {
 } /* visit() */
 
 void block_found::visit(ds::dpo_semantic_map& map) {
-  cds::cell2D& cell = map.access<occupancy_grid::kCell>(x(), y());
-  crepr::pheromone_density& density =
-      map.access<occupancy_grid::kPheromone>(x(), y());
-
-  if (!cell.state_is_known()) {
-    map.known_cells_inc();
-    ER_ASSERT(map.known_cell_count() <= map.xdsize() * map.ydsize(),
-              "Known cell count (%u) >= arena dimensions (%zux%zu)",
-              map.known_cell_count(),
-              map.xdsize(),
-              map.ydsize());
-  }
   /*
    * If the cell is currently in a HAS_CACHE state, then that means that this
    * cell is coming back into our LOS with a block, when it contained a cache
@@ -151,8 +131,9 @@ void block_found::visit(ds::dpo_semantic_map& map) {
    * The density needs to be reset as well, as we are now tracking a different
    * kind of cell entity.
    */
-  if (cell.state_has_cache()) {
-    map.cache_remove(cell.cache());
+  auto* stale = map.cell_cache(coord());
+  if (nullptr != stale) {
+    map.cache_remove(stale->ent());
   }
 
   /*
@@ -160,47 +141,46 @@ void block_found::visit(ds::dpo_semantic_map& map) {
    * the one we just found that actually resides there are not the same, we need
    * to reset the density for the cell, and start a new decay count.
    */
-  if (cell.state_has_block() && cell.block3D()->id() != m_block->id()) {
-    density.reset();
+  if (occupancy_grid::cell_state_type::ekHAS_BLOCK == map.cell_state(coord()) &&
+      map.cell_entity(coord()) != m_block->id()) {
+    map.pheromone_reset(coord());
   }
 
   pheromone_update(map);
 
-  ER_ASSERT(cell.state_has_block(),
+  ER_ASSERT(occupancy_grid::cell_state_type::ekHAS_BLOCK ==
+                map.cell_state(coord()),
             "Cell@%s not in HAS_BLOCK",
-            cell.loc().to_str().c_str());
-  ER_ASSERT(cell.block3D()->id() == m_block->id(),
+            coord().to_str().c_str());
+  ER_ASSERT(map.cell_entity(coord()) == m_block->id(),
             "Block for cell@%s ID mismatch: %d/%d",
-            cell.loc().to_str().c_str(),
+            coord().to_str().c_str(),
             m_block->id().v(),
-            cell.block3D()->id().v());
+            map.cell_entity(coord()).v());
 } /* visit() */
 
 void block_found::pheromone_update(ds::dpo_semantic_map& map) {
-  crepr::pheromone_density& density =
-      map.access<occupancy_grid::kPheromone>(x(), y());
-  cds::cell2D& cell = map.access<occupancy_grid::kCell>(x(), y());
   if (map.pheromone_repeat_deposit()) {
-    density.pheromone_add(crepr::pheromone_density::kUNIT_QUANTITY);
+    map.pheromone_add(coord(), crepr::pheromone_density::kUNIT_QUANTITY);
   } else {
     /*
      * Seeing a new block on empty square or one that used to contain a cache.
      */
-    if (!cell.state_has_block()) {
-      density.reset();
-      density.pheromone_add(crepr::pheromone_density::kUNIT_QUANTITY);
+    if (occupancy_grid::cell_state_type::ekHAS_BLOCK !=
+        map.cell_state(coord())) {
+      map.pheromone_reset(coord());
+      map.pheromone_add(coord(), crepr::pheromone_density::kUNIT_QUANTITY);
     } else { /* Seeing a known block again--set its relevance to the max */
-      density.pheromone_set(ds::dpo_store::kNRD_MAX_PHEROMONE);
+      map.pheromone_set(coord(), ds::dpo_store::kNRD_MAX_PHEROMONE);
     }
   }
   /*
    * ONLY if the underlying DPO store actually changed do we update what block
-   * the cell points to. If we do it unconditionally, we are left
-   * with dangling references as a result of mixing unique_ptr and raw ptr. See
-   * FORDYCA#229.
+   * the cell points to, so that the cell never refers to a block the store
+   * does not track. See FORDYCA#229.
    */
   auto res = map.store()->block_update(
-      repr::dpo_entity<crepr::base_block3D>(m_block->clone(), density));
+      map.store()->block_snapshot(m_block, map.density(coord())));
   if (res.status) {
     if (ds::dpo_store::update_status::ekBLOCK_MOVED == res.reason) {
       ER_DEBUG("Updating cell@%s: Block%d moved %s -> %s",
@@ -208,8 +188,7 @@ void block_found::pheromone_update(ds::dpo_semantic_map& map) {
                m_block->id().v(),
                res.old_loc.to_str().c_str(),
                m_block->danchor2D().to_str().c_str());
-      cdops::cell2D_empty_visitor op(res.old_loc);
-      op.visit(map.access<occupancy_grid::kCell>(res.old_loc));
+      map.cell_update(res.old_loc, occupancy_grid::cell_state_type::ekEMPTY);
     } else {
       ER_ASSERT(ds::dpo_store::update_status::ekNEW_BLOCK_ADDED == res.reason,
                 "Bad reason for DPO store update: %d",
@@ -221,7 +200,9 @@ void block_found::pheromone_update(ds::dpo_semantic_map& map) {
      * host cell has been updated and the block updated in the store, so we are
      * good to update the NEW host cell to point to the block.
      */
-    visit(cell);
+    map.cell_update(coord(),
+                    occupancy_grid::cell_state_type::ekHAS_BLOCK,
+                    m_block->id());
   }
 } /* pheromone_update() */
 
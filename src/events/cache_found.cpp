@@ -23,6 +23,8 @@
  ******************************************************************************/
 #include "fordyca/events/cache_found.hpp"
 
+#include <list>
+
 #include "cosm/arena/repr/base_cache.hpp"
 
 #include "fordyca/controller/cognitive/d2/birtd_dpo_controller.hpp"
@@ -32,7 +34,6 @@
 #include "fordyca/controller/cognitive/dpo_perception_subsystem.hpp"
 #include "fordyca/controller/cognitive/mdpo_perception_subsystem.hpp"
 #include "fordyca/ds/dpo_semantic_map.hpp"
-#include "fordyca/events/cell2D_empty.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -63,19 +64,20 @@ void cache_found::visit(ds::dpo_store& store) {
    * a new cache there, we are tracking blocks that no longer exist in the
    * arena.
    */
-  auto it = store.blocks().values_range().begin();
-  while (it != store.blocks().values_range().end()) {
-    if (m_cache->contains_point2D(it->ent()->rcenter2D())) {
-      crepr::base_block3D* tmp = (*it).ent();
-      ++it;
+  std::list<const crepr::base_block3D*> rms;
+  for (auto&& b : store.blocks().values_range()) {
+    if (m_cache->contains_point2D(b.ent()->rcenter2D())) {
       ER_TRACE("Remove block%d hidden behind cache%d",
-               tmp->id().v(),
+               b.ent()->id().v(),
                m_cache->id().v());
-      store.block_remove(tmp);
-    } else {
-      ++it;
+      rms.push_back(b.ent());
     }
-  } /* while(it..) */
+  } /* for(&&b..) */
+
+  /* removal must be after iteration, as it moves objects in the store */
+  for (auto* b : rms) {
+    store.block_remove(b);
+  } /* for(*b..) */
 
   auto* known = store.find(m_cache);
   crepr::pheromone_density density(store.pheromone_rho());
@@ -95,8 +97,7 @@ void cache_found::visit(ds::dpo_store& store) {
     density.pheromone_set(ds::dpo_store::kNRD_MAX_PHEROMONE);
   }
 
-  auto ent = ds::dp_cache_map::value_type(m_cache->clone(), density);
-  store.cache_update(std::move(ent));
+  store.cache_update(store.cache_snapshot(m_cache, density));
 } /* visit() */
 
 /*******************************************************************************
@@ -142,18 +143,6 @@ void cache_found::visit(cfsm::cell2D_fsm& fsm) {
 } /* visit() */
 
 void cache_found::visit(ds::dpo_semantic_map& map) {
-  cds::cell2D& cell = map.access<occupancy_grid::kCell>(x(), y());
-  crepr::pheromone_density& density =
-      map.access<occupancy_grid::kPheromone>(x(), y());
-  if (!cell.state_is_known()) {
-    map.known_cells_inc();
-    ER_ASSERT(map.known_cell_count() <= map.xdsize() * map.ydsize(),
-              "Known cell count (%u) >= arena dimensions (%zux%zu)",
-              map.known_cell_count(),
-              map.xdsize(),
-              map.ydsize());
-  }
-
   /**
    * Remove any and all blocks from the known blocks list that exist in
    * the same space that a cache occupies.
@@ -164,7 +153,7 @@ void cache_found::visit(ds::dpo_semantic_map& map) {
    * created. When we return to the arena and find a new cache there, we are
    * tracking blocks that no longer exist in our perception.
    */
-  std::list<crepr::base_block3D*> rms;
+  std::list<const crepr::base_block3D*> rms;
   for (auto&& b : map.blocks().values_range()) {
     if (m_cache->contains_point2D(b.ent()->rcenter2D())) {
       ER_TRACE("Remove block%d hidden behind cache%d",
@@ -174,22 +163,19 @@ void cache_found::visit(ds::dpo_semantic_map& map) {
     }
   } /* for(&&b..) */
 
+  /* removing a block from the map also empties its host cell */
   for (auto&& b : rms) {
-    cdops::cell2D_empty_visitor op(b->danchor2D());
-    op.visit(map.access<occupancy_grid::kCell>(b->danchor2D()));
     map.block_remove(b);
   } /* for(&&b..) */
 
   /*
-   * If the cell is currently in a HAS_CACHE state, then that means that this
-   * cell is coming back into our LOS with a block, when it contained a cache
-   * the last time it was seen. Remove the cache/synchronize with reality.
-   *
-   * The density needs to be reset as well, as we are now tracking a different
-   * kind of cell entity.
+   * If the cell is currently in a HAS_BLOCK state, then that means that this
+   * cell is coming back into our LOS with a cache, when it contained a block
+   * the last time it was seen. Remove the block/synchronize with reality.
    */
-  if (cell.state_has_block()) {
-    map.block_remove(cell.block3D());
+  auto* stale = map.cell_block(coord());
+  if (nullptr != stale) {
+    map.block_remove(stale->ent());
   }
 
   /*
@@ -197,21 +183,23 @@ void cache_found::visit(ds::dpo_semantic_map& map) {
    * the one we just found that actually resides there are not the same, we need
    * to reset the density for the cell, and start a new decay count.
    */
-  if (cell.state_has_cache() && cell.cache()->id() != m_cache->id()) {
-    density.reset();
+  bool has_cache =
+      occupancy_grid::cell_state_type::ekHAS_CACHE == map.cell_state(coord());
+  if (has_cache && map.cell_entity(coord()) != m_cache->id()) {
+    map.pheromone_reset(coord());
   }
 
   if (map.pheromone_repeat_deposit()) {
-    density.pheromone_add(crepr::pheromone_density::kUNIT_QUANTITY);
+    map.pheromone_add(coord(), crepr::pheromone_density::kUNIT_QUANTITY);
   } else {
     /*
      * Seeing a new cache on empty square or one that used to contain a block.
      */
-    if (!cell.state_has_cache()) {
-      density.reset();
-      density.pheromone_add(crepr::pheromone_density::kUNIT_QUANTITY);
+    if (!has_cache) {
+      map.pheromone_reset(coord());
+      map.pheromone_add(coord(), crepr::pheromone_density::kUNIT_QUANTITY);
     } else { /* Seeing a known cache again--set its relevance to the max */
-      density.pheromone_set(ds::dpo_store::kNRD_MAX_PHEROMONE);
+      map.pheromone_set(coord(), ds::dpo_store::kNRD_MAX_PHEROMONE);
     }
   }
   /*
@@ -224,11 +212,15 @@ void cache_found::visit(ds::dpo_semantic_map& map) {
    * more of its cache references be invalid due to other robots causing
    * caches to be created/destroyed.
    *
-   * Cloning is definitely necessary here.
+   * Cloning (or sharing an immutable snapshot of the cache as of this
+   * timestep) is definitely necessary here. The cell only records the ID of
+   * the cache; the number of blocks in it is read from the snapshot.
    */
-  auto ent = ds::dp_cache_map::value_type(m_cache->clone(), density);
-  map.store()->cache_update(std::move(ent));
-  visit(cell);
+  map.store()->cache_update(
+      map.store()->cache_snapshot(m_cache, map.density(coord())));
+  map.cell_update(coord(),
+                  occupancy_grid::cell_state_type::ekHAS_CACHE,
+                  m_cache->id());
 } /* visit() */
 
 /*******************************************************************************
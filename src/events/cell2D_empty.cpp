@@ -36,17 +36,8 @@ using ds::occupancy_grid;
  * Member Functions
  ******************************************************************************/
 void cell2D_empty::visit(ds::occupancy_grid& grid) {
-  cds::cell2D& cell = grid.access<occupancy_grid::kCell>(x(), y());
-  if (!cell.state_is_known()) {
-    grid.known_cells_inc();
-  }
-  ER_ASSERT(grid.known_cell_count() <= grid.xdsize() * grid.ydsize(),
-            "Known cell count (%u) >= arena dimensions (%zux%zu)",
-            grid.known_cell_count(),
-            grid.xdsize(),
-            grid.ydsize());
-  grid.access<occupancy_grid::kPheromone>(x(), y()).reset();
-  visit(cell);
+  grid.cell_update(coord(), occupancy_grid::cell_state_type::ekEMPTY);
+  grid.pheromone_reset(coord());
 } /* visit() */
 
 void cell2D_empty::visit(ds::dpo_semantic_map& map) {
@@ -35,16 +35,7 @@ using ds::occupancy_grid;
  * Member Functions
  ******************************************************************************/
 void cell2D_unknown::visit(ds::occupancy_grid& grid) {
-  cds::cell2D& cell = grid.access<occupancy_grid::kCell>(x(), y());
-
-  if (cell.state_is_known()) {
-    ER_ASSERT(grid.known_cell_count() >= 1,
-              "Known cell count (%u) < 1 before event",
-              grid.known_cell_count());
-
-    grid.known_cells_dec();
-  }
-  visit(cell);
+  grid.cell_update(coord(), occupancy_grid::cell_state_type::ekUNKNOWN);
 } /* visit() */
 
 NS_END(detail, events, fordyca);
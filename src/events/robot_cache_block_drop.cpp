@@ -104,7 +104,18 @@ bool robot_cache_block_drop::dispatch_d2_cache_interactor(
  * Depth1 Foraging
  ******************************************************************************/
 void robot_cache_block_drop::visit(ds::dpo_semantic_map& map) {
-  visit(map.access<occupancy_grid::kCell>(x(), y()));
+  /*
+   * The cell only records which cache it contains; the number of blocks in the
+   * cache is tracked by the cache itself.
+   */
+  ER_ASSERT(occupancy_grid::cell_state_type::ekHAS_CACHE ==
+                map.cell_state(coord()),
+            "Cell@%s does not contain a cache",
+            rcppsw::to_string(coord()).c_str());
+  ER_ASSERT(m_cache->id() == map.cell_entity(coord()),
+            "Drop/cell cache mismatch: %d vs %d",
+            m_cache->id().v(),
+            map.cell_entity(coord()).v());
 } /* visit() */
 
 void robot_cache_block_drop::visit(cds::cell2D& cell) {
@@ -156,8 +156,14 @@ void robot_cached_block_pickup::visit(ds::dpo_store& store) {
     return;
   }
 
+  /*
+   * The tracked cache may be a snapshot shared with other robots, so we need
+   * our own copy before modifying it. A depleted cache is just removed, so
+   * there is no need to copy it first.
+   */
   if (pcache->ent()->n_blocks() > base_cache::kMinBlocks) {
-    pcache->ent()->block_remove(block());
+    pcache->ent_detach()->block_remove(block());
+    store.caches().obj_modified();
     ER_INFO("DPO Store: fb%u: block%d from cache%d@%s,remaining=[%s] (%zu)",
             robot_id().v(),
             block()->id().v(),
@@ -168,7 +174,6 @@ void robot_cached_block_pickup::visit(ds::dpo_store& store) {
 
   } else {
     RCPPSW_UNUSED rtypes::type_uuid id = pcache->ent()->id();
-    pcache->ent()->block_remove(block());
     store.cache_remove(pcache->ent());
     ER_INFO("DPO Store: fb%u: block%d from cache%d@%s [depleted]",
             robot_id().v(),
@@ -179,41 +184,41 @@ void robot_cached_block_pickup::visit(ds::dpo_store& store) {
 } /* visit() */
 
 void robot_cached_block_pickup::visit(ds::dpo_semantic_map& map) {
-  cds::cell2D& cell = map.access<occupancy_grid::kCell>(cell2D_op::coord());
-  ER_ASSERT(cell.state_has_cache(), "Cell does not contain cache");
-  ER_ASSERT(cell.cache()->n_blocks() == cell.block_count(),
-            "Perceived cache/cell disagree on # of blocks: "
-            "cache=%zu/cell=%zu",
-            cell.cache()->n_blocks(),
-            cell.block_count());
-
-  ER_ASSERT(cell.cache()->contains_block(block()),
+  auto* pcache = map.cell_cache(coord());
+  ER_ASSERT(nullptr != pcache,
+            "Cell@%s does not contain cache",
+            rcppsw::to_string(coord()).c_str());
+  ER_ASSERT(pcache->ent()->contains_block(block()),
             "Perceived cache%d@%s/%s does not contain pickup block%d",
-            cell.cache()->id().v(),
-            rcppsw::to_string(cell.cache()->rcenter2D()).c_str(),
-            rcppsw::to_string(cell.cache()->dcenter2D()).c_str(),
+            pcache->ent()->id().v(),
+            rcppsw::to_string(pcache->ent()->rcenter2D()).c_str(),
+            rcppsw::to_string(pcache->ent()->dcenter2D()).c_str(),
             block()->id().v());
 
-  if (cell.cache()->n_blocks() > base_cache::kMinBlocks) {
-    cell.cache()->block_remove(block());
-    visit(cell);
-    ER_ASSERT(cell.state_has_cache(),
+  /*
+   * The tracked cache may be a snapshot shared with other robots, so we need
+   * our own copy before modifying it. A depleted cache is just removed, so
+   * there is no need to copy it first.
+   */
+  if (pcache->ent()->n_blocks() > base_cache::kMinBlocks) {
+    pcache->ent_detach()->block_remove(block());
+    map.caches().obj_modified();
+    ER_ASSERT(occupancy_grid::cell_state_type::ekHAS_CACHE ==
+                  map.cell_state(coord()),
               "cell@%s with >= 2 blocks does not have cache",
               rcppsw::to_string(coord()).c_str());
 
     ER_INFO("DPO Map: fb%u: block%d from cache%d@%s,remaining=[%s] (%zu)",
             robot_id().v(),
             block()->id().v(),
-            cell.cache()->id().v(),
+            pcache->ent()->id().v(),
             rcppsw::to_string(coord()).c_str(),
-            rcppsw::to_string(cell.cache()->blocks()).c_str(),
-            cell.cache()->n_blocks());
+            rcppsw::to_string(pcache->ent()->blocks()).c_str(),
+            pcache->ent()->n_blocks());
 
   } else {
-    RCPPSW_UNUSED rtypes::type_uuid id = cell.cache()->id();
-    cell.cache()->block_remove(block());
-
-    map.cache_remove(cell.cache());
+    RCPPSW_UNUSED rtypes::type_uuid id = pcache->ent()->id();
+    map.cache_remove(pcache->ent());
     ER_INFO("DPO Map: fb%u: block%d from cache%d@%s [depleted]",
             robot_id().v(),
             block()->id().v(),
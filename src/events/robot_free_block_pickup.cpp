@@ -156,19 +156,12 @@ void robot_free_block_pickup::visit(ds::dpo_store& store) {
 } /* visit() */
 
 void robot_free_block_pickup::visit(ds::dpo_semantic_map& map) {
-  cds::cell2D& cell =
-      map.access<occupancy_grid::kCell>(cell2D_op::x(), cell2D_op::y());
-
-  ER_ASSERT(block()->danchor2D() == cell.loc(),
+  ER_ASSERT(block()->danchor2D() == cell2D_op::coord(),
             "Coordinates for block%d@%s/cell@%s do not agree",
             block()->id().v(),
             rcppsw::to_string(block()->danchor2D()).c_str(),
-            rcppsw::to_string(cell.loc()).c_str());
+            rcppsw::to_string(cell2D_op::coord()).c_str());
 
-  ER_ASSERT(block()->id() == cell.block3D()->id(),
-            "Pickup/cell block mismatch: %d vs %d",
-            block()->id().v(),
-            cell.block3D()->id().v());
   /*
    * @bug: This should just be an assert. However, due to FORDYCA#242, the fact
    * that blocks can appear close to the wall, and FORDYCA#82, this may not
@@ -178,9 +171,14 @@ void robot_free_block_pickup::visit(ds::dpo_semantic_map& map) {
    * to drive over a block. In that case the block is not in its LOS (BUG!), or
    * in its occupancy grid, and hence the assertion failure here.
    */
-  /* ER_ASSERT(cell.state_has_block(), "cell does not contain block"); */
-  if (cell.state_has_block()) {
-    map.block_remove(cell.block3D());
+  /* ER_ASSERT(cell has block, "cell does not contain block"); */
+  auto* known = map.cell_block(cell2D_op::coord());
+  if (nullptr != known) {
+    ER_ASSERT(block()->id() == known->ent()->id(),
+              "Pickup/cell block mismatch: %d vs %d",
+              block()->id().v(),
+              known->ent()->id().v());
+    map.block_remove(known->ent());
   }
 } /* visit() */
 
@@ -26,6 +26,7 @@
 #include "cosm/arena/repr/base_cache.hpp"
 #include "cosm/subsystem/saa_subsystemQ3D.hpp"
 
+#include "fordyca/controller/cognitive/cache_sel_matrix.hpp"
 #include "fordyca/ds/dpo_store.hpp"
 #include "fordyca/fsm/arrival_tol.hpp"
 #include "fordyca/fsm/cache_acq_point_selector.hpp"
@@ -91,7 +92,8 @@ acquire_existing_cache_fsm::acquire_existing_cache_fsm(
                             std::placeholders::_2)) }),
       mc_for_pickup(for_pickup),
       mc_matrix(c_params->csel_matrix),
-      mc_store(c_params->store) {}
+      mc_store(c_params->store),
+      m_memo(mc_store, c_params->memo_counts, c_params->memo_resolution) {}
 
 /*******************************************************************************
  * Non-Member Functions
@@ -106,11 +108,7 @@ acquire_existing_cache_fsm::acq_goal_internal(void) {
  ******************************************************************************/
 boost::optional<acquire_existing_cache_fsm::acq_loc_type>
 acquire_existing_cache_fsm::calc_acq_location(void) {
-  existing_cache_selector selector(mc_for_pickup, mc_matrix, &mc_store->caches());
-
-  if (const auto* best = selector(mc_store->caches(),
-                                  saa()->sensing()->rpos2D(),
-                                  saa()->sensing()->tick())) {
+  if (const auto* best = cache_select()) {
     ER_INFO("Selected existing cache%d@%s/%s for acquisition",
             best->id().v(),
             rcppsw::to_string(best->rcenter2D()).c_str(),
@@ -129,6 +127,37 @@ acquire_existing_cache_fsm::calc_acq_location(void) {
   }
 } /* calc_acq_location() */
 
+const carepr::base_cache* acquire_existing_cache_fsm::cache_select(void) {
+  auto select = [&]() {
+    existing_cache_selector selector(
+        mc_for_pickup, mc_matrix, &mc_store->caches());
+    memo_type::computed res;
+    res.result = selector(mc_store->caches(),
+                          saa()->sensing()->rpos2D(),
+                          saa()->sensing()->tick());
+    res.decay_floor = selector.decay_floor();
+    return res;
+  };
+  if (!cache_select_memoizable()) {
+    return select().result;
+  }
+  /*
+   * The store epoch changes whenever a cache is removed from the store or
+   * modified, and the memo accounts for decay, so the memoized cache is still
+   * valid if the epoch has not changed.
+   */
+  const auto& exceptions = mc_for_pickup ? mc_matrix->pickup_exceptions()
+                                         : mc_matrix->drop_exceptions();
+  return m_memo(saa()->sensing()->rpos2D(), exceptions.version(), select);
+} /* cache_select() */
+
+bool acquire_existing_cache_fsm::cache_select_memoizable(void) const {
+  using cselm = controller::cognitive::cache_sel_matrix;
+  const auto& policy = mc_matrix->pickup_policy().policy;
+  return !(mc_for_pickup && (cselm::kPickupPolicyTime == policy ||
+                             cselm::kPickupPolicyCacheDuration == policy));
+} /* cache_select_memoizable() */
+
 boost::optional<csfsm::acquire_goal_fsm::candidate_type>
 acquire_existing_cache_fsm::existing_cache_select(void) {
   if (auto selection = calc_acq_location()) {
@@ -79,7 +79,8 @@ acquire_free_block_fsm::acquire_free_block_fsm(
                             std::placeholders::_1,
                             std::placeholders::_2)) }),
       mc_matrix(c_params->bsel_matrix),
-      mc_store(c_params->store) {}
+      mc_store(c_params->store),
+      m_memo(mc_store, c_params->memo_counts, c_params->memo_resolution) {}
 
 /*******************************************************************************
  * Member Functions
@@ -104,15 +105,21 @@ bool acquire_free_block_fsm::block_acquired_cb(bool explore_result) const {
 
 boost::optional<csfsm::acquire_goal_fsm::candidate_type>
 acquire_free_block_fsm::block_select(void) const {
-  controller::cognitive::block_selector selector(mc_matrix);
+  auto select = [&]() {
+    controller::cognitive::block_selector selector(mc_matrix);
 
-  if (const auto* best =
-          selector(mc_store->blocks(), saa()->sensing()->rpos2D())) {
-    return boost::make_optional(acquire_goal_fsm::candidate_type(
-        best->rcenter2D(), kBLOCK_ARRIVAL_TOL, best->id()));
-  } else {
-    return boost::optional<acquire_goal_fsm::candidate_type>();
-  }
+    memo_type::computed res;
+    if (const auto* best =
+            selector(mc_store->blocks(), saa()->sensing()->rpos2D())) {
+      res.result = boost::make_optional(acquire_goal_fsm::candidate_type(
+          best->rcenter2D(), kBLOCK_ARRIVAL_TOL, best->id()));
+    }
+    res.decay_floor = selector.decay_floor();
+    return res;
+  };
+  return m_memo(saa()->sensing()->rpos2D(),
+                mc_matrix->sel_exceptions().version(),
+                select);
 } /* block_select() */
 
 bool acquire_free_block_fsm::candidates_exist(void) const {
@@ -23,8 +23,6 @@
  ******************************************************************************/
 #include "fordyca/fsm/block_acq_validator.hpp"
 
-#include <numeric>
-
 #include "cosm/repr/base_block3D.hpp"
 
 #include "fordyca/controller/cognitive/block_sel_matrix.hpp"
@@ -60,27 +58,14 @@ bool block_acq_validator::operator()(const rmath::vector2d& loc,
             loc.to_str().c_str());
     return false;
   }
-  const auto& config = boost::get<config::block_sel::block_pickup_policy_config>(
-      mc_matrix->find(bselm::kPickupPolicy)->second);
+  const auto& config = mc_matrix->pickup_policy();
 
   /*
    * Unless we have the cluster proximity policy, we are good to go on
    * validation if we make it this far.
    */
-  if (bselm::kPickupPolicyClusterProx == config.policy) {
-    auto range = mc_map->const_values_range();
-    if (!range.empty()) {
-      auto avg_position =
-          std::accumulate(range.begin(),
-                          range.end(),
-                          rmath::vector2d(),
-                          [&](rmath::vector2d& sum, const auto& bent) {
-                            return sum + bent.ent()->ranchor2D();
-                          }) /
-          boost::size(range);
-
-      return (loc - avg_position).length() < config.prox_dist;
-    }
+  if (bselm::kPickupPolicyClusterProx == config.policy && !mc_map->empty()) {
+    return (loc - mc_map->rloc_avg()).length() < config.prox_dist;
   }
   return true;
 } /* operator()() */
@@ -56,23 +56,20 @@ bool cache_acq_validator::operator()(const rmath::vector2d& loc,
   /*
    * We can't just lookup the cache by the location key we are passed directly,
    * as it is for a point somewhere *inside* the cache, and thus probably not at
-   * the cache's host cell location. Instead we look up the cache by ID, and
-   * verify that the cache exists contains the point we are acquiring.
+   * the cache's host cell location. Instead we look up the cache by ID (O(1)),
+   * and verify that the cache exists contains the point we are acquiring.
    */
-  auto range = mc_dpo_map->const_values_range();
-  auto it = std::find_if(range.begin(), range.end(), [&](const auto& c) {
-    return c.ent()->id() == id;
-  });
+  const auto* known = mc_dpo_map->find(id);
 
-  if (range.end() == it) {
+  if (nullptr == known) {
     ER_WARN("Cache%d near %s invalid for acquisition: cache unknown",
             id.v(),
             loc.to_str().c_str());
     return false;
-  } else if (!it->ent()->contains_point2D(loc)) {
+  } else if (!known->ent()->contains_point2D(loc)) {
     ER_WARN("Cache%d@%s invalid for acquisition: does not contain %s",
             id.v(),
-            rcppsw::to_string(it->ent()->dcenter2D()).c_str(),
+            rcppsw::to_string(known->ent()->dcenter2D()).c_str(),
             rcppsw::to_string(loc).c_str());
     return false;
   }
@@ -87,13 +84,12 @@ bool cache_acq_validator::operator()(const rmath::vector2d& loc,
   }
 
   /* verify pickup policy */
-  return pickup_policy_validate(it->ent(), t);
+  return pickup_policy_validate(known->ent(), t);
 } /* operator()() */
 
 bool cache_acq_validator::pickup_policy_validate(const carepr::base_cache* cache,
                                                  const rtypes::timestep& t) const {
-  const auto& config = boost::get<config::cache_sel::cache_pickup_policy_config>(
-      mc_csel_matrix->find(cselm::kPickupPolicy)->second);
+  const auto& config = mc_csel_matrix->pickup_policy();
 
   if (cselm::kPickupPolicyTime == config.policy && t < config.timestep) {
     ER_DEBUG("Cache%d invalid for acquisition: policy=%s, %zu < %zu",
@@ -34,7 +34,6 @@
 NS_START(fordyca, fsm, d0);
 
 using goal_type = csmetrics::goal_acq_metrics::goal_type;
-using bsel_matrix = controller::cognitive::block_sel_matrix;
 
 /*******************************************************************************
  * Constructors/Destructors
@@ -71,8 +70,7 @@ free_block_to_nest_fsm::free_block_to_nest_fsm(
                                              &entry_transport_to_nest,
                                              &exit_transport_to_nest),
           RCPPSW_HFSM_STATE_MAP_ENTRY_EX(&finished)),
-      mc_nest_loc(boost::get<rmath::vector2d>(
-          c_params->bsel_matrix->find(bsel_matrix::kNestLoc)->second)),
+      mc_nest_loc(c_params->bsel_matrix->nest_loc()),
       m_block_fsm(c_params, saa, std::move(explore), rng) {}
 
 RCPPSW_HFSM_STATE_DEFINE(free_block_to_nest_fsm, start, rpfsm::event_data* data) {
@@ -35,8 +35,6 @@
  ******************************************************************************/
 NS_START(fordyca, fsm, d1);
 
-using csel_matrix = controller::cognitive::cache_sel_matrix;
-
 /*******************************************************************************
  * Constructors/Destructors
  ******************************************************************************/
@@ -76,8 +74,7 @@ cached_block_to_nest_fsm::cached_block_to_nest_fsm(
                                              &entry_leaving_nest,
                                              nullptr),
           RCPPSW_HFSM_STATE_MAP_ENTRY_EX(&finished)),
-      mc_nest_loc(boost::get<rmath::vector2d>(
-          c_params->csel_matrix->find(csel_matrix::kNestLoc)->second)),
+      mc_nest_loc(c_params->csel_matrix->nest_loc()),
       m_cache_fsm(c_params, saa, std::move(explore), rng, true) {}
 
 RCPPSW_HFSM_STATE_DEFINE(cached_block_to_nest_fsm,
@@ -36,7 +36,6 @@
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca, fsm, d2);
-using cselm = controller::cognitive::cache_sel_matrix;
 
 /*******************************************************************************
  * Constructors/Destructors
@@ -79,7 +78,8 @@ acquire_new_cache_fsm::acquire_new_cache_fsm(
                                               return true;
                                             }) }),
       mc_matrix(c_params->csel_matrix),
-      mc_store(c_params->store) {}
+      mc_store(c_params->store),
+      m_memo(mc_store, c_params->memo_counts, c_params->memo_resolution) {}
 
 /*******************************************************************************
  * General Member Functions
@@ -90,27 +90,31 @@ bool acquire_new_cache_fsm::candidates_exist(void) const {
 
 boost::optional<csfsm::acquire_goal_fsm::candidate_type>
 acquire_new_cache_fsm::cache_select(void) {
-  controller::cognitive::d2::new_cache_selector selector(mc_matrix);
+  auto select = [&]() {
+    controller::cognitive::d2::new_cache_selector selector(mc_matrix);
+    memo_type::computed res;
 
-  /* A "new" cache is the same as a single block  */
-  if (const auto* best =
-          selector(mc_store->blocks(), mc_store->caches(), sensing()->rpos2D())) {
-    ER_INFO("Select new cache%d@%s/%s for acquisition",
-            best->id().v(),
-            rcppsw::to_string(best->ranchor2D()).c_str(),
-            rcppsw::to_string(best->danchor2D()).c_str());
+    /* A "new" cache is the same as a single block  */
+    if (const auto* best = selector(
+            mc_store->blocks(), mc_store->caches(), sensing()->rpos2D())) {
+      ER_INFO("Select new cache%d@%s/%s for acquisition",
+              best->id().v(),
+              rcppsw::to_string(best->ranchor2D()).c_str(),
+              rcppsw::to_string(best->danchor2D()).c_str());
 
-    auto tol = boost::get<rtypes::spatial_dist>(
-        mc_matrix->find(cselm::kNewCacheDropTolerance)->second);
-    return boost::make_optional(
-        acquire_goal_fsm::candidate_type(best->rcenter2D(), tol.v(), best->id()));
-  } else {
+      auto tol = mc_matrix->new_cache_tol();
+      res.result = boost::make_optional(acquire_goal_fsm::candidate_type(
+          best->rcenter2D(), tol.v(), best->id()));
+    }
     /*
-     * If this happens, all the blocks we know of are ineligible for us to
-     * vector to (too close or something similar).
+     * Otherwise, all the blocks we know of are ineligible for us to vector to
+     * (too close or something similar).
      */
-    return boost::optional<acquire_goal_fsm::candidate_type>();
-  }
+    res.decay_floor = selector.decay_floor();
+    return res;
+  };
+  /* new cache selection does not use any exception lists */
+  return m_memo(sensing()->rpos2D(), 0, select);
 } /* cache_select() */
 
 bool acquire_new_cache_fsm::cache_acquired_cb(bool explore_result) const {
@@ -0,0 +1,42 @@
+/**
+ * \file cache_site_solver_factory.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/fsm/d2/cache_site_solver_factory.hpp"
+
+#include "fordyca/fsm/d2/grid_cache_site_solver.hpp"
+#include "fordyca/fsm/d2/nlopt_cache_site_solver.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, fsm, d2);
+
+/*******************************************************************************
+ * Constructors/Destructors
+ ******************************************************************************/
+cache_site_solver_factory::cache_site_solver_factory(void) {
+  register_type<grid_cache_site_solver>(kGrid);
+  register_type<nlopt_cache_site_solver>(kNLopt);
+}
+
+NS_END(d2, fsm, fordyca);
@@ -0,0 +1,139 @@
+/**
+ * \file grid_cache_site_solver.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/fsm/d2/grid_cache_site_solver.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "fordyca/math/cache_site_utility.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, fsm, d2);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+boost::optional<rmath::vector2d> grid_cache_site_solver::operator()(
+    const cache_site_problem& problem,
+    rmath::rng*) {
+  math::cache_site_utility utility(problem.position, problem.nest_loc);
+
+  double xlb = problem.xrange.lb();
+  double xub = problem.xrange.ub();
+  double ylb = problem.yrange.lb();
+  double yub = problem.yrange.ub();
+  double dx = (xub - xlb) / (kGRID_RESOLUTION - 1);
+  double dy = (yub - ylb) / (kGRID_RESOLUTION - 1);
+
+  rmath::vector2d best;
+  double best_utility = std::numeric_limits<double>::lowest();
+  bool feasible = false;
+
+  rmath::vector2d least_violating;
+  double least_violation = std::numeric_limits<double>::max();
+
+  /* coarse search */
+  for (size_t i = 0; i < kGRID_RESOLUTION; ++i) {
+    for (size_t j = 0; j < kGRID_RESOLUTION; ++j) {
+      rmath::vector2d point(xlb + i * dx, ylb + j * dy);
+      double v = violation(problem, point);
+      if (v > kCONSTRAINT_TOL) {
+        if (v < least_violation) {
+          least_violation = v;
+          least_violating = point;
+        }
+        continue;
+      }
+      double u = utility(point);
+      if (u > best_utility) {
+        best_utility = u;
+        best = point;
+        feasible = true;
+      }
+    } /* for(j..) */
+  } /* for(i..) */
+
+  if (!feasible) {
+    ER_WARN("No grid point satisfies constraints: least violation=%f@%s",
+            least_violation,
+            least_violating.to_str().c_str());
+    m_status = cache_site_solver_status::ekFAILURE;
+    return boost::make_optional(least_violating);
+  }
+  ER_DEBUG("Best grid point: %s, utility=%f",
+           best.to_str().c_str(),
+           best_utility);
+
+  /* refinement */
+  double step = std::max(dx, dy) / 2.0;
+  size_t n_iter = 0;
+  while (step > kREFINE_TOL && n_iter < kMAX_REFINE_ITERATIONS) {
+    rmath::vector2d candidates[] = { best + rmath::vector2d(step, 0.0),
+                                     best - rmath::vector2d(step, 0.0),
+                                     best + rmath::vector2d(0.0, step),
+                                     best - rmath::vector2d(0.0, step) };
+    bool improved = false;
+    for (auto& c : candidates) {
+      c.set(std::clamp(c.x(), xlb, xub), std::clamp(c.y(), ylb, yub));
+      if (violation(problem, c) > kCONSTRAINT_TOL) {
+        continue;
+      }
+      double u = utility(c);
+      if (u > best_utility) {
+        best_utility = u;
+        best = c;
+        improved = true;
+      }
+    } /* for(&c..) */
+
+    if (!improved) {
+      step /= 2.0;
+    }
+    ++n_iter;
+  } /* while() */
+
+  m_status = (step <= kREFINE_TOL)
+                 ? cache_site_solver_status::ekSITE_TOL_REACHED
+                 : cache_site_solver_status::ekMAX_ITERATIONS_REACHED;
+  ER_INFO("Computed site %s in %zu refinement iterations: utility=%f,step=%f",
+          best.to_str().c_str(),
+          n_iter,
+          best_utility,
+          step);
+  return boost::make_optional(best);
+} /* operator()() */
+
+double grid_cache_site_solver::violation(const cache_site_problem& problem,
+                                         const rmath::vector2d& point) const {
+  double v = std::max(0.0,
+                      problem.nest_prox.v() - (point - problem.nest_loc).length());
+  for (const auto& c : problem.caches) {
+    v += std::max(0.0, problem.cache_prox.v() - (point - c).length());
+  } /* for(&c..) */
+  return v;
+} /* violation() */
+
+NS_END(d2, fsm, fordyca);
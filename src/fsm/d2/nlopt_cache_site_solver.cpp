@@ -0,0 +1,217 @@
+/**
+ * \file nlopt_cache_site_solver.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/fsm/d2/nlopt_cache_site_solver.hpp"
+
+#include <cmath>
+#include <limits>
+
+#include "fordyca/math/cache_site_utility.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, fsm, d2);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+boost::optional<rmath::vector2d> nlopt_cache_site_solver::operator()(
+    const cache_site_problem& problem,
+    rmath::rng* rng) {
+  double max_utility;
+  std::vector<double> point;
+  opt_initialize(problem, &point, rng);
+
+  /*
+   * @bug Sometimes NLopt just fails with a generic error code and I don't
+   * know why. I *think* it is because I hand it an infeasible point to start
+   * with (i.e. one that violates the existing constraints). Should probably fix
+   * so exception catching is not necessary, but for now this seems to work.
+   */
+  try {
+    nlopt::result res = m_alg.optimize(point, max_utility);
+    ER_INFO("NLopt returned: '%s', max_utility=%f",
+            nlopt_ret_str(res).c_str(),
+            max_utility);
+    ER_ASSERT(res >= 1, "NLopt failed with code %d", res);
+    m_status = nlopt_status(res);
+  } catch (std::runtime_error&) {
+    m_status = cache_site_solver_status::ekFAILURE;
+    ER_FATAL_SENTINEL("NLopt failed");
+    return boost::optional<rmath::vector2d>();
+  }
+  return boost::make_optional(rmath::vector2d(point[0], point[1]));
+} /* operator()() */
+
+void nlopt_cache_site_solver::opt_initialize(const cache_site_problem& problem,
+                                             std::vector<double>* initial_guess,
+                                             rmath::rng* rng) {
+  /*
+   * If there are no constraints on the problem, the COBYLA method hangs, BUT
+   * that is OK because we always have at least the nest proximity constraint.
+   */
+  constraints_create(problem);
+  ER_INFO("Calculated %zu cache, %zu nest constraints",
+          std::get<0>(m_constraints).size(),
+          std::get<1>(m_constraints).size());
+
+  const auto& xrange = problem.xrange;
+  const auto& yrange = problem.yrange;
+  m_utility_data = { problem.position, problem.nest_loc };
+  m_alg.set_max_objective(&__site_utility_func, &m_utility_data);
+  m_alg.set_ftol_rel(kUTILITY_TOL);
+  m_alg.set_stopval(1000000);
+  m_alg.set_lower_bounds(
+      { static_cast<double>(xrange.lb()), static_cast<double>(yrange.lb()) });
+  m_alg.set_upper_bounds(
+      { static_cast<double>(xrange.ub()), static_cast<double>(yrange.ub()) });
+  m_alg.set_maxeval(kMAX_ITERATIONS);
+  m_alg.set_default_initial_step({ 1.0, 1.0 });
+
+  /* Initial guess: random point in the arena */
+  uint x = rng->uniform(xrange);
+  uint y = rng->uniform(yrange);
+
+  *initial_guess = { static_cast<double>(x), static_cast<double>(y) };
+  ER_INFO("Initial guess: (%u,%u), xrange=%s, yrange=%s",
+          x,
+          y,
+          xrange.to_str().c_str(),
+          yrange.to_str().c_str());
+} /* opt_initialize() */
+
+void nlopt_cache_site_solver::constraints_create(
+    const cache_site_problem& problem) {
+  std::get<0>(m_constraints).clear();
+  std::get<1>(m_constraints).clear();
+  m_alg.remove_inequality_constraints();
+
+  for (const auto& c : problem.caches) {
+    std::get<0>(m_constraints).push_back({ c, problem.cache_prox });
+  } /* for(&c..) */
+
+  std::get<1>(m_constraints).push_back({ problem.nest_loc, problem.nest_prox });
+
+  /* constraint data must not move once it has been handed to NLopt */
+  for (auto& c : std::get<0>(m_constraints)) {
+    m_alg.add_inequality_constraint(
+        __cache_constraint_func, &c, kCACHE_CONSTRAINT_TOL);
+  } /* for(c..) */
+
+  m_alg.add_inequality_constraint(__nest_constraint_func,
+                                  &std::get<1>(m_constraints)[0],
+                                  kNEST_CONSTRAINT_TOL);
+} /* constraints_create() */
+
+std::string nlopt_cache_site_solver::nlopt_ret_str(nlopt::result res) const {
+  switch (res) {
+    case nlopt::result::FAILURE:
+      return "FAILURE";
+    case nlopt::result::INVALID_ARGS:
+      return "INVALID_ARGS";
+    case nlopt::result::OUT_OF_MEMORY:
+      return "OUT_OF_MEMORY";
+    case nlopt::result::ROUNDOFF_LIMITED:
+      return "ROUNDOFF_LIMITED";
+    case nlopt::result::FORCED_STOP:
+      return "FORCED_STOP";
+    case nlopt::result::SUCCESS:
+      return "SUCCESS";
+    case nlopt::result::STOPVAL_REACHED:
+      return "STOPVAL_REACHED";
+    case nlopt::result::FTOL_REACHED:
+      return "FTOL_REACHED";
+    case nlopt::result::XTOL_REACHED:
+      return "XTOL_REACHED";
+    case nlopt::result::MAXEVAL_REACHED:
+      return "MAXEVAL_REACHED";
+    case nlopt::result::MAXTIME_REACHED:
+      return "MAXTIME_REACHED";
+      break;
+    default:
+      return "";
+  } /* switch() */
+} /* nlopt_ret_str() */
+
+cache_site_solver_status
+nlopt_cache_site_solver::nlopt_status(nlopt::result res) {
+  switch (res) {
+    case nlopt::result::STOPVAL_REACHED:
+      return cache_site_solver_status::ekSTOPVAL_REACHED;
+    case nlopt::result::FTOL_REACHED:
+      return cache_site_solver_status::ekUTILITY_TOL_REACHED;
+    case nlopt::result::XTOL_REACHED:
+      return cache_site_solver_status::ekSITE_TOL_REACHED;
+    case nlopt::result::MAXEVAL_REACHED:
+    case nlopt::result::MAXTIME_REACHED:
+      return cache_site_solver_status::ekMAX_ITERATIONS_REACHED;
+    default:
+      return (res >= nlopt::result::SUCCESS)
+                 ? cache_site_solver_status::ekOTHER_SUCCESS
+                 : cache_site_solver_status::ekFAILURE;
+  } /* switch() */
+} /* nlopt_status() */
+
+/*******************************************************************************
+ * Non-Member Functions
+ ******************************************************************************/
+double __cache_constraint_func(const std::vector<double>& x,
+                               std::vector<double>&,
+                               void* data) {
+  if (std::isnan(x[0]) || std::isnan(x[1])) {
+    return std::numeric_limits<double>::max();
+  }
+  auto* c =
+      reinterpret_cast<nlopt_cache_site_solver::cache_constraint_data*>(data);
+  return c->cache_prox.v() - (rmath::vector2d(x[0], x[1]) - c->center).length();
+} /* __cache_constraint_func() */
+
+double __nest_constraint_func(const std::vector<double>& x,
+                              std::vector<double>&,
+                              void* data) {
+  if (std::isnan(x[0]) || std::isnan(x[1])) {
+    return std::numeric_limits<double>::max();
+  }
+  auto* c =
+      reinterpret_cast<nlopt_cache_site_solver::nest_constraint_data*>(data);
+  return c->nest_prox.v() - (rmath::vector2d(x[0], x[1]) - c->nest_loc).length();
+} /* __nest_constraint_func() */
+
+double __site_utility_func(const std::vector<double>& x,
+                           std::vector<double>&,
+                           void* data) {
+  /*
+   * \todo If for some reason we get a NaN point, return the worst possible
+   * utility. Again this should probably not be necessary, but I don't know
+   * enough about optimization theory to say for sure.
+   */
+  if (std::isnan(x[0]) || std::isnan(x[1])) {
+    return std::numeric_limits<double>::min();
+  }
+  auto* d = reinterpret_cast<nlopt_cache_site_solver::site_utility_data*>(data);
+  rmath::vector2d point(x[0], x[1]);
+  return math::cache_site_utility(d->position, d->nest_loc)(point);
+} /* __site_utility_func() */
+
+NS_END(d2, fsm, fordyca);
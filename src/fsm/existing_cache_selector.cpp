@@ -27,13 +27,12 @@
 
 #include "fordyca/controller/cognitive/cache_sel_matrix.hpp"
 #include "fordyca/fsm/cache_acq_validator.hpp"
-#include "fordyca/math/existing_cache_utility.hpp"
+#include "fordyca/math/existing_cache_utility_batch.hpp"
 
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
 NS_START(fordyca, fsm);
-using cselm = controller::cognitive::cache_sel_matrix;
 
 /*******************************************************************************
  * Constructors/Destructor
@@ -54,35 +53,47 @@ const carepr::base_cache*
 existing_cache_selector::operator()(const ds::dp_cache_map& existing_caches,
                                     const rmath::vector2d& position,
                                     const rtypes::timestep& t) {
-  const carepr::base_cache* best = nullptr;
   ER_ASSERT(!existing_caches.empty(), "No known existing caches");
 
-  double max_utility = 0.0;
-  for (const auto& c : existing_caches.const_values_range()) {
-    fsm::cache_acq_validator validator(mc_cache_map, mc_matrix, mc_is_pickup);
+  /*
+   * Look everything up in the selection matrix once, rather than once per
+   * cache.
+   */
+  const auto& nest_loc = mc_matrix->nest_loc();
+  const auto& exceptions = mc_is_pickup ? mc_matrix->pickup_exceptions()
+                                        : mc_matrix->drop_exceptions();
+  fsm::cache_acq_validator validator(mc_cache_map, mc_matrix, mc_is_pickup);
+
+  math::existing_cache_utility_batch batch(nest_loc, existing_caches.size());
+  std::vector<const ds::dp_cache_map::value_type*> candidates;
+  candidates.reserve(existing_caches.size());
 
+  for (const auto& c : existing_caches.const_values_range()) {
     if (!validator(c.ent()->rcenter2D(), c.ent()->id(), t) ||
-        cache_is_excluded(position, c.ent())) {
+        cache_is_excluded(position, c.ent(), exceptions)) {
       continue;
     }
-    math::existing_cache_utility u(
-        c.ent()->rcenter2D(),
-        boost::get<rmath::vector2d>(mc_matrix->find(cselm::kNestLoc)->second));
+    batch.add(c.ent()->rcenter2D(), c.density(), c.ent()->n_blocks());
+    candidates.push_back(&c);
+  } /* for(existing_cache..) */
+
+  auto res = batch.calc(position);
+  m_decay_floor = batch.decay_floor(res);
 
-    double utility = u.calc(position, c.density(), c.ent()->n_blocks());
-    ER_ASSERT(utility > 0.0, "Bad utility calculation");
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    ER_ASSERT(batch.utility(i) > 0.0, "Bad utility calculation");
     ER_DEBUG("Utility for existing_cache%d@%s/%s, density=%f: %f",
-             c.ent()->id().v(),
-             rcppsw::to_string(c.ent()->rcenter2D()).c_str(),
-             rcppsw::to_string(c.ent()->dcenter2D()).c_str(),
-             c.density().v(),
-             utility);
-
-    if (utility > max_utility) {
-      best = c.ent();
-      max_utility = utility;
-    }
-  } /* for(existing_cache..) */
+             candidates[i]->ent()->id().v(),
+             rcppsw::to_string(candidates[i]->ent()->rcenter2D()).c_str(),
+             rcppsw::to_string(candidates[i]->ent()->dcenter2D()).c_str(),
+             candidates[i]->density().v(),
+             batch.utility(i));
+  } /* for(i..) */
+
+  const carepr::base_cache* best = nullptr;
+  if (math::utility_batch::kNoSelection != res.index) {
+    best = candidates[res.index]->ent();
+  }
 
   ER_CHECKI(nullptr != best,
             "Best utility: existing_cache%d@%s/%s w/%zu blocks: %f",
@@ -90,7 +101,7 @@ existing_cache_selector::operator()(const ds::dp_cache_map& existing_caches,
             rcppsw::to_string(best->rcenter2D()).c_str(),
             rcppsw::to_string(best->dcenter2D()).c_str(),
             best->n_blocks(),
-            max_utility);
+            res.utility);
   ER_CHECKD(nullptr != best,
             "No best existing cache found: all known caches excluded!");
   return best;
@@ -98,7 +109,8 @@ existing_cache_selector::operator()(const ds::dp_cache_map& existing_caches,
 
 bool existing_cache_selector::cache_is_excluded(
     const rmath::vector2d& position,
-    const carepr::base_cache* const cache) const {
+    const carepr::base_cache* const cache,
+    const controller::cognitive::sel_exception_list& exceptions) const {
   /**
    * If a robot is currently IN a cache, and wants to pick up from/drop
    * into a cache, it should generally ignored the cache it is currently in,
@@ -117,18 +129,7 @@ bool existing_cache_selector::cache_is_excluded(
     return true;
   }
 
-  std::vector<rtypes::type_uuid> exceptions;
-  if (mc_is_pickup) {
-    exceptions = boost::get<std::vector<rtypes::type_uuid>>(
-        mc_matrix->find(cselm::kPickupExceptions)->second);
-  } else {
-    exceptions = boost::get<std::vector<rtypes::type_uuid>>(
-        mc_matrix->find(cselm::kDropExceptions)->second);
-  }
-
-  if (std::any_of(exceptions.begin(), exceptions.end(), [&](auto& id) {
-        return id == cache->id();
-      })) {
+  if (exceptions.contains(cache->id())) {
     ER_DEBUG("Ignoring cache%d@%s/%s: On exception list",
              cache->id().v(),
              rcppsw::to_string(cache->rcenter2D()).c_str(),
@@ -41,9 +41,14 @@ block_utility::block_utility(const rmath::vector2d& block_loc,
 double block_utility::calc(const rmath::vector2d& rloc,
                            const crepr::pheromone_density& density,
                            double priority) {
-  return eval(
-      ((mc_block_loc - mc_nest_loc).length() / (mc_block_loc - rloc).length()) *
-      std::exp(density.v() * priority));
+  return eval(kernel(mc_block_loc.x(),
+                     mc_block_loc.y(),
+                     mc_nest_loc.x(),
+                     mc_nest_loc.y(),
+                     rloc.x(),
+                     rloc.y(),
+                     density.v(),
+                     priority));
 } /* calc() */
 
 NS_END(expressions, fordyca);
@@ -0,0 +1,76 @@
+/**
+ * \file block_utility_batch.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/math/block_utility_batch.hpp"
+
+#include "fordyca/math/block_utility.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, math);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+block_utility_batch::block_utility_batch(const rmath::vector2d& nest_loc,
+                                         size_t n_hint)
+    : mc_nest_loc(nest_loc) {
+  reserve(n_hint);
+  m_density.reserve(n_hint);
+  m_priority.reserve(n_hint);
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void block_utility_batch::add(const rmath::vector2d& block_loc,
+                              const crepr::pheromone_density& density,
+                              double priority) {
+  loc_add(block_loc, density.v() * priority);
+  m_density.push_back(density.v());
+  m_priority.push_back(priority);
+} /* add() */
+
+utility_batch::result block_utility_batch::calc(const rmath::vector2d& rloc) {
+  size_t n = size();
+  m_utility.resize(n);
+
+  const double rx = rloc.x();
+  const double ry = rloc.y();
+  const double nx = mc_nest_loc.x();
+  const double ny = mc_nest_loc.y();
+  const double* x = m_x.data();
+  const double* y = m_y.data();
+  const double* density = m_density.data();
+  const double* priority = m_priority.data();
+  double* utility = m_utility.data();
+
+  for (size_t i = 0; i < n; ++i) {
+    utility[i] = block_utility::kernel(
+        x[i], y[i], nx, ny, rx, ry, density[i], priority[i]);
+  } /* for(i..) */
+  return select();
+} /* calc() */
+
+NS_END(math, fordyca);
@@ -23,8 +23,6 @@
  ******************************************************************************/
 #include "fordyca/math/existing_cache_utility.hpp"
 
-#include <cmath>
-
 /*******************************************************************************
  * Namespaces
  ******************************************************************************/
@@ -43,9 +41,14 @@ existing_cache_utility::existing_cache_utility(const rmath::vector2d& cache_loc,
 double existing_cache_utility::calc(const rmath::vector2d& rloc,
                                     const crepr::pheromone_density& density,
                                     size_t n_blocks) {
-  return eval(
-      (std::exp(density.v()) * n_blocks) /
-      ((mc_cache_loc - rloc).length() * (mc_cache_loc - mc_nest_loc).length()));
+  return eval(kernel(mc_cache_loc.x(),
+                     mc_cache_loc.y(),
+                     mc_nest_loc.x(),
+                     mc_nest_loc.y(),
+                     rloc.x(),
+                     rloc.y(),
+                     density.v(),
+                     static_cast<double>(n_blocks)));
 } /* calc() */
 
 NS_END(expressions, fordyca);
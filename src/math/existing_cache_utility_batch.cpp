@@ -0,0 +1,78 @@
+/**
+ * \file existing_cache_utility_batch.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/math/existing_cache_utility_batch.hpp"
+
+#include "fordyca/math/existing_cache_utility.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, math);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+existing_cache_utility_batch::existing_cache_utility_batch(
+    const rmath::vector2d& nest_loc,
+    size_t n_hint)
+    : mc_nest_loc(nest_loc) {
+  reserve(n_hint);
+  m_density.reserve(n_hint);
+  m_n_blocks.reserve(n_hint);
+}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void existing_cache_utility_batch::add(const rmath::vector2d& cache_loc,
+                                       const crepr::pheromone_density& density,
+                                       size_t n_blocks) {
+  loc_add(cache_loc, density.v());
+  m_density.push_back(density.v());
+  m_n_blocks.push_back(static_cast<double>(n_blocks));
+} /* add() */
+
+utility_batch::result
+existing_cache_utility_batch::calc(const rmath::vector2d& rloc) {
+  size_t n = size();
+  m_utility.resize(n);
+
+  const double rx = rloc.x();
+  const double ry = rloc.y();
+  const double nx = mc_nest_loc.x();
+  const double ny = mc_nest_loc.y();
+  const double* x = m_x.data();
+  const double* y = m_y.data();
+  const double* density = m_density.data();
+  const double* n_blocks = m_n_blocks.data();
+  double* utility = m_utility.data();
+
+  for (size_t i = 0; i < n; ++i) {
+    utility[i] = existing_cache_utility::kernel(
+        x[i], y[i], nx, ny, rx, ry, density[i], n_blocks[i]);
+  } /* for(i..) */
+  return select();
+} /* calc() */
+
+NS_END(math, fordyca);
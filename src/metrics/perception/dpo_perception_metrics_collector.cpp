@@ -57,7 +57,11 @@ dpo_perception_metrics_collector::csv_header_cols(void) const {
       "int_avg_block_pheromone_density",
       "cum_avg_block_pheromone_density",
       "int_avg_cache_pheromone_density",
-      "cum_avg_cache_pheromone_density"
+      "cum_avg_cache_pheromone_density",
+      "int_avg_evicted_blocks",
+      "cum_avg_evicted_blocks",
+      "int_avg_evicted_caches",
+      "cum_avg_evicted_caches"
     /* clang-format on */
   };
   merged.splice(merged.end(), cols);
@@ -84,7 +88,12 @@ dpo_perception_metrics_collector::csv_line_build(void) {
   line += csv_entry_domavg(m_interval.block_density_sum, m_interval.robot_count);
   line += csv_entry_domavg(m_cum.block_density_sum, m_cum.robot_count);
   line += csv_entry_domavg(m_interval.cache_density_sum, m_interval.robot_count);
-  line += csv_entry_domavg(m_cum.cache_density_sum, m_cum.robot_count, true);
+  line += csv_entry_domavg(m_cum.cache_density_sum, m_cum.robot_count);
+
+  line += csv_entry_domavg(m_interval.evicted_blocks, m_interval.robot_count);
+  line += csv_entry_domavg(m_cum.evicted_blocks, m_cum.robot_count);
+  line += csv_entry_domavg(m_interval.evicted_caches, m_interval.robot_count);
+  line += csv_entry_domavg(m_cum.evicted_caches, m_cum.robot_count, true);
 
   return boost::make_optional(line);
 } /* csv_line_build() */
@@ -101,6 +110,11 @@ void dpo_perception_metrics_collector::collect(
   m_cum.known_blocks += m.n_known_blocks();
   m_cum.known_caches += m.n_known_caches();
 
+  m_interval.evicted_blocks += m.n_evicted_blocks();
+  m_interval.evicted_caches += m.n_evicted_caches();
+  m_cum.evicted_blocks += m.n_evicted_blocks();
+  m_cum.evicted_caches += m.n_evicted_caches();
+
   auto int_bsum = m_interval.block_density_sum.load();
   auto int_csum = m_interval.cache_density_sum.load();
   m_interval.block_density_sum.compare_exchange_strong(
@@ -122,6 +136,8 @@ void dpo_perception_metrics_collector::reset_after_interval(void) {
   m_interval.known_caches = 0;
   m_interval.block_density_sum = 0.0;
   m_interval.cache_density_sum = 0.0;
+  m_interval.evicted_blocks = 0;
+  m_interval.evicted_caches = 0;
 } /* reset_after_interval() */
 
 NS_END(perception, metrics, fordyca);
@@ -0,0 +1,108 @@
+/**
+ * \file selection_memo_metrics_collector.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/metrics/perception/selection_memo_metrics_collector.hpp"
+
+#include "fordyca/metrics/perception/selection_memo_metrics.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, metrics, perception);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+selection_memo_metrics_collector::selection_memo_metrics_collector(
+    const std::string& ofname_stem,
+    const rtypes::timestep& interval)
+    : base_metrics_collector(ofname_stem,
+                             interval,
+                             rmetrics::output_mode::ekAPPEND) {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+std::list<std::string>
+selection_memo_metrics_collector::csv_header_cols(void) const {
+  auto merged = dflt_csv_header_cols();
+  auto cols = std::list<std::string>{
+    /* clang-format off */
+      "int_avg_memo_hits",
+      "cum_avg_memo_hits",
+      "int_avg_memo_misses",
+      "cum_avg_memo_misses",
+      "int_memo_hit_rate",
+      "cum_memo_hit_rate"
+    /* clang-format on */
+  };
+  merged.splice(merged.end(), cols);
+  return merged;
+} /* csv_header_cols() */
+
+void selection_memo_metrics_collector::reset(void) {
+  base_metrics_collector::reset();
+  reset_after_interval();
+} /* reset() */
+
+boost::optional<std::string>
+selection_memo_metrics_collector::csv_line_build(void) {
+  if (!(timestep() % interval() == 0UL)) {
+    return boost::none;
+  }
+  std::string line;
+
+  line += csv_entry_domavg(m_interval.hits, m_interval.robot_count);
+  line += csv_entry_domavg(m_cum.hits, m_cum.robot_count);
+  line += csv_entry_domavg(m_interval.misses, m_interval.robot_count);
+  line += csv_entry_domavg(m_cum.misses, m_cum.robot_count);
+
+  line += csv_entry_domavg(m_interval.hits, m_interval.lookups);
+  line += csv_entry_domavg(m_cum.hits, m_cum.lookups, true);
+
+  return boost::make_optional(line);
+} /* csv_line_build() */
+
+void selection_memo_metrics_collector::collect(
+    const rmetrics::base_metrics& metrics) {
+  const auto& m = dynamic_cast<const selection_memo_metrics&>(metrics);
+  ++m_interval.robot_count;
+  ++m_cum.robot_count;
+
+  m_interval.hits += m.n_memo_hits();
+  m_interval.misses += m.n_memo_misses();
+  m_interval.lookups += m.n_memo_hits() + m.n_memo_misses();
+
+  m_cum.hits += m.n_memo_hits();
+  m_cum.misses += m.n_memo_misses();
+  m_cum.lookups += m.n_memo_hits() + m.n_memo_misses();
+} /* collect() */
+
+void selection_memo_metrics_collector::reset_after_interval(void) {
+  m_interval.robot_count = 0;
+  m_interval.hits = 0;
+  m_interval.misses = 0;
+  m_interval.lookups = 0;
+} /* reset_after_interval() */
+
+NS_END(perception, metrics, fordyca);
@@ -23,6 +23,8 @@
  *****************************************************************************/
 #include "fordyca/repr/forager_los.hpp"
 
+#include <unordered_set>
+
 #include "cosm/arena/repr/arena_cache.hpp"
 #include "cosm/ds/cell2D.hpp"
 #include "cosm/repr/base_block3D.hpp"
@@ -32,11 +34,21 @@
  ******************************************************************************/
 NS_START(fordyca, repr);
 
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+forager_los::forager_los(const const_grid_view& c_view)
+    : los2D(c_view), ER_CLIENT_INIT("fordyca.repr.forager_los") {
+  entities_extract();
+}
+
 /*******************************************************************************
  * Member Functions
  ******************************************************************************/
-cds::block3D_vectorno forager_los::blocks(void) const {
-  cds::block3D_vectorno blocks{};
+void forager_los::entities_extract(void) {
+  std::unordered_set<int> block_ids;
+  std::unordered_set<int> cache_ids;
+
   for (size_t i = 0; i < xsize(); ++i) {
     for (size_t j = 0; j < ysize(); ++j) {
       const cds::cell2D& cell = access(i, j);
@@ -45,20 +57,13 @@ cds::block3D_vectorno forager_los::blocks(void) const {
                   "Cell@%s in HAS_BLOCK/BLOCK_EXTENT state, but does not have "
                   "block",
                   rcppsw::to_string(cell.loc()).c_str());
-        blocks.push_back(static_cast<crepr::base_block3D*>(cell.entity()));
-      }
-    } /* for(j..) */
-  } /* for(i..) */
-  return blocks;
-} /* blocks() */
-
-cads::bcache_vectorno forager_los::caches(void) const {
-  cads::bcache_vectorno caches;
+        auto* block = static_cast<crepr::base_block3D*>(cell.entity());
 
-  for (size_t i = 0; i < xsize(); ++i) {
-    for (size_t j = 0; j < ysize(); ++j) {
-      const cds::cell2D& cell = access(i, j);
-      if (cell.state_has_cache() || cell.state_in_cache_extent()) {
+        /* blocks with extent are referred to by multiple cells */
+        if (block_ids.insert(block->id().v()).second) {
+          m_blocks.push_back(block);
+        }
+      } else if (cell.state_has_cache() || cell.state_in_cache_extent()) {
         auto* cache = cell.cache();
         ER_ASSERT(nullptr != cache,
                   "Cell@%s in HAS_CACHE/CACHE_EXTENT state, but does not have "
@@ -77,14 +82,12 @@ cads::bcache_vectorno forager_los::caches(void) const {
          * double references to a single cache in a LOS, which can cause
          * problems with pheromone updating. See FORDYCA#433.
          */
-        if (caches.end() == std::find(caches.begin(), caches.end(), cache)) {
-          caches.push_back(cache);
+        if (cache_ids.insert(cache->id().v()).second) {
+          m_caches.push_back(cache);
         }
       }
     } /* for(j..) */
   } /* for(i..) */
-
-  return caches;
-} /* caches() */
+} /* entities_extract() */
 
 NS_END(repr, fordyca);
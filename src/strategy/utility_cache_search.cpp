@@ -23,8 +23,6 @@
  ******************************************************************************/
 #include "fordyca/strategy/explore/utility_cache_search.hpp"
 
-#include <numeric>
-
 #include "cosm/repr/base_block3D.hpp"
 #include "cosm/spatial/fsm/point_argument.hpp"
 #include "cosm/subsystem/saa_subsystemQ3D.hpp"
@@ -42,16 +40,9 @@ NS_START(fordyca, strategy, explore);
  * Member Functions
  ******************************************************************************/
 void utility_cache_search::task_start(cta::taskable_argument*) {
-  auto range = mc_store->blocks().const_values_range();
   rmath::vector2d position;
-  if (!range.empty()) {
-    position = std::accumulate(range.begin(),
-                               range.end(),
-                               rmath::vector2d(),
-                               [&](rmath::vector2d& sum, const auto& bent) {
-                                 return sum + bent.ent()->rcenter2D();
-                               }) /
-               boost::size(range);
+  if (!mc_store->blocks().empty()) {
+    position = mc_store->blocks().rloc_avg();
   } else {
     position = saa()->sensing()->rpos2D();
   }
@@ -46,6 +46,7 @@ base_cache_manager::creation_blocks_alloc(
     const block_alloc_filter_type& usable_filter,
     const block_alloc_filter_type& absorbable_filter) {
   creation_blocks allocated;
+  m_block_membership.build(existing_caches, clusters);
 
   std::copy_if(all_blocks.begin(),
                all_blocks.end(),
@@ -33,10 +33,15 @@
 #include "cosm/oracle/tasking_oracle.hpp"
 #include "cosm/pal/argos_convergence_calculator.hpp"
 #include "cosm/pal/argos_swarm_iterator.hpp"
+#include "cosm/repr/base_block3D.hpp"
 #include "cosm/vis/config/visualization_config.hpp"
 
 #include "fordyca//controller/foraging_controller.hpp"
 #include "fordyca/config/tv/tv_manager_config.hpp"
+#include "fordyca/controller/cognitive/foraging_perception_subsystem.hpp"
+#include "fordyca/ds/arena_snapshot_pool.hpp"
+#include "fordyca/ds/dpo_store.hpp"
+#include "fordyca/ds/oracle_knowledge.hpp"
 #include "fordyca/metrics/fordyca_metrics_aggregator.hpp"
 #include "fordyca/support/tv/env_dynamics.hpp"
 #include "fordyca/support/tv/fordyca_pd_adaptor.hpp"
@@ -53,7 +58,9 @@ base_loop_functions::base_loop_functions(void)
     : ER_CLIENT_INIT("fordyca.loop.base"),
       m_tv_manager(nullptr),
       m_conv_calc(nullptr),
-      m_oracle(nullptr) {}
+      m_oracle(nullptr),
+      m_snapshots(std::make_unique<ds::arena_snapshot_pool>()),
+      m_oracle_knowledge(nullptr) {}
 
 base_loop_functions::~base_loop_functions(void) = default;
 
@@ -86,6 +93,9 @@ void base_loop_functions::init(ticpp::Element& node) {
 
   /* initialize oracle, if configured */
   oracle_init(config()->config_get<coconfig::aggregate_oracle_config>());
+
+  /* initialize shared arena snapshots for robot DPO stores */
+  snapshot_pool_init();
 } /* init() */
 
 void base_loop_functions::config_parse(ticpp::Element& node) {
@@ -118,8 +128,13 @@ void base_loop_functions::tv_init(const config::tv::tv_manager_config* tvp) {
   auto envd =
       std::make_unique<tv::env_dynamics>(&tvp->env_dynamics, this, arena_map());
 
-  auto popd = std::make_unique<tv::fordyca_pd_adaptor>(
-      &tvp->population_dynamics, this, envd.get(), arena_map(), rng());
+  auto popd =
+      std::make_unique<tv::fordyca_pd_adaptor>(&tvp->population_dynamics,
+                                               this,
+                                               envd.get(),
+                                               arena_map(),
+                                               m_snapshots.get(),
+                                               rng());
 
   m_tv_manager =
       std::make_unique<tv::tv_manager>(std::move(envd), std::move(popd));
@@ -162,9 +177,143 @@ void base_loop_functions::oracle_init(
   if (nullptr != oraclep) {
     ER_INFO("Creating foraging oracle");
     m_oracle = std::make_unique<cforacle::foraging_oracle>(oraclep);
+    m_oracle_knowledge = std::make_unique<ds::oracle_knowledge>();
   }
 } /* oracle_init() */
 
+void base_loop_functions::snapshot_pool_init(void) {
+  ER_INFO("Initializing arena snapshot pool");
+  m_snapshots->update(arena_map());
+  snapshot_pool_attach();
+} /* snapshot_pool_init() */
+
+bool base_loop_functions::swarm_changed(size_t n_robots) {
+  size_t n_killed = m_n_killed;
+  if (nullptr != m_tv_manager) {
+    if (const auto* popd =
+            m_tv_manager->dynamics<ctv::dynamics_type::ekPOPULATION>()) {
+      n_killed = popd->n_killed();
+    }
+  }
+  size_t n_current = GetSpace().GetEntitiesByType(cpal::kARGoSRobotType).size();
+  bool changed = n_robots != n_current || n_killed != m_n_killed;
+
+  /*
+   * Killed robots drop the blocks they were carrying, which happens after the
+   * oracle's knowledge has been rebuilt (if needed) for this timestep, but
+   * before any robot controllers are run.
+   */
+  if (n_killed != m_n_killed && nullptr != m_oracle_knowledge) {
+    m_oracle_knowledge->rebuild(arena_map());
+  }
+  m_n_killed = n_killed;
+  return changed;
+} /* swarm_changed() */
+
+void base_loop_functions::snapshot_pool_attach(void) {
+  /*
+   * Reactive controllers have no perception subsystem, and therefore no DPO
+   * store to attach the pool to.
+   */
+  auto cb = [&](auto* c) {
+    if (nullptr != c->perception() &&
+        nullptr == c->perception()->dpo_store()->snapshot_pool()) {
+      c->perception()->dpo_store()->snapshot_pool(m_snapshots.get());
+    }
+  };
+  cpal::argos_swarm_iterator::controllers<controller::foraging_controller,
+                                          cpal::iteration_order::ekSTATIC>(
+      this, cb, cpal::kARGoSRobotType);
+} /* snapshot_pool_attach() */
+
+rtypes::type_uuid base_loop_functions::carried_block(
+    const controller::foraging_controller* const controller) {
+  return controller->is_carrying_block() ? controller->block()->id()
+                                         : rtypes::constants::kNoUUID;
+} /* carried_block() */
+
+bool base_loop_functions::interaction_valid(
+    const controller::foraging_controller* const controller,
+    const interaction_intent& intent) const {
+  /*
+   * A robot which was not on a block/in a cache when it made its decision is
+   * left to the interactor, which tells it its target vanished.
+   */
+  rtypes::type_uuid current = intent.target;
+  switch (intent.kind) {
+    case interaction_kind::ekNONE:
+      return false;
+    case interaction_kind::ekFREE_PICKUP:
+      if (rtypes::constants::kNoUUID != intent.target) {
+        current = arena_map()->robot_on_block(controller->rpos2D(),
+                                              controller->entity_acquired_id());
+      }
+      break;
+    case interaction_kind::ekCACHE_PICKUP:
+    case interaction_kind::ekCACHE_DROP:
+      if (rtypes::constants::kNoUUID != intent.target) {
+        current = arena_map()->robot_on_cache(controller->rpos2D());
+      }
+      break;
+    case interaction_kind::ekTASK_ABORT:
+      break;
+    default:
+      /* drops: nothing else can change what a robot is carrying */
+      current = carried_block(controller);
+      break;
+  } /* switch() */
+
+  if (current != intent.target) {
+    ER_DEBUG("Robot%d interaction %d conflicts: target=%d,current=%d",
+             controller->entity_id().v(),
+             static_cast<int>(intent.kind),
+             intent.target.v(),
+             current.v());
+    return false;
+  }
+  return true;
+} /* interaction_valid() */
+
+void base_loop_functions::snapshot_pool_notify(
+    const rtypes::type_uuid& carried,
+    const controller::foraging_controller* const controller) {
+  auto now = carried_block(controller);
+  if (now != carried) {
+    m_snapshots->block_changed(carried);
+    m_snapshots->block_changed(now);
+  }
+} /* snapshot_pool_notify() */
+
+void base_loop_functions::oracle_notify(
+    const rtypes::type_uuid& carried,
+    const controller::foraging_controller* const controller,
+    const interactor_status& status) {
+  if (nullptr == m_oracle_knowledge || m_oracle_knowledge->stale()) {
+    return;
+  }
+  auto now = carried_block(controller);
+  if (now == carried) {
+    return;
+  }
+  if (rtypes::constants::kNoUUID != carried) {
+    m_oracle_knowledge->block_drop(carried);
+  }
+  if (rtypes::constants::kNoUUID != now) {
+    auto from = m_oracle_knowledge->block_pickup(now);
+    if (interactor_status::ekCACHE_DEPLETION & status) {
+      m_oracle_knowledge->cache_depleted(from);
+    }
+  }
+} /* oracle_notify() */
+
+void base_loop_functions::arena_changed(void) {
+  m_snapshots->blocks_changed();
+  m_snapshots->caches_changed();
+  if (nullptr != m_oracle_knowledge) {
+    m_oracle_knowledge->invalidate();
+  }
+} /* arena_changed() */
+
 /*******************************************************************************
  * ARGoS Hooks
  ******************************************************************************/
@@ -175,6 +324,10 @@ void base_loop_functions::pre_step(void) {
   auto status = arena_map()->pre_step_update(timestep());
   if (carena::update_status::ekBLOCK_MOTION == status) {
     floor()->SetChanged();
+    m_snapshots->blocks_changed();
+    if (nullptr != m_oracle_knowledge) {
+      m_oracle_knowledge->invalidate();
+    }
   }
 
   /*
@@ -185,8 +338,21 @@ void base_loop_functions::pre_step(void) {
     m_tv_manager->update(timestep());
   }
 
-  if (nullptr != oracle()) {
+  /*
+   * Needs to be after all arena updates and before robot controllers are run,
+   * so that the snapshots robots see match the arena this timestep.
+   */
+  m_snapshots->update(arena_map());
+
+  /*
+   * Changes from robot interactions are applied to the oracle's knowledge as
+   * they happen during robot processing in the post-step (see FORDYCA#577),
+   * so we only need to rebuild it here if the arena changed in some other way
+   * since then (cache creation, block motion, reset, etc.).
+   */
+  if (nullptr != m_oracle_knowledge && m_oracle_knowledge->stale()) {
     oracle()->update(arena_map());
+    m_oracle_knowledge->rebuild(arena_map());
   }
 } /* pre_step() */
 
@@ -202,6 +368,11 @@ void base_loop_functions::post_step(void) {
 
 void base_loop_functions::reset(void) {
   arena_map()->initialize(this);
+  m_snapshots->reset();
+  m_snapshots->update(arena_map());
+  if (nullptr != m_oracle_knowledge) {
+    m_oracle_knowledge->invalidate();
+  }
 } /* reset() */
 
 /*******************************************************************************
@@ -23,6 +23,9 @@
  ******************************************************************************/
 #include "fordyca/support/cache_creation_verifier.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 #include "cosm/arena/caching_arena_map.hpp"
 #include "cosm/arena/repr/arena_cache.hpp"
 #include "cosm/repr/base_block3D.hpp"
@@ -52,17 +55,63 @@ cache_creation_verifier::cache_creation_verifier(carena::caching_arena_map* cons
  ******************************************************************************/
 
 bool cache_creation_verifier::verify_single(
-    RCPPSW_UNUSED const carepr::arena_cache* cache,
+    const carepr::arena_cache* cache,
     const cads::acache_vectorro& c_caches,
     const cds::block3D_vectorno& c_all_blocks,
     const cfds::block3D_cluster_vectorro& c_clusters) const {
   auto free_blocks =
       carena::free_blocks_calculator(false)(c_all_blocks, c_caches);
 
-  bool sanity_ok = sanity_checks(c_caches,
-                                 free_blocks,
-                                 c_clusters,
-                                 m_map->nests());
+  return verify_result(cache,
+                       sanity_checks(c_caches,
+                                     free_blocks,
+                                     c_clusters,
+                                     m_map->nests()));
+} /* verify_single() */
+
+void cache_creation_verifier::reset(const cds::block3D_vectorno& c_all_blocks) {
+  m_all_blocks = c_all_blocks;
+  m_accepted.clear();
+  m_accepted_blocks.clear();
+  m_cache_cells.clear();
+  m_block_cells.clear();
+
+  blocks_moved(m_all_blocks);
+} /* reset() */
+
+void cache_creation_verifier::blocks_moved(
+    const cds::block3D_vectorno& c_blocks) {
+  /*
+   * Entries at old locations are left in place: overlap checks use the current
+   * block location, so they are only (cheap) false candidates.
+   */
+  for (auto* b : c_blocks) {
+    cells_visit(b->xrspan(), b->yrspan(), [&](key_type k) {
+      m_block_cells[k].push_back(b);
+    });
+  } /* for(*b..) */
+} /* blocks_moved() */
+
+bool cache_creation_verifier::verify_incremental(
+    const carepr::arena_cache* cache,
+    const cfds::block3D_cluster_vectorro& c_clusters) {
+#if (LIBRA_ER == LIBRA_ER_ALL)
+  /* full audit */
+  cads::acache_vectorro caches = m_accepted;
+  caches.push_back(cache);
+  bool ok = verify_single(cache, caches, m_all_blocks, c_clusters);
+#else
+  bool ok = verify_result(cache, verify_new(cache, c_clusters));
+#endif
+
+  if (ok) {
+    accept(cache);
+  }
+  return ok;
+} /* verify_incremental() */
+
+bool cache_creation_verifier::verify_result(const carepr::arena_cache* cache,
+                                            bool sanity_ok) const {
   if (!sanity_ok) {
     if (mc_strict_constraints) {
       ER_WARN("Bad cache%d@%s/%s creation--discard (strict constraints)",
@@ -84,7 +133,89 @@ bool cache_creation_verifier::verify_single(
             rcppsw::to_string(cache->dcenter2D()).c_str());
     return true;
   }
-} /* verify_single() */
+} /* verify_result() */
+
+bool cache_creation_verifier::verify_new(
+    const carepr::arena_cache* cache,
+    const cfds::block3D_cluster_vectorro& c_clusters) const {
+  auto xspan = cache->xrspan();
+  auto yspan = cache->yrspan();
+  cds::block3D_vectorno free_blocks;
+  cads::acache_vectorro nearby;
+
+  /*
+   * Only blocks/caches in index cells the new cache overlaps can overlap it;
+   * duplicates from spanning multiple cells are harmless.
+   */
+  cells_visit(xspan, yspan, [&](key_type k) {
+    auto bit = m_block_cells.find(k);
+    if (m_block_cells.end() != bit) {
+      for (auto* b : bit->second) {
+        if (!b->is_carried_by_robot() &&
+            m_accepted_blocks.end() == m_accepted_blocks.find(b->id().v()) &&
+            !cache->contains_block(b)) {
+          free_blocks.push_back(b);
+        }
+      } /* for(*b..) */
+    }
+    auto cit = m_cache_cells.find(k);
+    if (m_cache_cells.end() != cit) {
+      nearby.insert(nearby.end(), cit->second.begin(), cit->second.end());
+    }
+  });
+
+  ER_CHECK(sanity_check_internal_consistency(cache),
+           "Cache%d@%s/%s not internally consistent",
+           cache->id().v(),
+           rcppsw::to_string(cache->rcenter2D()).c_str(),
+           rcppsw::to_string(cache->dcenter2D()).c_str());
+  ER_CHECK(sanity_check_free_block_overlap(cache, free_blocks),
+           "Cache%d overlaps with free blocks",
+           cache->id().v());
+
+  if (!mc_strict_constraints) {
+    ER_CHECK(sanity_check_block_cluster_overlap(cache, c_clusters),
+             "Cache%d overlaps with one or more block clusters",
+             cache->id().v());
+  }
+  ER_CHECK(sanity_check_nest_overlap(cache, m_map->nests()),
+           "Cache%d overlaps with one or more nests",
+           cache->id().v());
+
+  ER_CHECK(cache->blocks().end() == std::adjacent_find(cache->blocks().begin(),
+                                                       cache->blocks().end()),
+           "Multiple blocks with the same ID in cache%d",
+           cache->id().v());
+  for (const auto* b : cache->blocks()) {
+    ER_CHECK(m_accepted_blocks.end() == m_accepted_blocks.find(b->id().v()),
+             "Block%d in cache%d already contained in another cache",
+             b->id().v(),
+             cache->id().v());
+  } /* for(*b..) */
+
+  nearby.push_back(cache);
+  ER_CHECK(sanity_check_cache_overlap(nearby),
+           "Cache%d overlaps with one or more caches",
+           cache->id().v());
+  return true;
+
+error:
+  return false;
+} /* verify_new() */
+
+void cache_creation_verifier::accept(const carepr::arena_cache* cache) {
+  m_accepted.push_back(cache);
+  for (const auto* b : cache->blocks()) {
+    m_accepted_blocks.insert(b->id().v());
+  } /* for(*b..) */
+  cells_visit(cache->xrspan(), cache->yrspan(), [&](key_type k) {
+    m_cache_cells[k].push_back(cache);
+  });
+} /* accept() */
+
+int cache_creation_verifier::cell_coord(double v) const {
+  return static_cast<int>(std::floor(v / mc_cache_dim.v()));
+} /* cell_coord() */
 
 bool cache_creation_verifier::sanity_checks(
     const cads::acache_vectorro& c_caches,
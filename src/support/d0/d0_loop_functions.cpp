@@ -26,11 +26,9 @@
 #include <boost/mpl/for_each.hpp>
 
 #include "cosm/arena/config/arena_map_config.hpp"
-#include "cosm/controller/operations/applicator.hpp"
 #include "cosm/foraging/block_dist/base_distributor.hpp"
 #include "cosm/foraging/metrics/block_transportee_metrics_collector.hpp"
 #include "cosm/foraging/oracle/foraging_oracle.hpp"
-#include "cosm/interactors/applicator.hpp"
 #include "cosm/pal/argos_convergence_calculator.hpp"
 #include "cosm/pal/argos_swarm_iterator.hpp"
 #include "cosm/pal/pal.hpp"
@@ -46,7 +44,6 @@
 #include "fordyca/support/d0/robot_arena_interactor.hpp"
 #include "fordyca/support/d0/robot_configurer.hpp"
 #include "fordyca/support/d0/robot_configurer_applicator.hpp"
-#include "fordyca/support/d0/robot_los_update_applicator.hpp"
 #include "fordyca/support/tv/tv_manager.hpp"
 
 /*******************************************************************************
@@ -88,13 +85,64 @@ struct functor_maps_initializer {
         typeid(controller),
         robot_configurer<T>(
             lf->config()->config_get<cvconfig::visualization_config>(),
-            lf->oracle()));
+            lf->oracle(),
+            lf->oracle_knowledge()));
     lf->m_los_update_map->emplace(
         typeid(controller),
         ccops::robot_los_update<T,
                                 rds::grid2D_overlay<cds::cell2D>,
                                 repr::forager_los>(
             lf->arena_map()->decoratee().template layer<cds::arena_grid::kCell>()));
+    lf->m_intent_map->emplace(typeid(controller),
+                              interaction_intent_extractor<T>(lf->arena_map()));
+    dispatch_register(controller);
+  }
+
+  /**
+   * \brief Bind the functors for controller type \p T emplaced in the maps to a
+   * dispatch slot for the robots of that type.
+   */
+  template <typename T>
+  RCPPSW_COLD void dispatch_register(const T& controller) const {
+    using los_update_type = ccops::robot_los_update<
+        T,
+        rds::grid2D_overlay<cds::cell2D>,
+        repr::forager_los>;
+    using interactor_type = robot_arena_interactor<T, carena::caching_arena_map>;
+    using metrics_type = ccops::metrics_extract<T, d0_metrics_aggregator>;
+
+    auto* interactor = &boost::get<interactor_type>(
+        lf->m_interactor_map->at(typeid(controller)));
+    auto* metrics = &boost::get<metrics_type>(
+        lf->m_metrics_map->at(typeid(controller)));
+    const auto* extractor = &boost::get<interaction_intent_extractor<T>>(
+        lf->m_intent_map->at(typeid(controller)));
+
+    robot_dispatch_slot slot;
+
+    /* If the controller is not derived from DPO, there is no LOS to update */
+    if constexpr (std::is_base_of<controller::cognitive::d0::dpo_controller,
+                                  T>::value) {
+      auto* los_update = &boost::get<los_update_type>(
+          lf->m_los_update_map->at(typeid(controller)));
+      slot.los_update = [los_update](controller::foraging_controller* c) {
+        (*los_update)(static_cast<T*>(c));
+      };
+    } else {
+      slot.los_update = [](controller::foraging_controller*) {};
+    }
+    slot.intent = [extractor](const controller::foraging_controller* c) {
+      return (*extractor)(static_cast<const T*>(c));
+    };
+    slot.interact = [interactor](controller::foraging_controller* c,
+                                 const interaction_intent& intent,
+                                 const rtypes::timestep& t) {
+      return (*interactor)(*static_cast<T*>(c), intent, t);
+    };
+    slot.metrics_extract = [metrics](controller::foraging_controller* c) {
+      (*metrics)(static_cast<T*>(c));
+    };
+    lf->m_dispatch.type_register(typeid(controller), std::move(slot));
   }
 
   /* clang-format off */
@@ -113,7 +161,8 @@ d0_loop_functions::d0_loop_functions(void)
       m_metrics_agg(nullptr),
       m_interactor_map(nullptr),
       m_metrics_map(nullptr),
-      m_los_update_map(nullptr) {}
+      m_los_update_map(nullptr),
+      m_intent_map(nullptr) {}
 
 d0_loop_functions::~d0_loop_functions(void) = default;
 
@@ -151,6 +200,7 @@ void d0_loop_functions::private_init(void) {
   m_interactor_map = std::make_unique<interactor_map_type>();
   m_los_update_map = std::make_unique<los_updater_map_type>();
   m_metrics_map = std::make_unique<metric_extraction_map_type>();
+  m_intent_map = std::make_unique<intent_extractor_map_type>();
 
   /* only needed for initialization, so not a member */
   auto config_map = configurer_map_type();
@@ -161,6 +211,7 @@ void d0_loop_functions::private_init(void) {
    */
   detail::functor_maps_initializer f_initializer(&config_map, this);
   boost::mpl::for_each<controller::d0::typelist>(f_initializer);
+  m_dispatch.resolve(this);
 
   /* configure robots */
   auto cb = [&](auto* controller) {
@@ -190,10 +241,18 @@ void d0_loop_functions::pre_step(void) {
   ndc_push();
   base_loop_functions::pre_step();
   ndc_pop();
+
+  /* The swarm may have changed due to population dynamics */
+  if (swarm_changed(m_dispatch.n_resolved())) {
+    m_dispatch.resolve(this);
+    snapshot_pool_attach();
+  }
+
   /* Process all robots */
   auto cb = [&](argos::CControllableEntity* robot) {
     ndc_push();
-    robot_pre_step(dynamic_cast<chal::robot&>(robot->GetParent()));
+    robot_pre_step(
+        static_cast<controller::foraging_controller*>(&robot->GetController()));
     ndc_pop();
   };
   cpal::argos_swarm_iterator::robots<cpal::iteration_order::ekDYNAMIC>(this, cb);
@@ -204,15 +263,33 @@ void d0_loop_functions::post_step(void) {
   base_loop_functions::post_step();
   ndc_pop();
 
-  /* Process all robots: interact with environment then collect metrics */
+  /*
+   * Process all robots in two phases:
+   *
+   * 1. In parallel, have robots decide how they will interact with the
+   *    environment this timestep and defer those decisions, and collect
+   *    metrics from robots which will not interact with it.
+   *
+   * 2. Serially, in robot ID order, apply all deferred decisions which are
+   *    still valid and then collect metrics from the robots. This avoids
+   *    contention on the arena map locks, and makes the outcome of conflicting
+   *    interactions independent of thread scheduling.
+   */
+  m_interactions.reset(
+      GetSpace().GetEntitiesByType(cpal::kARGoSRobotType).size());
   auto cb = [&](argos::CControllableEntity* robot) {
     ndc_push();
-    robot_post_step(dynamic_cast<chal::robot&>(robot->GetParent()));
+    robot_post_step(
+        static_cast<controller::foraging_controller*>(&robot->GetController()));
     ndc_pop();
   };
   cpal::argos_swarm_iterator::robots<cpal::iteration_order::ekDYNAMIC>(this, cb);
 
   ndc_push();
+  m_interactions.merge([&](controller::foraging_controller* controller,
+                           const interaction_intent& intent) {
+    robot_post_step_merge(controller, intent);
+  });
 
   const auto* collector =
       m_metrics_agg->get<cfmetrics::block_transportee_metrics_collector>("blocks:"
@@ -262,10 +339,8 @@ void d0_loop_functions::reset(void) {
 /*******************************************************************************
  * General Member Functions
  ******************************************************************************/
-void d0_loop_functions::robot_pre_step(chal::robot& robot) {
-  auto* controller = static_cast<controller::foraging_controller*>(
-      &robot.GetControllableEntity().GetController());
-
+void d0_loop_functions::robot_pre_step(
+    controller::foraging_controller* controller) {
   /*
    * Update robot position, time. This can't be done as part of the robot's
    * control step because we need access to information only available in the
@@ -275,63 +350,58 @@ void d0_loop_functions::robot_pre_step(chal::robot& robot) {
                              arena_map()->grid_resolution());
 
   /* Send robot its new LOS */
-  auto it = m_los_update_map->find(controller->type_index());
-  ER_ASSERT(m_los_update_map->end() != it,
-            "Controller '%s' type '%s' not in d0 LOS update map",
-            controller->GetId().c_str(),
-            controller->type_index().name());
-  auto applicator = robot_los_update_applicator(controller);
-  boost::apply_visitor(applicator,
-                       m_los_update_map->at(controller->type_index()));
+  m_dispatch[controller].los_update(controller);
 } /* robot_pre_step() */
 
-void d0_loop_functions::robot_post_step(chal::robot& robot) {
-  auto* controller = static_cast<controller::foraging_controller*>(
-      &robot.GetControllableEntity().GetController());
+void d0_loop_functions::robot_post_step(
+    controller::foraging_controller* controller) {
   /*
-   * Watch the robot interact with its environment after physics have been
-   * updated and its controller has run.
+   * Robots which will interact with the environment decide how now, and are
+   * deferred so that all arena map modifications happen serially in a
+   * deterministic order; everything else can be finished now.
    */
-  auto it = m_interactor_map->find(controller->type_index());
-  ER_ASSERT(m_interactor_map->end() != it,
-            "Controller '%s' type '%s' not in d0 interactor map",
-            controller->GetId().c_str(),
-            controller->type_index().name());
-
-  auto iapplicator = cinteractors::applicator<controller::foraging_controller,
-                                              d0::robot_arena_interactor,
-                                              carena::caching_arena_map>(
-                                                  controller,
-                                                  timestep());
-  auto status = boost::apply_visitor(
-      iapplicator, m_interactor_map->at(controller->type_index()));
+  auto intent = m_dispatch[controller].intent(controller);
+  if (interaction_kind::ekNONE != intent.kind) {
+    m_interactions.defer(controller, intent);
+  } else {
+    robot_metrics_collect(controller);
+  }
+} /* robot_post_step() */
 
+void d0_loop_functions::robot_post_step_merge(
+    controller::foraging_controller* controller,
+    const interaction_intent& intent) {
   /*
-   * The oracle does not necessarily have up-to-date information about all
-   * blocks in the arena, as a robot could have dropped a block in the nest or
-   * picked one up, so its version of the set of free blocks in the arena is out
-   * of date. Robots processed *after* the robot that caused the event need
-   * the correct free block set to be available from the oracle upon request, to
-   * avoid asserts during on debug builds. On optimized builds the asserts are
-   * ignored/compiled out, which is not a problem, because the LOS processing
-   * errors that can result are transient and are corrected the next
-   * timestep. See FORDYCA#577.
+   * Watch the robot interact with its environment after physics have been
+   * updated and its controller has run.
    */
-  if (interactor_status::ekNO_EVENT != status && nullptr != oracle()) {
-    oracle()->update(arena_map());
+  /* a robot with a lower ID may have taken what this robot targeted */
+  if (!interaction_valid(controller, intent)) {
+    robot_metrics_collect(controller);
+    return;
   }
+  auto carried = carried_block(controller);
+  auto status = m_dispatch[controller].interact(controller, intent, timestep());
+  snapshot_pool_notify(carried, controller);
 
   /*
-   * Collect metrics from robot, now that it has finished interacting with the
-   * environment and no more changes to its state will occur this timestep.
+   * The oracle's knowledge of the free blocks in the arena is out of date if
+   * the robot dropped a block in the nest or picked one up. Robots processed
+   * *after* the robot that caused the event need the correct free block set to
+   * be available from the oracle upon request, to avoid asserts on debug
+   * builds, so the change is applied to it now, rather than rebuilding it from
+   * the arena. See FORDYCA#577.
    */
-  auto mapplicator = ccops::applicator<controller::foraging_controller,
-                                       ccops::metrics_extract,
-                                       d0_metrics_aggregator>(controller);
-  boost::apply_visitor(mapplicator, m_metrics_map->at(controller->type_index()));
+  oracle_notify(carried, controller, status);
 
+  robot_metrics_collect(controller);
+} /* robot_post_step_merge() */
+
+void d0_loop_functions::robot_metrics_collect(
+    controller::foraging_controller* controller) {
+  m_dispatch[controller].metrics_extract(controller);
   controller->block_manip_recorder()->reset();
-} /* robot_post_step() */
+} /* robot_metrics_collect() */
 
 using namespace argos; // NOLINT
 
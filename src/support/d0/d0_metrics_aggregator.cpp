@@ -46,6 +46,8 @@
 #include "fordyca/metrics/perception/dpo_perception_metrics_collector.hpp"
 #include "fordyca/metrics/perception/mdpo_perception_metrics.hpp"
 #include "fordyca/metrics/perception/mdpo_perception_metrics_collector.hpp"
+#include "fordyca/metrics/perception/selection_memo_metrics.hpp"
+#include "fordyca/metrics/perception/selection_memo_metrics_collector.hpp"
 
 /*******************************************************************************
  * Namespaces
@@ -54,7 +56,8 @@ NS_START(fordyca, support, d0, detail);
 
 using collector_typelist = rmpl::typelist<
     rmpl::identity<metrics::perception::mdpo_perception_metrics_collector>,
-    rmpl::identity<metrics::perception::dpo_perception_metrics_collector> >;
+    rmpl::identity<metrics::perception::dpo_perception_metrics_collector>,
+    rmpl::identity<metrics::perception::selection_memo_metrics_collector> >;
 
 NS_END(detail);
 
@@ -76,6 +79,10 @@ d0_metrics_aggregator::d0_metrics_aggregator(
     { typeid(metrics::perception::dpo_perception_metrics_collector),
       "perception_dpo",
       "perception::dpo",
+      rmetrics::output_mode::ekAPPEND },
+    { typeid(metrics::perception::selection_memo_metrics_collector),
+      "perception_selection_memo",
+      "perception::selection_memo",
       rmetrics::output_mode::ekAPPEND }
   };
 
@@ -153,6 +160,15 @@ void d0_metrics_aggregator::collect_from_controller(const T* const controller) {
   if (nullptr != dpo) {
     collect("perception::dpo", *dpo);
   }
+  /*
+   * Only controllers which select blocks from their DPO store provide these.
+   */
+  const auto* memo =
+      dynamic_cast<const metrics::perception::selection_memo_metrics*>(
+          controller);
+  if (nullptr != memo) {
+    collect("perception::selection_memo", *memo);
+  }
 } /* collect_from_controller() */
 
 /*******************************************************************************
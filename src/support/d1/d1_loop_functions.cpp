@@ -32,7 +32,6 @@
 #include "cosm/foraging/metrics/block_transportee_metrics_collector.hpp"
 #include "cosm/foraging/oracle/foraging_oracle.hpp"
 #include "cosm/hal/subsystem/config/saa_xml_names.hpp"
-#include "cosm/interactors/applicator.hpp"
 #include "cosm/oracle/config/aggregate_oracle_config.hpp"
 #include "cosm/pal/argos_convergence_calculator.hpp"
 #include "cosm/pal/argos_swarm_iterator.hpp"
@@ -66,44 +65,6 @@ using configurer_map_type =
                                             robot_configurer,
                                             d1_metrics_aggregator>::type>;
 
-template <class Controller>
-struct d1_subtask_status_extractor
-    : public boost::static_visitor<std::pair<bool, bool>> {
-  using controller_type = Controller;
-
-  std::pair<bool, bool> operator()(const Controller* const c) const {
-    const auto* task = dynamic_cast<const cta::polled_task*>(c->current_task());
-    return std::make_pair(
-        task->name() == tasks::d1::foraging_task::kHarvesterName,
-        task->name() == tasks::d1::foraging_task::kCollectorName);
-  }
-};
-
-/**
- * \struct d1_subtask_status_extractor_adaptor
- * \ingroup support d1
- *
- * \brief Calculate the \ref collector, \ref harvester task counts for d1
- * when a static cache is depleted, for use in determining the static cache
- * respawn probability.
- */
-struct d1_subtask_status_extractor_adaptor
-    : public boost::static_visitor<std::pair<bool, bool>> {
-  explicit d1_subtask_status_extractor_adaptor(
-      const controller::foraging_controller* const c)
-      : mc_controller(c) {}
-
-  template <typename Controller>
-  std::pair<bool, bool>
-  operator()(const d1_subtask_status_extractor<Controller>& extractor) const {
-    const auto* cast = dynamic_cast<
-        const typename d1_subtask_status_extractor<Controller>::controller_type*>(
-        mc_controller);
-    return extractor(cast);
-  }
-  const controller::foraging_controller* const mc_controller;
-};
-
 /**
  * \struct functor_maps_initializer
  * \ingroup support d1 detail
@@ -134,13 +95,12 @@ struct functor_maps_initializer : public boost::static_visitor<void> {
         typeid(controller),
         ccops::metrics_extract<T, d1_metrics_aggregator>(
             lf->m_metrics_agg.get()));
-    lf->m_task_extractor_map->emplace(typeid(controller),
-                                      ccops::task_id_extract<T>());
     config_map->emplace(
         typeid(controller),
         robot_configurer<T, d1_metrics_aggregator>(
             lf->config()->config_get<cvconfig::visualization_config>(),
             lf->oracle(),
+            lf->oracle_knowledge(),
             lf->m_metrics_agg.get()));
     lf->m_los_update_map->emplace(
         typeid(controller),
@@ -148,8 +108,49 @@ struct functor_maps_initializer : public boost::static_visitor<void> {
                                 rds::grid2D_overlay<cds::cell2D>,
                                 repr::forager_los>(
             lf->arena_map()->decoratee().template layer<cds::arena_grid::kCell>()));
-    lf->m_subtask_status_map->emplace(typeid(controller),
-                                      d1_subtask_status_extractor<T>());
+    lf->m_intent_map->emplace(typeid(controller),
+                              interaction_intent_extractor<T>(lf->arena_map()));
+    dispatch_register(controller);
+  }
+
+  /**
+   * \brief Bind the functors for controller type \p T emplaced in the maps to a
+   * dispatch slot for the robots of that type.
+   */
+  template <typename T>
+  RCPPSW_COLD void dispatch_register(const T& controller) const {
+    using los_update_type = ccops::robot_los_update<
+        T,
+        rds::grid2D_overlay<cds::cell2D>,
+        repr::forager_los>;
+    using interactor_type = robot_arena_interactor<T, carena::caching_arena_map>;
+    using metrics_type = ccops::metrics_extract<T, d1_metrics_aggregator>;
+
+    auto* los_update = &boost::get<los_update_type>(
+        lf->m_los_update_map->at(typeid(controller)));
+    auto* interactor = &boost::get<interactor_type>(
+        lf->m_interactor_map->at(typeid(controller)));
+    auto* metrics = &boost::get<metrics_type>(
+        lf->m_metric_extractor_map->at(typeid(controller)));
+    const auto* extractor = &boost::get<interaction_intent_extractor<T>>(
+        lf->m_intent_map->at(typeid(controller)));
+
+    robot_dispatch_slot slot;
+    slot.los_update = [los_update](controller::foraging_controller* c) {
+      (*los_update)(static_cast<T*>(c));
+    };
+    slot.intent = [extractor](const controller::foraging_controller* c) {
+      return (*extractor)(static_cast<const T*>(c));
+    };
+    slot.interact = [interactor](controller::foraging_controller* c,
+                                 const interaction_intent& intent,
+                                 const rtypes::timestep& t) {
+      return (*interactor)(*static_cast<T*>(c), intent, t);
+    };
+    slot.metrics_extract = [metrics](controller::foraging_controller* c) {
+      (*metrics)(static_cast<T*>(c));
+    };
+    lf->m_dispatch.type_register(typeid(controller), std::move(slot));
   }
 
   /* clang-format off */
@@ -168,8 +169,7 @@ d1_loop_functions::d1_loop_functions(void)
       m_interactor_map(nullptr),
       m_metric_extractor_map(nullptr),
       m_los_update_map(nullptr),
-      m_task_extractor_map(nullptr),
-      m_subtask_status_map(nullptr),
+      m_intent_map(nullptr),
       m_metrics_agg(nullptr),
       m_cache_manager(nullptr) {}
 
@@ -246,8 +246,7 @@ void d1_loop_functions::private_init(void) {
   m_interactor_map = std::make_unique<interactor_map_type>();
   m_metric_extractor_map = std::make_unique<metric_extractor_map_type>();
   m_los_update_map = std::make_unique<los_updater_map_type>();
-  m_task_extractor_map = std::make_unique<task_extractor_map_type>();
-  m_subtask_status_map = std::make_unique<detail::d1_subtask_status_map_type>();
+  m_intent_map = std::make_unique<intent_extractor_map_type>();
 
   /* only needed for initialization, so not a member */
   auto config_map = detail::configurer_map_type();
@@ -258,6 +257,7 @@ void d1_loop_functions::private_init(void) {
    */
   detail::functor_maps_initializer f_initializer(&config_map, this);
   boost::mpl::for_each<controller::d1::typelist>(f_initializer);
+  m_dispatch.resolve(this);
 
   /* configure robots */
   auto cb = [&](auto* controller) {
@@ -279,6 +279,12 @@ void d1_loop_functions::private_init(void) {
   cpal::argos_swarm_iterator::controllers<controller::foraging_controller,
                                           cpal::iteration_order::ekSTATIC>(
       this, cb, cpal::kARGoSRobotType);
+
+  /*
+   * Robots may have been allocated tasks before their task callbacks were
+   * bound above, so the census has to start from what they are executing now.
+   */
+  m_metrics_agg->census()->seed(this);
 } /* private_init() */
 
 void d1_loop_functions::oracle_init(void) {
@@ -329,6 +335,9 @@ void d1_loop_functions::cache_handling_init(
           ccp, arena_map()->free_blocks(true), pre_dist)) {
     arena_map()->caches_add(*created, this);
     floor()->SetChanged();
+
+    /* new caches absorb free blocks, so any block may have changed */
+    arena_changed();
   }
 } /* cache_handling_init() */
 
@@ -336,24 +345,7 @@ void d1_loop_functions::cache_handling_init(
  * Convergence Calculations Callbacks
  ******************************************************************************/
 std::vector<int> d1_loop_functions::robot_tasks_extract(uint) const {
-  std::vector<int> v;
-  auto cb = [&](auto* controller) {
-    auto it = m_task_extractor_map->find(controller->type_index());
-    ER_ASSERT(m_task_extractor_map->end() != it,
-              "Controller '%s' type '%s' not in d1 task extractor map",
-              controller->GetId().c_str(),
-              controller->type_index().name());
-    auto applicator =
-        ccops::applicator<controller::foraging_controller, ccops::task_id_extract>(
-            controller);
-
-    v.push_back(boost::apply_visitor(
-        applicator, m_task_extractor_map->at(controller->type_index())));
-  };
-  cpal::argos_swarm_iterator::controllers<controller::foraging_controller,
-                                          cpal::iteration_order::ekSTATIC>(
-      this, cb, cpal::kARGoSRobotType);
-  return v;
+  return m_metrics_agg->census()->distribution(m_dispatch.n_resolved());
 } /* robot_tasks_extract() */
 
 /*******************************************************************************
@@ -364,10 +356,18 @@ void d1_loop_functions::pre_step() {
   base_loop_functions::pre_step();
   ndc_pop();
 
+  /* The swarm may have changed due to population dynamics */
+  if (swarm_changed(m_dispatch.n_resolved())) {
+    m_dispatch.resolve(this);
+    m_metrics_agg->census()->seed(this);
+    snapshot_pool_attach();
+  }
+
   /* Process all robots */
   auto cb = [&](argos::CControllableEntity* robot) {
     ndc_push();
-    robot_pre_step(dynamic_cast<chal::robot&>(robot->GetParent()));
+    robot_pre_step(
+        static_cast<controller::foraging_controller*>(&robot->GetController()));
     ndc_pop();
   };
   cpal::argos_swarm_iterator::robots<cpal::iteration_order::ekDYNAMIC>(this, cb);
@@ -382,30 +382,38 @@ void d1_loop_functions::post_step(void) {
    * Parallel iteration over the swarm within the following set of ordered
    * tasks:
    *
-   * - Metric collection
-   * - Task counts collection
+   * - Deferral of how robots will interact with the environment, metric
+   *   collection for all others.
    *
    * This has to all be in 1 callback when passing to ARGoS, because we are only
    * allowed 1 usage of ARGoS threads per PreStep()/PostStep() function call.
    */
+  m_interactions.reset(
+      GetSpace().GetEntitiesByType(cpal::kARGoSRobotType).size());
   auto cb = [&](argos::CControllableEntity* robot) {
     ndc_push();
-    robot_post_step(dynamic_cast<chal::robot&>(robot->GetParent()));
-    caches_recreation_task_counts_collect(
-        &static_cast<controller::foraging_controller&>(robot->GetController()));
+    robot_post_step(
+        static_cast<controller::foraging_controller*>(&robot->GetController()));
     ndc_pop();
   };
   cpal::argos_swarm_iterator::robots<cpal::iteration_order::ekDYNAMIC>(this, cb);
 
   ndc_push();
 
+  /*
+   * Serially process deferred robot interactions in robot ID order, so that
+   * conflicting interactions are resolved deterministically.
+   */
+  m_interactions.merge([&](controller::foraging_controller* controller,
+                           const interaction_intent& intent) {
+    robot_post_step_merge(controller, intent);
+  });
+
   /*
    * Manage the static cache and handle cache removal/re-creation as a result of
    * robot interactions with arena.
    */
   static_cache_monitor();
-  m_cache_counts.n_harvesters = 0;
-  m_cache_counts.n_collectors = 0;
 
   /* update arena map */
   const auto* collector =
@@ -469,6 +477,7 @@ void d1_loop_functions::reset(void) {
   ndc_push();
   base_loop_functions::reset();
   m_metrics_agg->reset_all();
+  m_metrics_agg->census()->seed(this);
 
   cache_create_ro_params ccp = {
     .current_caches = arena_map()->caches(),
@@ -481,6 +490,7 @@ void d1_loop_functions::reset(void) {
                                              false)) {
     arena_map()->caches_add(*created, this);
     floor()->SetChanged();
+    arena_changed();
   }
   ndc_pop();
 } /* reset() */
@@ -494,10 +504,8 @@ void d1_loop_functions::destroy(void) {
 /*******************************************************************************
  * General Member Functions
  ******************************************************************************/
-void d1_loop_functions::robot_pre_step(chal::robot& robot) {
-  auto* controller = static_cast<controller::foraging_controller*>(
-      &robot.GetControllableEntity().GetController());
-
+void d1_loop_functions::robot_pre_step(
+    controller::foraging_controller* controller) {
   /*
    * Update robot position, time. This can't be done as part of the robot's
    * control step because we need access to information only available in the
@@ -507,79 +515,58 @@ void d1_loop_functions::robot_pre_step(chal::robot& robot) {
                              arena_map()->grid_resolution());
 
   /* Send robot its new LOS */
-  auto it = m_los_update_map->find(controller->type_index());
-  ER_ASSERT(m_los_update_map->end() != it,
-            "Controller '%s' type '%s' not in d1 LOS Update map",
-            controller->GetId().c_str(),
-            controller->type_index().name());
-
-  auto applicator = ccops::applicator<controller::foraging_controller,
-                                      ccops::robot_los_update,
-                                      rds::grid2D_overlay<cds::cell2D>,
-                                      repr::forager_los>(controller);
-  boost::apply_visitor(applicator,
-                       m_los_update_map->at(controller->type_index()));
+  m_dispatch[controller].los_update(controller);
 } /* robot_pre_step() */
 
-void d1_loop_functions::robot_post_step(chal::robot& robot) {
-  auto* controller = static_cast<controller::foraging_controller*>(
-      &robot.GetControllableEntity().GetController());
-
+void d1_loop_functions::robot_post_step(
+    controller::foraging_controller* controller) {
   /*
-   * Watch the robot interact with its environment after physics have been
-   * updated and its controller has run.
+   * Robots which will interact with the environment decide how now, and are
+   * deferred so that all arena map modifications happen serially in a
+   * deterministic order; everything else can be finished now.
    */
-  auto it = m_interactor_map->find(controller->type_index());
-  ER_ASSERT(m_interactor_map->end() != it,
-            "Controller '%s' type '%s' not in d1 interactor map",
-            controller->GetId().c_str(),
-            controller->type_index().name());
-  auto iapplicator = cinteractors::applicator<controller::foraging_controller,
-                                              robot_arena_interactor,
-                                              carena::caching_arena_map>(
-                                                  controller,
-                                                  timestep());
-
-  auto status = boost::apply_visitor(
-      iapplicator, m_interactor_map->at(controller->type_index()));
+  auto intent = m_dispatch[controller].intent(controller);
+  if (interaction_kind::ekNONE != intent.kind) {
+    m_interactions.defer(controller, intent);
+  } else {
+    robot_metrics_collect(controller);
+  }
+} /* robot_post_step() */
 
+void d1_loop_functions::robot_post_step_merge(
+    controller::foraging_controller* controller,
+    const interaction_intent& intent) {
   /*
-   * The oracle does not necessarily have up-to-date information about all
-   * blocks in the arena, as a robot could have dropped a block in the nest or
-   * picked one up, so its version of the set of free blocks in the arena is out
-   * of date. Robots processed *after* the robot that caused the event need
-   * the correct free block set to be available from the oracle upon request, to
-   * avoid asserts during on debug builds. On optimized builds the asserts are
-   * ignored/compiled out, which is not a problem, because they LOS processing
-   * errors that can result are transient and are corrected the next
-   * timestep.
-   *
-   * This is not a problem for caches, because caches are created (if needed)
-   * after *all* robots have been processed for the given timestep.
-   *
-   * See FORDYCA#577.
+   * Watch the robot interact with its environment after physics have been
+   * updated and its controller has run.
    */
-  if (interactor_status::ekNO_EVENT != status && nullptr != oracle()) {
-    oracle()->update(arena_map());
+  /* a robot with a lower ID may have taken what this robot targeted */
+  if (!interaction_valid(controller, intent)) {
+    robot_metrics_collect(controller);
+    return;
   }
+  auto carried = carried_block(controller);
+  auto status = m_dispatch[controller].interact(controller, intent, timestep());
+  snapshot_pool_notify(carried, controller);
 
   /*
-   * Collect metrics from robot, now that it has finished interacting with the
-   * environment and no more changes to its state will occur this timestep.
+   * The oracle's knowledge of the free blocks/caches in the arena is out of
+   * date if the robot dropped a block in the nest, picked one up, or depleted a
+   * cache. Robots processed *after* the robot that caused the event need the
+   * correct sets to be available from the oracle upon request, to avoid
+   * asserts on debug builds, so the change is applied to them now, rather than
+   * rebuilding them from the arena. See FORDYCA#577.
    */
-  auto it2 = m_metric_extractor_map->find(controller->type_index());
-  ER_ASSERT(m_metric_extractor_map->end() != it2,
-            "Controller '%s' type '%s' not in d1 metrics map",
-            controller->GetId().c_str(),
-            controller->type_index().name());
-
-  auto mapplicator = ccops::applicator<controller::foraging_controller,
-                                       ccops::metrics_extract,
-                                       d1_metrics_aggregator>(controller);
-  boost::apply_visitor(mapplicator,
-                       m_metric_extractor_map->at(controller->type_index()));
+  oracle_notify(carried, controller, status);
+
+  robot_metrics_collect(controller);
+} /* robot_post_step_merge() */
+
+void d1_loop_functions::robot_metrics_collect(
+    controller::foraging_controller* controller) {
+  m_dispatch[controller].metrics_extract(controller);
   controller->block_manip_recorder()->reset();
-} /* robot_post_step() */
+} /* robot_metrics_collect() */
 
 void d1_loop_functions::static_cache_monitor(void) {
   /* nothing to do--all our managed caches exist */
@@ -593,50 +580,34 @@ void d1_loop_functions::static_cache_monitor(void) {
     .t = timestep(),
   };
 
+  /*
+   * Caches are recreated with a probability that depends on the relative ratio
+   * between the # harvesters and the # collectors. If there are more harvesters
+   * than collectors, then the cache will be recreated very quickly. If there
+   * are more collectors than harvesters, then it will probably not be recreated
+   * immediately. And if there are no harvesters, there is no chance that the
+   * cache could be recreated (trying to emulate d2 behavior here).
+   */
+  const auto* census = m_metrics_agg->census();
   if (auto created =
           m_cache_manager->create_conditional(ccp,
                                               arena_map()->free_blocks(false),
-                                              m_cache_counts.n_harvesters,
-                                              m_cache_counts.n_collectors)) {
+                                              census->n_harvesters(),
+                                              census->n_collectors())) {
     arena_map()->caches_add(*created, this);
     floor()->SetChanged();
+    arena_changed();
     return;
   }
-  ER_INFO("Could not create static caches: n_harvesters=%u,n_collectors=%u",
-          m_cache_counts.n_harvesters.load(),
-          m_cache_counts.n_collectors.load());
+  ER_INFO("Could not create static caches: n_harvesters=%zu,n_collectors=%zu",
+          census->n_harvesters(),
+          census->n_collectors());
 } /* static_cache_monitor() */
 
 bool d1_loop_functions::caches_depleted(void) const {
   return arena_map()->caches().size() != m_cache_manager->n_managed();
 } /* caches_depleted() */
 
-void d1_loop_functions::caches_recreation_task_counts_collect(
-    const controller::foraging_controller* const controller) {
-  if (caches_depleted()) {
-    auto it = m_subtask_status_map->find(controller->type_index());
-    ER_ASSERT(m_subtask_status_map->end() != it,
-              "Controller '%s' type '%s' not in d1 subtask status map",
-              controller->GetId().c_str(),
-              controller->type_index().name());
-
-    /*
-     * Caches are recreated with a probability that depends on the relative
-     * ratio between the # harvesters and the # collectors. If there are more
-     * harvesters than collectors, then the cache will be recreated very
-     * quickly. If there are more collectors than harvesters, then it will
-     * probably not be recreated immediately. And if there are no harvesters,
-     * there is no chance that the cache could be recreated (trying to emulate
-     * d2 behavior here).
-     */
-    auto [is_harvester, is_collector] = boost::apply_visitor(
-        detail::d1_subtask_status_extractor_adaptor(controller),
-        m_subtask_status_map->at(controller->type_index()));
-    m_cache_counts.n_harvesters += is_harvester;
-    m_cache_counts.n_collectors += is_collector;
-  }
-} /* caches_recreation_task_counts_collect() */
-
 using namespace argos; // NOLINT
 
 RCPPSW_WARNING_DISABLE_PUSH()
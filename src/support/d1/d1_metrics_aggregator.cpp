@@ -101,6 +101,8 @@ void d1_metrics_aggregator::collect_from_cache_manager(
 
 void d1_metrics_aggregator::task_finish_or_abort_cb(
     const cta::polled_task* const task) {
+  m_census.task_finish_or_abort(task);
+
   /*
    * Both d1 and d2 metrics aggregators are registered on the same
    * callback, so this function will be called for the d2 task abort/finish
@@ -113,8 +115,10 @@ void d1_metrics_aggregator::task_finish_or_abort_cb(
           dynamic_cast<const ctametrics::execution_metrics&>(*task));
 } /* task_finish_or_abort_cb() */
 
-void d1_metrics_aggregator::task_start_cb(const cta::polled_task* const,
+void d1_metrics_aggregator::task_start_cb(const cta::polled_task* const task,
                                           const cta::ds::bi_tab* const tab) {
+  m_census.task_start(task);
+
   /* Not using stochastic nbhd policy */
   if (nullptr == tab) {
     return;
@@ -312,10 +312,8 @@ cds::block3D_vectorno static_cache_manager::cache_i_alloc_from_usable(
 
 bool static_cache_manager::block_alloc_usable_filter(
     const crepr::base_block3D* block,
-    const cads::acache_vectorno& existing_caches,
+    const cads::acache_vectorno&,
     const cfds::block3D_cluster_vectorro&) const {
-  cds::block3D_vectorno cache_i_blocks;
-
   /*
    * Note that the calculations for membership are ordered from least to most
    * computationally expensive to compute, so don't reorder them willy-nilly.
@@ -325,22 +323,18 @@ bool static_cache_manager::block_alloc_usable_filter(
       !block->is_carried_by_robot() &&
 
       /* blocks cannot be in existing caches */
-      std::all_of(existing_caches.begin(),
-                  existing_caches.end(),
-                  [&](const auto& c) { return !c->contains_block(block); });
+      !block_membership().in_cache(block);
 } /* block_alloc_usable_filter() */
 
 
 bool static_cache_manager::block_alloc_absorbable_filter(
     const crepr::base_block3D* block,
-    const cads::acache_vectorno& existing_caches,
+    const cads::acache_vectorno&,
     const cfds::block3D_cluster_vectorro&) {
   /* blocks cannot be carried by a robot */
   return !block->is_carried_by_robot() &&
       /* Blocks cannot be in existing caches */
-      std::all_of(existing_caches.begin(),
-                  existing_caches.end(),
-                  [&](const auto& c) { return !c->contains_block(block); });
+      !block_membership().in_cache(block);
 }/* block_alloc_absorbable_filter() */
 
 cds::block3D_htno static_cache_manager::cache_i_alloc_from_absorbable(
@@ -0,0 +1,158 @@
+/**
+ * \file cache_candidate_clusterer.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/support/d2/cache_candidate_clusterer.hpp"
+
+#include <cmath>
+
+#include "cosm/repr/base_block3D.hpp"
+
+/*******************************************************************************
+ * Namespaces/Decls
+ ******************************************************************************/
+NS_START(fordyca, support, d2);
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+cache_candidate_clusterer::cache_candidate_clusterer(
+    const rtypes::spatial_dist& eps,
+    uint min_pts)
+    : ER_CLIENT_INIT("fordyca.support.d2.cache_candidate_clusterer"),
+      mc_eps(eps),
+      mc_min_pts(min_pts) {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+std::vector<cds::block3D_vectorno> cache_candidate_clusterer::operator()(
+    const cds::block3D_vectorno& c_blocks) const {
+  std::vector<rmath::vector2d> centers;
+  centers.reserve(c_blocks.size());
+  for (const auto* b : c_blocks) {
+    centers.push_back(b->rcenter2D());
+  } /* for(*b..) */
+
+  std::vector<cds::block3D_vectorno> groups;
+  for (const auto& indices : groups_calc(centers)) {
+    groups.emplace_back();
+    for (size_t i : indices) {
+      groups.back().push_back(c_blocks[i]);
+    } /* for(i..) */
+    ER_TRACE("Group%zu: blocks=[%s]",
+             groups.size() - 1,
+             rcppsw::to_string(groups.back()).c_str());
+  } /* for(&indices..) */
+
+  ER_DEBUG("Clustered %zu blocks into %zu groups: eps=%f,min_pts=%u",
+           c_blocks.size(),
+           groups.size(),
+           mc_eps.v(),
+           mc_min_pts);
+  return groups;
+} /* operator()() */
+
+std::vector<std::vector<size_t>> cache_candidate_clusterer::groups_calc(
+    const std::vector<rmath::vector2d>& centers) const {
+  grid_type grid;
+  for (size_t i = 0; i < centers.size(); ++i) {
+    grid[key(cell_coord(centers[i].x()), cell_coord(centers[i].y()))]
+        .push_back(i);
+  } /* for(i..) */
+
+  std::vector<int> labels(centers.size(), kUNVISITED);
+  std::vector<std::vector<size_t>> groups;
+
+  for (size_t i = 0; i < centers.size(); ++i) {
+    if (kUNVISITED != labels[i]) {
+      continue;
+    }
+    auto frontier = neighbors(grid, centers, i);
+    if (frontier.size() < mc_min_pts) {
+      labels[i] = kNOISE;
+      continue;
+    }
+
+    /* block i is a core block: grow a new group from it */
+    int group = static_cast<int>(groups.size());
+    groups.emplace_back();
+    labels[i] = group;
+    groups[group].push_back(i);
+
+    for (size_t k = 0; k < frontier.size(); ++k) {
+      size_t j = frontier[k];
+      if (kNOISE == labels[j]) {
+        /* border block: part of the group, but does not extend it */
+        labels[j] = group;
+        groups[group].push_back(j);
+        continue;
+      }
+      if (kUNVISITED != labels[j]) {
+        continue;
+      }
+      labels[j] = group;
+      groups[group].push_back(j);
+
+      auto reachable = neighbors(grid, centers, j);
+      if (reachable.size() >= mc_min_pts) {
+        frontier.insert(frontier.end(), reachable.begin(), reachable.end());
+      }
+    } /* for(k..) */
+  } /* for(i..) */
+  return groups;
+} /* groups_calc() */
+
+std::vector<size_t> cache_candidate_clusterer::neighbors(
+    const grid_type& grid,
+    const std::vector<rmath::vector2d>& centers,
+    size_t index) const {
+  std::vector<size_t> ret;
+  const auto& center = centers[index];
+  int x = cell_coord(center.x());
+  int y = cell_coord(center.y());
+
+  /*
+   * Cells are as large as epsilon, so any block close enough to be a neighbor
+   * must be in the neighborhood of the cell containing the block.
+   */
+  for (int i = x - 1; i <= x + 1; ++i) {
+    for (int j = y - 1; j <= y + 1; ++j) {
+      auto it = grid.find(key(i, j));
+      if (grid.end() == it) {
+        continue;
+      }
+      for (size_t k : it->second) {
+        if ((centers[k] - center).length() <= mc_eps.v()) {
+          ret.push_back(k);
+        }
+      } /* for(k..) */
+    } /* for(j..) */
+  } /* for(i..) */
+  return ret;
+} /* neighbors() */
+
+int cache_candidate_clusterer::cell_coord(double v) const {
+  return static_cast<int>(std::floor(v / mc_eps.v()));
+} /* cell_coord() */
+
+NS_END(d2, support, fordyca);
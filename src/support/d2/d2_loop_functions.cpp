@@ -34,7 +34,6 @@
 #include "cosm/foraging/metrics/block_transportee_metrics_collector.hpp"
 #include "cosm/foraging/oracle/foraging_oracle.hpp"
 #include "cosm/hal/subsystem/config/saa_xml_names.hpp"
-#include "cosm/interactors/applicator.hpp"
 #include "cosm/pal/argos_convergence_calculator.hpp"
 #include "cosm/pal/argos_swarm_iterator.hpp"
 #include "cosm/ta/bi_tdgraph_executive.hpp"
@@ -95,13 +94,12 @@ struct functor_maps_initializer : public boost::static_visitor<void> {
         typeid(controller),
         ccops::metrics_extract<T, d2_metrics_aggregator>(
             lf->m_metrics_agg.get()));
-    lf->m_task_extractor_map->emplace(typeid(controller),
-                                      ccops::task_id_extract<T>());
     config_map->emplace(
         typeid(controller),
         robot_configurer<T, d2_metrics_aggregator>(
             lf->config()->config_get<cvconfig::visualization_config>(),
             lf->oracle(),
+            lf->oracle_knowledge(),
             lf->m_metrics_agg.get()));
     lf->m_los_update_map->emplace(
         typeid(controller),
@@ -109,6 +107,49 @@ struct functor_maps_initializer : public boost::static_visitor<void> {
                                 rds::grid2D_overlay<cds::cell2D>,
                                 repr::forager_los>(
             lf->arena_map()->decoratee().template layer<cds::arena_grid::kCell>()));
+    lf->m_intent_map->emplace(typeid(controller),
+                              interaction_intent_extractor<T>(lf->arena_map()));
+    dispatch_register(controller);
+  }
+
+  /**
+   * \brief Bind the functors for controller type \p T emplaced in the maps to a
+   * dispatch slot for the robots of that type.
+   */
+  template <typename T>
+  RCPPSW_COLD void dispatch_register(const T& controller) const {
+    using los_update_type = ccops::robot_los_update<
+        T,
+        rds::grid2D_overlay<cds::cell2D>,
+        repr::forager_los>;
+    using interactor_type = robot_arena_interactor<T, carena::caching_arena_map>;
+    using metrics_type = ccops::metrics_extract<T, d2_metrics_aggregator>;
+
+    auto* los_update = &boost::get<los_update_type>(
+        lf->m_los_update_map->at(typeid(controller)));
+    auto* interactor = &boost::get<interactor_type>(
+        lf->m_interactor_map->at(typeid(controller)));
+    auto* metrics = &boost::get<metrics_type>(
+        lf->m_metric_extractor_map->at(typeid(controller)));
+    const auto* extractor = &boost::get<interaction_intent_extractor<T>>(
+        lf->m_intent_map->at(typeid(controller)));
+
+    robot_dispatch_slot slot;
+    slot.los_update = [los_update](controller::foraging_controller* c) {
+      (*los_update)(static_cast<T*>(c));
+    };
+    slot.intent = [extractor](const controller::foraging_controller* c) {
+      return (*extractor)(static_cast<const T*>(c));
+    };
+    slot.interact = [interactor](controller::foraging_controller* c,
+                                 const interaction_intent& intent,
+                                 const rtypes::timestep& t) {
+      return (*interactor)(*static_cast<T*>(c), intent, t);
+    };
+    slot.metrics_extract = [metrics](controller::foraging_controller* c) {
+      (*metrics)(static_cast<T*>(c));
+    };
+    lf->m_dispatch.type_register(typeid(controller), std::move(slot));
   }
 
   /* clang-format off */
@@ -129,7 +170,7 @@ d2_loop_functions::d2_loop_functions(void)
       m_interactor_map(nullptr),
       m_metric_extractor_map(nullptr),
       m_los_update_map(nullptr),
-      m_task_extractor_map(nullptr) {}
+      m_intent_map(nullptr) {}
 
 d2_loop_functions::~d2_loop_functions(void) = default;
 
@@ -184,13 +225,14 @@ void d2_loop_functions::private_init(void) {
   m_interactor_map = std::make_unique<interactor_map_type>();
   m_metric_extractor_map = std::make_unique<metric_extractor_map_type>();
   m_los_update_map = std::make_unique<los_updater_map_type>();
-  m_task_extractor_map = std::make_unique<task_extractor_map_type>();
+  m_intent_map = std::make_unique<intent_extractor_map_type>();
 
   /* only needed for initialization, so not a member */
   auto config_map = detail::configurer_map_type();
 
   detail::functor_maps_initializer f_initializer(&config_map, this);
   boost::mpl::for_each<controller::d2::typelist>(f_initializer);
+  m_dispatch.resolve(this);
 
   /* configure robots */
   auto cb = [&](auto* controller) {
@@ -213,6 +255,12 @@ void d2_loop_functions::private_init(void) {
   cpal::argos_swarm_iterator::controllers<controller::foraging_controller,
                                           cpal::iteration_order::ekSTATIC>(
       this, cb, cpal::kARGoSRobotType);
+
+  /*
+   * Robots may have been allocated tasks before their task callbacks were
+   * bound above, so the census has to start from what they are executing now.
+   */
+  m_metrics_agg->census()->seed(this);
 } /* private_init() */
 
 void d2_loop_functions::cache_handling_init(
@@ -230,23 +278,7 @@ void d2_loop_functions::cache_handling_init(
  * Convergence Calculations Callbacks
  ******************************************************************************/
 std::vector<int> d2_loop_functions::robot_tasks_extract(uint) const {
-  std::vector<int> v;
-  auto cb = [&](auto* controller) {
-    auto it = m_task_extractor_map->find(controller->type_index());
-    ER_ASSERT(m_task_extractor_map->end() != it,
-              "Controller '%s' type '%s' not in d2 task extraction map",
-              controller->GetId().c_str(),
-              controller->type_index().name());
-    auto applicator =
-        ccops::applicator<controller::foraging_controller, ccops::task_id_extract>(
-            controller);
-    v.push_back(boost::apply_visitor(
-        applicator, m_task_extractor_map->at(controller->type_index())));
-  };
-  cpal::argos_swarm_iterator::controllers<controller::foraging_controller,
-                                          cpal::iteration_order::ekSTATIC>(
-      this, cb, cpal::kARGoSRobotType);
-  return v;
+  return m_metrics_agg->census()->distribution(m_dispatch.n_resolved());
 } /* robot_tasks_extract() */
 
 /*******************************************************************************
@@ -257,10 +289,18 @@ void d2_loop_functions::pre_step() {
   base_loop_functions::pre_step();
   ndc_pop();
 
+  /* The swarm may have changed due to population dynamics */
+  if (swarm_changed(m_dispatch.n_resolved())) {
+    m_dispatch.resolve(this);
+    m_metrics_agg->census()->seed(this);
+    snapshot_pool_attach();
+  }
+
   /* Process all robots */
   auto cb = [&](argos::CControllableEntity* robot) {
     ndc_push();
-    robot_pre_step(dynamic_cast<chal::robot&>(robot->GetParent()));
+    robot_pre_step(
+        static_cast<controller::foraging_controller*>(&robot->GetController()));
     ndc_pop();
   };
   cpal::argos_swarm_iterator::robots<cpal::iteration_order::ekDYNAMIC>(this, cb);
@@ -271,25 +311,39 @@ void d2_loop_functions::post_step(void) {
   base_loop_functions::post_step();
   ndc_pop();
 
-  /* Process all robots: environment interactions then collect metrics */
+  /*
+   * Process all robots: defer how those which will interact with the
+   * environment will do so and collect metrics from the rest in parallel, then
+   * serially apply the deferred interactions in robot ID order.
+   */
+  m_interactions.reset(
+      GetSpace().GetEntitiesByType(cpal::kARGoSRobotType).size());
   auto cb = [&](argos::CControllableEntity* robot) {
     ndc_push();
-    robot_post_step(dynamic_cast<chal::robot&>(robot->GetParent()));
+    robot_post_step(
+        static_cast<controller::foraging_controller*>(&robot->GetController()));
     ndc_pop();
   };
   cpal::argos_swarm_iterator::robots<cpal::iteration_order::ekDYNAMIC>(this, cb);
 
   ndc_push();
+  m_interactions.merge([&](controller::foraging_controller* controller,
+                           const interaction_intent& intent) {
+    robot_post_step_merge(controller, intent);
+  });
+
   /*
    * Run dynamic cache creation if it was triggered. We don't wan't to run it
    * unconditionally each timestep, because it is VERRRYYYYY expensive to
    * compute.
    */
-  if (m_dynamic_cache_create) {
+  if (!m_cache_drop_locs.empty()) {
     if (!cache_creation_handle(true)) {
       ER_WARN("Unable to create cache after block drop(s) in new cache");
     }
-    m_dynamic_cache_create = false;
+    m_cache_drop_locs.clear();
+  } else if (cache_creation_global_due()) {
+    cache_creation_handle(false);
   }
 
   /* update arena map */
@@ -353,6 +407,7 @@ void d2_loop_functions::reset(void) {
   ndc_push();
   base_loop_functions::reset();
   m_metrics_agg->reset_all();
+  m_metrics_agg->census()->seed(this);
   cache_creation_handle(false);
   ndc_pop();
 }
@@ -366,10 +421,8 @@ void d2_loop_functions::destroy(void) {
 /*******************************************************************************
  * General Member Functions
  ******************************************************************************/
-void d2_loop_functions::robot_pre_step(chal::robot& robot) {
-  auto* controller = dynamic_cast<controller::foraging_controller*>(
-      &robot.GetControllableEntity().GetController());
-
+void d2_loop_functions::robot_pre_step(
+    controller::foraging_controller* controller) {
   /*
    * Update robot position, time. This can't be done as part of the robot's
    * control step because we need access to information only available in the
@@ -379,24 +432,27 @@ void d2_loop_functions::robot_pre_step(chal::robot& robot) {
                              arena_map()->grid_resolution());
 
   /* Send robot its new LOS */
-  auto it = m_los_update_map->find(controller->type_index());
-  ER_ASSERT(m_los_update_map->end() != it,
-            "Controller '%s' type '%s' not in d2 LOS update map",
-            controller->GetId().c_str(),
-            controller->type_index().name());
-
-  auto applicator = ccops::applicator<controller::foraging_controller,
-                                      ccops::robot_los_update,
-                                      rds::grid2D_overlay<cds::cell2D>,
-                                      repr::forager_los>(controller);
-  boost::apply_visitor(applicator,
-                       m_los_update_map->at(controller->type_index()));
+  m_dispatch[controller].los_update(controller);
 } /* robot_pre_step() */
 
-void d2_loop_functions::robot_post_step(chal::robot& robot) {
-  auto* controller = dynamic_cast<controller::foraging_controller*>(
-      &robot.GetControllableEntity().GetController());
+void d2_loop_functions::robot_post_step(
+    controller::foraging_controller* controller) {
+  /*
+   * Robots which will interact with the environment decide how now, and are
+   * deferred so that all arena map modifications happen serially in a
+   * deterministic order; everything else can be finished now.
+   */
+  auto intent = m_dispatch[controller].intent(controller);
+  if (interaction_kind::ekNONE != intent.kind) {
+    m_interactions.defer(controller, intent);
+  } else {
+    robot_metrics_collect(controller);
+  }
+} /* robot_post_step() */
 
+void d2_loop_functions::robot_post_step_merge(
+    controller::foraging_controller* controller,
+    const interaction_intent& intent) {
   /*
    * Watch the robot interact with its environment after physics have been
    * updated and its controller has run.
@@ -404,60 +460,44 @@ void d2_loop_functions::robot_post_step(chal::robot& robot) {
    * If said interaction results in a block being dropped in a new cache, then
    * we need to re-run dynamic cache creation.
    */
-  auto it = m_interactor_map->find(controller->type_index());
-  ER_ASSERT(m_interactor_map->end() != it,
-            "Controller '%s' type '%s' not in d2 LOS update map",
-            controller->GetId().c_str(),
-            controller->type_index().name());
-
-  auto iapplicator = cinteractors::applicator<controller::foraging_controller,
-                                              robot_arena_interactor,
-                                              carena::caching_arena_map>(
-                                                  controller,
-                                                  timestep());
-  auto status = boost::apply_visitor(
-      iapplicator, m_interactor_map->at(controller->type_index()));
-  if (interactor_status::ekNO_EVENT != status) {
-    /*
-     * Signal that dynamic cache creation needs to be run AFTER all robots have
-     * finished their control steps.
-     */
-    if (interactor_status::ekNEW_CACHE_BLOCK_DROP & status) {
-      m_dynamic_cache_mtx.lock();
-      m_dynamic_cache_create = true;
-      m_dynamic_cache_mtx.unlock();
-    }
+  /* a robot with a lower ID may have taken what this robot targeted */
+  if (!interaction_valid(controller, intent)) {
+    robot_metrics_collect(controller);
+    return;
+  }
+  auto carried = carried_block(controller);
+  auto status = m_dispatch[controller].interact(controller, intent, timestep());
+  snapshot_pool_notify(carried, controller);
 
-    /*
-     * The oracle does not have up-to-date information about all caches in the
-     * arena now that one has been created, so we need to update the oracle in
-     * the middle of processing robots. This is not an issue in d1, because
-     * caches are always created AFTER processing all robots for a timestep.
-     *
-     * It also does not necessarily have up-to-date information about all blocks
-     * in the arena, as a robot could have dropped a block when it aborted its
-     * current task.
-     */
-    if (nullptr != oracle()) {
-      oracle()->update(arena_map());
-    }
+  /*
+   * Signal that dynamic cache creation needs to be run AFTER all robots have
+   * finished their control steps.
+   */
+  if (interactor_status::ekNEW_CACHE_BLOCK_DROP & status) {
+    m_cache_drop_locs.push_back(controller->rpos2D());
+  }
+  if (interactor_status::ekCACHE_DEPLETION & status) {
+    m_cache_manager->cache_prox_index()->invalidate();
   }
 
-  /* get stats from this robot before its state changes */
-  auto mapplicator = ccops::applicator<controller::foraging_controller,
-                                       ccops::metrics_extract,
-                                       d2_metrics_aggregator>(controller);
+  /*
+   * The oracle's knowledge of the caches in the arena is out of date if one
+   * has been depleted, and of the free blocks if the robot dropped a block when
+   * it aborted its current task, or picked one up/dropped one in the nest, so
+   * the change is applied to it now, rather than rebuilding it from the arena.
+   * New caches are only created after all robots have been processed, and
+   * cause it to be rebuilt before the next timestep. See FORDYCA#577.
+   */
+  oracle_notify(carried, controller, status);
 
-  auto it2 = m_metric_extractor_map->find(controller->type_index());
-  ER_ASSERT(m_metric_extractor_map->end() != it2,
-            "Controller '%s' type '%s' not in d2 LOS update map",
-            controller->GetId().c_str(),
-            controller->type_index().name());
+  robot_metrics_collect(controller);
+} /* robot_post_step_merge() */
 
-  boost::apply_visitor(mapplicator,
-                       m_metric_extractor_map->at(controller->type_index()));
+void d2_loop_functions::robot_metrics_collect(
+    controller::foraging_controller* controller) {
+  m_dispatch[controller].metrics_extract(controller);
   controller->block_manip_recorder()->reset();
-} /* robot_post_step() */
+} /* robot_metrics_collect() */
 
 bool d2_loop_functions::cache_creation_handle(bool on_drop) {
   const auto* cachep = config()->config_get<config::caches::caches_config>();
@@ -475,15 +515,31 @@ bool d2_loop_functions::cache_creation_handle(bool on_drop) {
     .t = timestep()
   };
 
-  if (auto created =
-          m_cache_manager->create(ccp, arena_map()->free_blocks(false))) {
+  boost::optional<cads::acache_vectoro> created;
+  if (on_drop && cachep->dynamic.local_radius.v() > 0.0 &&
+      !cache_creation_global_due()) {
+    created = m_cache_manager->create_local(ccp, m_cache_drop_locs);
+  } else {
+    created = m_cache_manager->create(ccp, arena_map()->free_blocks(false));
+  }
+
+  if (created) {
     arena_map()->caches_add(*created, this);
     floor()->SetChanged();
+
+    /* new caches absorb free blocks, so any block may have changed */
+    arena_changed();
     return true;
   }
   return false;
 } /* cache_creation_handle() */
 
+bool d2_loop_functions::cache_creation_global_due(void) const {
+  const auto* cachep = config()->config_get<config::caches::caches_config>();
+  return cachep->dynamic.global_interval > 0 &&
+         0 == timestep().v() % cachep->dynamic.global_interval;
+} /* cache_creation_global_due() */
+
 using namespace argos; // NOLINT
 
 RCPPSW_WARNING_DISABLE_PUSH()
@@ -74,8 +74,10 @@ d2_metrics_aggregator::d2_metrics_aggregator(
  * Member Functions
  ******************************************************************************/
 void d2_metrics_aggregator::task_start_cb(
-    RCPPSW_UNUSED const cta::polled_task* const task,
+    const cta::polled_task* const task,
     const cta::ds::bi_tab* const tab) {
+  census()->task_start(task);
+
   /* Not using stochastic nbhd policy */
   if (nullptr == tab) {
     return;
@@ -93,6 +95,7 @@ void d2_metrics_aggregator::task_start_cb(
 
 void d2_metrics_aggregator::task_finish_or_abort_cb(
     const cta::polled_task* const task) {
+  census()->task_finish_or_abort(task);
   collect("tasks::execution::" + task->name(),
           dynamic_cast<const ctametrics::execution_metrics&>(*task));
 } /* task_finish_or_abort_cb() */
@@ -23,6 +23,8 @@
  ******************************************************************************/
 #include "fordyca/support/d2/dynamic_cache_creator.hpp"
 
+#include <algorithm>
+
 #include "cosm/arena/caching_arena_map.hpp"
 #include "cosm/arena/operations/cache_extent_clear.hpp"
 #include "cosm/arena/repr/arena_cache.hpp"
@@ -30,6 +32,7 @@
 #include "cosm/spatial/conflict_checker.hpp"
 
 #include "fordyca/events/cell2D_empty.hpp"
+#include "fordyca/support/d2/cache_candidate_clusterer.hpp"
 #include "fordyca/support/d2/cache_center_calculator.hpp"
 #include "fordyca/support/cache_creation_verifier.hpp"
 
@@ -75,12 +78,34 @@ dynamic_cache_creator::create_all(const cache_create_ro_params& c_params,
                  std::back_inserter(all_blocks),
                  [&](const auto& pair) { return pair.second; });
 
-  for (auto anchor_it = usable_blocks.begin();
-       anchor_it != usable_blocks.end();) {
-    auto cache_i_initial = cache_i_blocks_alloc(usable_blocks, anchor_it);
-    std::advance(anchor_it, cache_i_initial.size());
-    ER_DEBUG("Removed %zu allocated blocks from usable vector",
-             cache_i_initial.size());
+  /*
+   * Caches are verified incrementally: each new cache is only checked against
+   * what has changed near it since the start of the creation pass.
+   */
+  auto verifier = cache_creation_verifier(m_map,
+                                          cache_dim(),
+                                          mc_strict_constraints);
+  verifier.reset(all_blocks);
+
+  /*
+   * Group usable blocks into candidate caches up front, so that we only try to
+   * create caches from groups which satisfy the distance and minimum # blocks
+   * constraints.
+   */
+  auto clusterer = cache_candidate_clusterer(mc_min_dist, mc_min_blocks);
+  for (auto& cache_i_initial : clusterer(usable_blocks)) {
+    /*
+     * Blocks in the group may have been absorbed into a cache created earlier
+     * this timestep, so they need to be removed before trying to create.
+     */
+    cache_i_initial.erase(
+        std::remove_if(cache_i_initial.begin(),
+                       cache_i_initial.end(),
+                       [&](const auto* b) {
+                         return absorbable_blocks.end() ==
+                                absorbable_blocks.find(b->id());
+                       }),
+        cache_i_initial.end());
     if (cache_i_initial.size() < mc_min_blocks) {
       continue;
     }
@@ -89,21 +114,9 @@ dynamic_cache_creator::create_all(const cache_create_ro_params& c_params,
         c_params, cache_i_initial, absorbable_blocks, &res.created);
 
     if (cache_i.status) {
-      cads::acache_vectorro sanity_caches;
-      std::transform(res.created.begin(),
-                     res.created.end(),
-                     std::back_inserter(sanity_caches),
-                     [&](const auto& c) { return c.get(); });
-      sanity_caches.push_back(cache_i.cache.get());
-
-      auto verifier = cache_creation_verifier(m_map,
-                                              cache_dim(),
-                                              mc_strict_constraints);
-      if (!verifier.verify_single(cache_i.cache.get(),
-                                  sanity_caches,
-                                  all_blocks,
-                                  c_params.clusters)) {
+      if (!verifier.verify_incremental(cache_i.cache.get(), c_params.clusters)) {
         cache_delete(cache_i);
+        verifier.blocks_moved(cache_i.used);
       } else {
         auto shared =
             std::shared_ptr<carepr::arena_cache>(std::move(cache_i.cache));
@@ -120,7 +133,7 @@ dynamic_cache_creator::create_all(const cache_create_ro_params& c_params,
     } else {
       ++res.n_discarded;
     }
-  } /* for(anchor_it..) */
+  } /* for(&cache_i_initial..) */
   return res;
 } /* create_all() */
 
@@ -168,57 +181,6 @@ dynamic_cache_creator::cache_i_result dynamic_cache_creator::cache_i_create(
   return { true, std::move(cache), cache_i_blocks };
 } /* cache_i_create() */
 
-cds::block3D_vectorno dynamic_cache_creator::cache_i_blocks_alloc(
-    const cds::block3D_vectorno& c_usable_blocks,
-    cds::block3D_vectorno::iterator anchor_it) const {
-  cds::block3D_vectorno cache_i_blocks;
-
-  /*
-   * No usable blocks left, or our anchor block has already been used.
-   */
-  if (c_usable_blocks.empty() || c_usable_blocks.end() == anchor_it) {
-    return {};
-  }
-
-  /*
-   * Add our anchor/target block to the list of blocks for the new cache. This
-   * is OK to do even if there are no other blocks close enough to create a new
-   * cache, because we have a minimum # blocks threshold that has to be met
-   * anyway.
-   */
-  ER_TRACE("Add anchor block%d@%s/%s to src list",
-           (*anchor_it)->id().v(),
-           rcppsw::to_string((*anchor_it)->ranchor2D()).c_str(),
-           rcppsw::to_string((*anchor_it)->danchor2D()).c_str());
-  cache_i_blocks.push_back(*anchor_it);
-
-  ++anchor_it;
-  while (anchor_it != c_usable_blocks.end()) {
-    auto* candidate = *anchor_it;
-    ++anchor_it;
-    /*
-     * If we find a block that is close enough to our anchor/target block, then
-     * add to the src list.
-     */
-    rtypes::spatial_dist to_block(
-        (candidate->rcenter2D() - candidate->rcenter2D()).length());
-    if (to_block <= mc_min_dist) {
-      ER_ASSERT(std::find(cache_i_blocks.begin(),
-                          cache_i_blocks.end(),
-                          candidate) == cache_i_blocks.end(),
-                "Block%d already on src list",
-                candidate->id().v());
-      ER_TRACE("Add block%d@%s/%s to src list",
-               candidate->id().v(),
-               rcppsw::to_string(candidate->ranchor2D()).c_str(),
-               rcppsw::to_string(candidate->danchor2D()).c_str());
-      cache_i_blocks.push_back(candidate);
-    }
-  } /* while() */
-  return cache_i_blocks;
-} /* cache_i_blocks_alloc() */
-
-
 cds::block3D_htno dynamic_cache_creator::cache_i_alloc_from_absorbable(
     const cds::block3D_htno& c_absorbable_blocks,
     const cds::block3D_vectorno& c_cache_i_blocks,
@@ -22,6 +22,8 @@
  ******************************************************************************/
 #include "fordyca/support/d2/dynamic_cache_manager.hpp"
 
+#include <unordered_set>
+
 #include "cosm/arena/caching_arena_map.hpp"
 #include "cosm/arena/repr/arena_cache.hpp"
 #include "cosm/ds/arena_grid.hpp"
@@ -47,7 +49,8 @@ dynamic_cache_manager::dynamic_cache_manager(
     : base_cache_manager(config, arena_map),
       ER_CLIENT_INIT("fordyca.support.d2.dynamic_cache_manager"),
       m_rng(rng),
-      m_map(arena_map) {}
+      m_map(arena_map),
+      m_prox_index(cache_proximity_dist()) {}
 
 /*******************************************************************************
  * Member Functions
@@ -91,6 +94,14 @@ dynamic_cache_manager::create(const cache_create_ro_params& c_params,
     caches_created(res.created.size());
     caches_discarded(res.n_discarded);
 
+    /*
+     * The new caches are not in the arena yet, so defer rebuilding the
+     * proximity index until it is next needed.
+     */
+    if (!res.created.empty()) {
+      m_prox_index.invalidate();
+    }
+
     /* Configure cache extents */
     creator.cache_extents_configure(res.created);
 
@@ -103,10 +114,93 @@ dynamic_cache_manager::create(const cache_create_ro_params& c_params,
   }
 } /* create() */
 
+boost::optional<cads::acache_vectoro> dynamic_cache_manager::create_local(
+    const cache_create_ro_params& c_params,
+    const std::vector<rmath::vector2d>& c_locs) {
+  /*
+   * A cache created from blocks near a location can extend up to a cache
+   * dimension beyond them, and must absorb any free blocks underneath it, so
+   * those blocks need to be considered too.
+   */
+  double block_radius = config()->dynamic.local_radius.v() +
+                        config()->dimension.v();
+
+  /*
+   * Caches created from blocks near a location can only conflict with existing
+   * caches which are within the proximity distance of said blocks.
+   */
+  double cache_radius = block_radius + cache_proximity_dist().v();
+  auto near = [&](const rmath::vector2d& pos, double radius) {
+    return std::any_of(c_locs.begin(), c_locs.end(), [&](const auto& loc) {
+      return (pos - loc).length() <= radius;
+    });
+  };
+
+  auto local_blocks = local_blocks_query(c_locs, block_radius);
+
+  cache_create_ro_params local_params = c_params;
+  local_params.current_caches.clear();
+  std::copy_if(c_params.current_caches.begin(),
+               c_params.current_caches.end(),
+               std::back_inserter(local_params.current_caches),
+               [&](const auto* c) { return near(c->rcenter2D(), cache_radius); });
+
+  ER_DEBUG("Local cache creation around %zu locations: blocks=%zu,caches=%zu/%zu",
+           c_locs.size(),
+           local_blocks.size(),
+           local_params.current_caches.size(),
+           c_params.current_caches.size());
+  return create(local_params, local_blocks);
+} /* create_local() */
+
+cds::block3D_vectorno dynamic_cache_manager::local_blocks_query(
+    const std::vector<rmath::vector2d>& c_locs,
+    double radius) const {
+  double res = m_map->grid_resolution().v();
+  auto dmax = rmath::dvec2zvec(rmath::vector2d(m_map->xrsize(), m_map->yrsize()),
+                               res);
+
+  /*
+   * Only the cells in the bounding square of each location need to be
+   * visited. The square is padded by a couple of cells, because blocks are
+   * found via the cell containing their anchor, which can be up to a block
+   * length away from their center.
+   */
+  double pad = radius + 2 * res;
+  std::unordered_set<const crepr::base_block3D*> seen;
+  cds::block3D_vectorno blocks;
+  for (const auto& loc : c_locs) {
+    auto ll = rmath::dvec2zvec(rmath::vector2d(std::max(0.0, loc.x() - pad),
+                                               std::max(0.0, loc.y() - pad)),
+                               res);
+    auto ur = rmath::dvec2zvec(loc + rmath::vector2d(pad, pad), res);
+    for (size_t i = ll.x(); i <= std::min(ur.x(), dmax.x() - 1); ++i) {
+      for (size_t j = ll.y(); j <= std::min(ur.y(), dmax.y() - 1); ++j) {
+        const auto& cell =
+            m_map->access<cds::arena_grid::kCell>(rmath::vector2z(i, j));
+        if (!cell.state_has_block()) {
+          continue;
+        }
+        auto* block = cell.block3D();
+        if ((block->rcenter2D() - loc).length() <= radius &&
+            seen.insert(block).second) {
+          blocks.push_back(block);
+        }
+      } /* for(j..) */
+    } /* for(i..) */
+  } /* for(&loc..) */
+
+  /* same order as the arena's free block set, for reproducibility */
+  std::sort(blocks.begin(), blocks.end(), [](const auto* b1, const auto* b2) {
+    return b1->id().v() < b2->id().v();
+  });
+  return blocks;
+} /* local_blocks_query() */
+
 bool dynamic_cache_manager::block_alloc_usable_filter(
     const crepr::base_block3D* block,
-    const cads::acache_vectorno& existing_caches,
-    const cfds::block3D_cluster_vectorro& clusters) {
+    const cads::acache_vectorno&,
+    const cfds::block3D_cluster_vectorro&) {
   /*
    * Initial allocation.
    *
@@ -118,35 +212,20 @@ bool dynamic_cache_manager::block_alloc_usable_filter(
       !block->is_carried_by_robot() &&
 
       /* blocks cannot be in existing caches */
-      std::all_of(existing_caches.begin(),
-                     existing_caches.end(),
-                     [&](const auto& c) { return !c->contains_block(block); }) &&
+      !block_membership().in_cache(block) &&
 
       /* blocks cannot be in clusters */
-      std::all_of(clusters.begin(),
-                  clusters.end(),
-                  [&](const auto& clust) {
-                    /* constructed, so must assign before search */
-                    auto cblocks = clust->blocks();
-                    ER_DEBUG("Cluster%d blocks: [%s]",
-                             clust->id().v(),
-                             rcppsw::to_string(cblocks).c_str());
-                    return cblocks.end() == std::find(cblocks.begin(),
-                                                      cblocks.end(),
-                                                      block);
-                  });
+      !block_membership().in_cluster(block);
 } /* block_alloc_usable_filter() */
 
 bool dynamic_cache_manager::block_alloc_absorbable_filter(
     const crepr::base_block3D* block,
-    const cads::acache_vectorno& existing_caches,
+    const cads::acache_vectorno&,
     const cfds::block3D_cluster_vectorro&) {
   /* blocks cannot be carried by a robot */
   return !block->is_carried_by_robot() &&
       /* Blocks cannot be in existing caches */
-       std::all_of(existing_caches.begin(),
-                   existing_caches.end(),
-                   [&](const auto& c) { return !c->contains_block(block); });
+      !block_membership().in_cache(block);
 } /* block_alloc_absorbable_filter() */
 
 NS_END(d2, support, fordyca);
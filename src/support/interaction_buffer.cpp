@@ -0,0 +1,94 @@
+/**
+ * \file interaction_buffer.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/support/interaction_buffer.hpp"
+
+#include <algorithm>
+
+#include "fordyca/controller/foraging_controller.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, support);
+
+/*******************************************************************************
+ * Class Constants
+ ******************************************************************************/
+std::atomic_uint interaction_buffer::ms_instances{0};
+
+/*******************************************************************************
+ * Constructors/Destructor
+ ******************************************************************************/
+interaction_buffer::interaction_buffer(void)
+    : ER_CLIENT_INIT("fordyca.support.interaction_buffer"),
+      mc_instance(++ms_instances) {}
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void interaction_buffer::reset(size_t n_robots) {
+  ER_ASSERT(m_merged.empty(),
+            "%zu robots from previous timestep not merged",
+            m_merged.size());
+  /* only reallocate if the swarm has grown */
+  m_merged.reserve(n_robots);
+} /* reset() */
+
+void interaction_buffer::defer(controller::foraging_controller* c,
+                               const interaction_intent& intent) {
+  local()->push_back({ c->entity_id(), c, intent });
+} /* defer() */
+
+interaction_buffer::thread_buffer* interaction_buffer::local(void) {
+  /*
+   * Each thread caches the buffer it was given by the last interaction buffer
+   * it deferred a robot into. There is only ever one interaction buffer in use
+   * at a time, so after the first timestep this never misses.
+   */
+  struct cached {
+    uint           instance{0};
+    thread_buffer* buffer{nullptr};
+  };
+  static thread_local cached tl_cached{};
+
+  if (tl_cached.instance != mc_instance) {
+    std::scoped_lock lock(m_mtx);
+    tl_cached = { mc_instance, &m_buffers.emplace_back() };
+  }
+  return tl_cached.buffer;
+} /* local() */
+
+void interaction_buffer::gather(void) {
+  for (auto& buffer : m_buffers) {
+    m_merged.insert(m_merged.end(), buffer.begin(), buffer.end());
+    buffer.clear();
+  } /* for(&buffer..) */
+  std::sort(m_merged.begin(),
+            m_merged.end(),
+            [](const entry& e1, const entry& e2) {
+              return e1.id.v() < e2.id.v();
+            });
+} /* gather() */
+
+NS_END(support, fordyca);
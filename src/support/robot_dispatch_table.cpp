@@ -0,0 +1,61 @@
+/**
+ * \file robot_dispatch_table.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/support/robot_dispatch_table.hpp"
+
+#include <utility>
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, support);
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void robot_dispatch_table::type_register(const std::type_index& type,
+                                         robot_dispatch_slot slot) {
+  m_types[type] = std::move(slot);
+} /* type_register() */
+
+void robot_dispatch_table::robot_resolve(
+    const controller::foraging_controller* c) {
+  auto id = static_cast<size_t>(c->entity_id().v());
+  if (m_robots.size() <= id) {
+    m_robots.resize(id + 1, nullptr);
+  }
+  m_robots[id] = &type_slot(c);
+  ++m_n_resolved;
+} /* robot_resolve() */
+
+const robot_dispatch_slot& robot_dispatch_table::type_slot(
+    const controller::foraging_controller* c) const {
+  auto it = m_types.find(c->type_index());
+  ER_ASSERT(m_types.end() != it,
+            "Controller '%s' type '%s' not in dispatch table",
+            c->GetId().c_str(),
+            c->type_index().name());
+  return it->second;
+} /* type_slot() */
+
+NS_END(support, fordyca);
@@ -0,0 +1,128 @@
+/**
+ * \file task_census.cpp
+ *
+ * \copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "fordyca/support/task_census.hpp"
+
+#include <algorithm>
+
+#include "fordyca/tasks/base_foraging_task.hpp"
+#include "fordyca/tasks/d0/foraging_task.hpp"
+#include "fordyca/tasks/d1/foraging_task.hpp"
+#include "fordyca/tasks/d2/foraging_task.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+NS_START(fordyca, support);
+
+/*******************************************************************************
+ * Class Constants
+ ******************************************************************************/
+const std::array<std::string, task_census::kTaskCount> task_census::kTaskNames = {
+  tasks::d0::foraging_task::kGeneralistName,
+  tasks::d1::foraging_task::kHarvesterName,
+  tasks::d1::foraging_task::kCollectorName,
+  tasks::d2::foraging_task::kCacheStarterName,
+  tasks::d2::foraging_task::kCacheFinisherName,
+  tasks::d2::foraging_task::kCacheTransfererName,
+  tasks::d2::foraging_task::kCacheCollectorName
+};
+
+/*******************************************************************************
+ * Member Functions
+ ******************************************************************************/
+void task_census::bind(cta::ds::bi_tdgraph* const graph) {
+  for (size_t i = 0; i < kTaskCount; ++i) {
+    auto* vertex = graph->find_vertex(kTaskNames[i]);
+    auto* task = dynamic_cast<tasks::base_foraging_task*>(vertex);
+    if (nullptr != task) {
+      task->census_index(static_cast<int>(i));
+    }
+  } /* for(i..) */
+} /* bind() */
+
+void task_census::task_start(const cta::polled_task* const task) {
+  int index = bound_index(task);
+  ER_ASSERT(-1 != index, "Task '%s' not bound", task->name().c_str());
+  ++m_counts[index];
+} /* task_start() */
+
+void task_census::task_finish_or_abort(const cta::polled_task* const task) {
+  int index = bound_index(task);
+  ER_ASSERT(-1 != index, "Task '%s' not bound", task->name().c_str());
+  --m_counts[index];
+} /* task_finish_or_abort() */
+
+size_t task_census::count(const std::string& name) const {
+  return count(task_index(name));
+} /* count() */
+
+size_t task_census::n_harvesters(void) const {
+  return count(tasks::d1::foraging_task::kHarvesterName);
+} /* n_harvesters() */
+
+size_t task_census::n_collectors(void) const {
+  return count(tasks::d1::foraging_task::kCollectorName);
+} /* n_collectors() */
+
+std::vector<int> task_census::distribution(size_t n_robots) const {
+  std::vector<int> v;
+  v.reserve(n_robots);
+  for (size_t i = 0; i < kTaskCount; ++i) {
+    v.insert(v.end(), count(static_cast<int>(i)), static_cast<int>(i));
+  } /* for(i..) */
+
+  /* all remaining robots are not executing a task */
+  if (v.size() < n_robots) {
+    v.insert(v.end(), n_robots - v.size(), -1);
+  }
+  return v;
+} /* distribution() */
+
+int task_census::task_index(const std::string& name) {
+  auto it = std::find(kTaskNames.begin(), kTaskNames.end(), name);
+  return (kTaskNames.end() == it)
+             ? -1
+             : static_cast<int>(std::distance(kTaskNames.begin(), it));
+} /* task_index() */
+
+int task_census::bound_index(const cta::polled_task* const task) {
+  const auto* foraging = dynamic_cast<const tasks::base_foraging_task*>(task);
+  return (nullptr != foraging) ? foraging->census_index() : -1;
+} /* bound_index() */
+
+void task_census::reset(void) {
+  for (auto& c : m_counts) {
+    c = 0;
+  } /* for(&c..) */
+} /* reset() */
+
+size_t task_census::count(int index) const {
+  if (-1 == index) {
+    return 0;
+  }
+  /* never report a negative count, even if callbacks were unpaired */
+  return static_cast<size_t>(std::max(0, m_counts[index].load()));
+} /* count() */
+
+NS_END(support, fordyca);
@@ -28,6 +28,7 @@
 #include "cosm/repr/base_block3D.hpp"
 
 #include "fordyca//controller/foraging_controller.hpp"
+#include "fordyca/ds/arena_snapshot_pool.hpp"
 
 /*******************************************************************************
  * Namespaces/Decls
@@ -42,6 +43,7 @@ fordyca_pd_adaptor::fordyca_pd_adaptor(
     cpal::argos_sm_adaptor* sm,
     env_dynamics_type* envd,
     carena::caching_arena_map* map,
+    ds::arena_snapshot_pool* snapshots,
     rmath::rng* rng)
     : ER_CLIENT_INIT("fordyca.support.tv.fordyca_pd_adaptor"),
       argos_pd_adaptor<cpal::argos_controller2D_adaptor>(
@@ -50,7 +52,8 @@ fordyca_pd_adaptor::fordyca_pd_adaptor(
           envd,
           rmath::vector2d(map->xrsize(), map->yrsize()),
           rng),
-      m_map(map) {}
+      m_map(map),
+      m_snapshots(snapshots) {}
 
 /*******************************************************************************
  * Member Functions
@@ -58,6 +61,8 @@ fordyca_pd_adaptor::fordyca_pd_adaptor(
 void fordyca_pd_adaptor::pre_kill_cleanup(
     cpal::argos_controller2D_adaptor* controller) {
   auto* foraging = static_cast<controller::foraging_controller*>(controller);
+  ++m_n_killed;
+
   /*
    * If the robot is carrying a block, drop/distribute it in the arena to avoid
    * it getting permanently lost when the it is removed.
@@ -82,6 +87,7 @@ void fordyca_pd_adaptor::pre_kill_cleanup(
         carena::locking::ekALL_HELD);
 
     adrop_op.visit(*m_map);
+    m_snapshots->block_changed((*it)->id());
   }
 } /* pre_kill_cleanup() */
 
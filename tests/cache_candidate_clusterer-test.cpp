@@ -0,0 +1,119 @@
+/**
+ * @file cache_candidate_clusterer-test.cpp
+ *
+ * @copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_PREFIX_ALL
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include <algorithm>
+#include <vector>
+
+#include "fordyca/support/d2/cache_candidate_clusterer.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+using namespace fordyca::support::d2;
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+static std::vector<size_t> sorted(std::vector<size_t> group) {
+  std::sort(group.begin(), group.end());
+  return group;
+}
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+CATCH_TEST_CASE("empty-test", "[cache_candidate_clusterer]") {
+  cache_candidate_clusterer clusterer(rtypes::spatial_dist(1.0), 3);
+  CATCH_REQUIRE(clusterer.groups_calc({}).empty());
+}
+
+CATCH_TEST_CASE("noise-test", "[cache_candidate_clusterer]") {
+  cache_candidate_clusterer clusterer(rtypes::spatial_dist(1.0), 3);
+
+  /* two blocks close together are not enough for a group */
+  std::vector<rmath::vector2d> centers = { rmath::vector2d(1.0, 1.0),
+                                           rmath::vector2d(1.5, 1.0),
+                                           rmath::vector2d(8.0, 8.0) };
+  CATCH_REQUIRE(clusterer.groups_calc(centers).empty());
+}
+
+CATCH_TEST_CASE("groups-test", "[cache_candidate_clusterer]") {
+  cache_candidate_clusterer clusterer(rtypes::spatial_dist(1.0), 3);
+  std::vector<rmath::vector2d> centers = {
+    rmath::vector2d(10.0, 10.0), /* group 0 */
+    rmath::vector2d(1.0, 1.0),   /* group 1 */
+    rmath::vector2d(1.5, 1.0),   /* group 1 */
+    rmath::vector2d(20.0, 2.0),  /* noise */
+    rmath::vector2d(10.5, 10.0), /* group 0 */
+    rmath::vector2d(1.0, 1.5),   /* group 1 */
+    rmath::vector2d(10.0, 10.5), /* group 0 */
+    rmath::vector2d(10.5, 10.5), /* group 0 */
+  };
+  auto groups = clusterer.groups_calc(centers);
+
+  /* groups are ordered by the first block in them */
+  CATCH_REQUIRE(2 == groups.size());
+  CATCH_REQUIRE((std::vector<size_t>{ 0, 4, 6, 7 }) == sorted(groups[0]));
+  CATCH_REQUIRE((std::vector<size_t>{ 1, 2, 5 }) == sorted(groups[1]));
+  CATCH_REQUIRE(0 == groups[0].front());
+  CATCH_REQUIRE(1 == groups[1].front());
+}
+
+CATCH_TEST_CASE("border-test", "[cache_candidate_clusterer]") {
+  cache_candidate_clusterer clusterer(rtypes::spatial_dist(1.0), 3);
+
+  /*
+   * Block 0 has only 2 neighbors (itself and block 3), so it is not a core
+   * block, and is marked as noise when first visited. It is reachable from
+   * core block 3 though, so it ends up as part of the group. Block 4 is too
+   * far from all other blocks, so it stays noise.
+   */
+  std::vector<rmath::vector2d> centers = { rmath::vector2d(1.9, 0.0),
+                                           rmath::vector2d(0.0, 0.0),
+                                           rmath::vector2d(0.5, 0.0),
+                                           rmath::vector2d(1.0, 0.0),
+                                           rmath::vector2d(3.0, 0.0) };
+  auto groups = clusterer.groups_calc(centers);
+  CATCH_REQUIRE(1 == groups.size());
+  CATCH_REQUIRE((std::vector<size_t>{ 0, 1, 2, 3 }) == sorted(groups[0]));
+}
+
+CATCH_TEST_CASE("chain-test", "[cache_candidate_clusterer]") {
+  cache_candidate_clusterer clusterer(rtypes::spatial_dist(1.0), 3);
+
+  /*
+   * Every interior block has 3 neighbors, so the whole line is one group,
+   * even though its ends are much further than epsilon apart, and it crosses
+   * cell boundaries (including the one at 0).
+   */
+  std::vector<rmath::vector2d> centers;
+  for (int i = -5; i < 5; ++i) {
+    centers.emplace_back(0.9 * i, -0.1);
+  } /* for(i..) */
+  auto groups = clusterer.groups_calc(centers);
+  CATCH_REQUIRE(1 == groups.size());
+  CATCH_REQUIRE(centers.size() == groups[0].size());
+}
@@ -0,0 +1,319 @@
+/**
+ * @file dpo_map-test.cpp
+ *
+ * @copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_PREFIX_ALL
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+#include <memory>
+
+#include "fordyca/ds/dpo_map.hpp"
+#include "fordyca/ds/flat_index.hpp"
+
+/*******************************************************************************
+ * Test Object
+ ******************************************************************************/
+struct test_obj {
+  int id;
+  rmath::vector2z loc;
+
+  bool idcmp(const test_obj& other) const { return id == other.id; }
+};
+
+NS_START(fordyca, ds);
+
+template <>
+struct dpo_map_traits<test_obj> {
+  static rtypes::type_uuid id(const test_obj& obj) {
+    return rtypes::type_uuid(obj.id);
+  }
+  static rmath::vector2z loc(const test_obj& obj) { return obj.loc; }
+  static rmath::vector2d rloc(const test_obj& obj) {
+    return rmath::vector2d(obj.loc.x(), obj.loc.y());
+  }
+};
+
+NS_END(ds, fordyca);
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+using namespace fordyca::ds;
+
+using id_map = dpo_map<rtypes::type_uuid, test_obj>;
+using loc_map = dpo_map<rmath::vector2z, test_obj>;
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+static const double kRHO = 0.1;
+
+static id_map::value_type obj_make(int id, size_t x, size_t y, double density) {
+  crepr::pheromone_density d(kRHO);
+  d.pheromone_set(density);
+  return { std::make_shared<test_obj>(test_obj{ id, rmath::vector2z(x, y) }),
+           d };
+}
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+CATCH_TEST_CASE("flat-index-test", "[dpo_map]") {
+  flat_index<int> index;
+  CATCH_REQUIRE(index.empty());
+  CATCH_REQUIRE(flat_index<int>::kNONE == index.find(7));
+  CATCH_REQUIRE(!index.erase(7));
+
+  /* enough keys to force several rehashes */
+  for (int i = 0; i < 1000; ++i) {
+    index.insert(i * 3, static_cast<size_t>(i));
+  } /* for(i..) */
+  CATCH_REQUIRE(1000 == index.size());
+  for (int i = 0; i < 1000; ++i) {
+    CATCH_REQUIRE(static_cast<size_t>(i) == index.find(i * 3));
+    CATCH_REQUIRE(flat_index<int>::kNONE == index.find(i * 3 + 1));
+  } /* for(i..) */
+
+  /* overwriting a key does not change the size */
+  index.insert(3, 42);
+  CATCH_REQUIRE(42 == index.find(3));
+  CATCH_REQUIRE(1000 == index.size());
+
+  /* erasing keys must not break probing for the keys after them */
+  for (int i = 0; i < 1000; i += 2) {
+    CATCH_REQUIRE(index.erase(i * 3));
+  } /* for(i..) */
+  CATCH_REQUIRE(500 == index.size());
+  for (int i = 0; i < 1000; ++i) {
+    size_t expected = (0 == i % 2) ? flat_index<int>::kNONE
+                                   : (1 == i) ? 42 : static_cast<size_t>(i);
+    CATCH_REQUIRE(expected == index.find(i * 3));
+  } /* for(i..) */
+
+  index.clear();
+  CATCH_REQUIRE(index.empty());
+  CATCH_REQUIRE(flat_index<int>::kNONE == index.find(3));
+}
+
+CATCH_TEST_CASE("index-test", "[dpo_map]") {
+  id_map map;
+  map.obj_add(obj_make(1, 1, 1, 1.0));
+  map.obj_add(obj_make(2, 2, 2, 1.0));
+  map.obj_add(obj_make(3, 3, 3, 1.0));
+  CATCH_REQUIRE(3 == map.size());
+
+  /* objects are found by either key */
+  for (int i = 1; i <= 3; ++i) {
+    const auto* by_id = map.find(rtypes::type_uuid(i));
+    const auto* by_loc = map.find(rmath::vector2z(i, i));
+    CATCH_REQUIRE(nullptr != by_id);
+    CATCH_REQUIRE(by_id == by_loc);
+    CATCH_REQUIRE(i == by_id->ent()->id);
+  } /* for(i..) */
+  CATCH_REQUIRE(!map.contains(rtypes::type_uuid(4)));
+  CATCH_REQUIRE(nullptr == map.find(rmath::vector2z(4, 4)));
+
+  /* same ID at a new location replaces the old object */
+  map.obj_add(obj_make(2, 5, 5, 1.0));
+  CATCH_REQUIRE(3 == map.size());
+  CATCH_REQUIRE(nullptr == map.find(rmath::vector2z(2, 2)));
+  CATCH_REQUIRE(2 == map.find(rmath::vector2z(5, 5))->ent()->id);
+
+  /* a new ID at an existing location replaces the old object */
+  map.obj_add(obj_make(4, 5, 5, 1.0));
+  CATCH_REQUIRE(3 == map.size());
+  CATCH_REQUIRE(!map.contains(rtypes::type_uuid(2)));
+  CATCH_REQUIRE(4 == map.find(rmath::vector2z(5, 5))->ent()->id);
+
+  /* removal swaps the last object into the vacated slot */
+  map.obj_remove(rtypes::type_uuid(1));
+  CATCH_REQUIRE(2 == map.size());
+  CATCH_REQUIRE(!map.contains(rtypes::type_uuid(1)));
+  CATCH_REQUIRE(nullptr == map.find(rmath::vector2z(1, 1)));
+  CATCH_REQUIRE(3 == map.find(rtypes::type_uuid(3))->ent()->id);
+  CATCH_REQUIRE(3 == map.find(rmath::vector2z(3, 3))->ent()->id);
+  CATCH_REQUIRE(4 == map.find(rtypes::type_uuid(4))->ent()->id);
+  CATCH_REQUIRE(4 == map.find(rmath::vector2z(5, 5))->ent()->id);
+
+  /* removing an unknown object is a no-op */
+  map.obj_remove(rtypes::type_uuid(17));
+  CATCH_REQUIRE(2 == map.size());
+
+  map.clear();
+  CATCH_REQUIRE(map.empty());
+  CATCH_REQUIRE(!map.contains(rtypes::type_uuid(3)));
+}
+
+CATCH_TEST_CASE("loc-index-test", "[dpo_map]") {
+  loc_map map;
+  map.obj_add(obj_make(1, 1, 1, 1.0));
+  map.obj_add(obj_make(2, 2, 2, 1.0));
+  CATCH_REQUIRE(map.contains(rmath::vector2z(1, 1)));
+
+  map.obj_remove(rmath::vector2z(1, 1));
+  CATCH_REQUIRE(1 == map.size());
+  CATCH_REQUIRE(!map.contains(rmath::vector2z(1, 1)));
+  CATCH_REQUIRE(nullptr == map.find(rtypes::type_uuid(1)));
+  CATCH_REQUIRE(2 == map.find(rtypes::type_uuid(2))->ent()->id);
+}
+
+CATCH_TEST_CASE("epoch-test", "[dpo_map]") {
+  id_map map;
+  size_t epoch = map.change_epoch();
+
+  map.obj_add(obj_make(1, 1, 1, 2.0));
+  CATCH_REQUIRE(epoch != map.change_epoch());
+  epoch = map.change_epoch();
+
+  /* decay is lazy, and is not a structural change */
+  uint decay = map.decay_epoch();
+  map.decay_all();
+  map.decay_all();
+  CATCH_REQUIRE(epoch == map.change_epoch());
+  CATCH_REQUIRE(decay + 2 == map.decay_epoch());
+  CATCH_REQUIRE(map.find(rtypes::type_uuid(1))->density().v() ==
+                Approx(2.0 * (1.0 - kRHO) * (1.0 - kRHO)));
+  CATCH_REQUIRE(map.density_avg() == Approx(2.0 * (1.0 - kRHO) * (1.0 - kRHO)));
+
+  crepr::pheromone_density d(kRHO);
+  d.pheromone_set(3.0);
+  map.density_update(*map.find(rtypes::type_uuid(1)), d);
+  CATCH_REQUIRE(epoch != map.change_epoch());
+  epoch = map.change_epoch();
+
+  /*
+   * Deposits only land at the next decay step, and are a structural change
+   * then, as not all densities just decay uniformly.
+   */
+  crepr::pheromone_density deposit = map.find(rtypes::type_uuid(1))->density();
+  deposit.pheromone_add(1.0);
+  map.density_update(*map.find(rtypes::type_uuid(1)), deposit);
+  epoch = map.change_epoch();
+  map.decay_all();
+  CATCH_REQUIRE(epoch != map.change_epoch());
+  CATCH_REQUIRE(map.find(rtypes::type_uuid(1))->density().v() >
+                3.0 * (1.0 - kRHO));
+  epoch = map.change_epoch();
+  map.decay_all();
+  CATCH_REQUIRE(epoch == map.change_epoch());
+
+  map.obj_modified();
+  CATCH_REQUIRE(epoch != map.change_epoch());
+  epoch = map.change_epoch();
+
+  map.obj_remove(rtypes::type_uuid(1));
+  CATCH_REQUIRE(epoch != map.change_epoch());
+}
+
+CATCH_TEST_CASE("decay-enable-test", "[dpo_map]") {
+  id_map map;
+  map.obj_add(obj_make(1, 1, 1, 2.0));
+  map.decay_enable(false);
+
+  /* densities are held while decay is disabled, but the epoch advances */
+  uint decay = map.decay_epoch();
+  map.decay_all();
+  map.decay_all();
+  CATCH_REQUIRE(decay + 2 == map.decay_epoch());
+  CATCH_REQUIRE(map.find(rtypes::type_uuid(1))->density().v() == Approx(2.0));
+  CATCH_REQUIRE(map.density_avg() == Approx(2.0));
+
+  /* objects added while decay is disabled are held too */
+  map.obj_add(obj_make(2, 2, 2, 4.0));
+  map.decay_all();
+  CATCH_REQUIRE(map.find(rtypes::type_uuid(2))->density().v() == Approx(4.0));
+
+  /* ...and decay from where they were held once it is enabled again */
+  map.decay_enable(true);
+  map.decay_all();
+  CATCH_REQUIRE(map.find(rtypes::type_uuid(1))->density().v() ==
+                Approx(2.0 * (1.0 - kRHO)));
+  CATCH_REQUIRE(map.find(rtypes::type_uuid(2))->density().v() ==
+                Approx(4.0 * (1.0 - kRHO)));
+  CATCH_REQUIRE(map.density_avg() == Approx(3.0 * (1.0 - kRHO)));
+}
+
+CATCH_TEST_CASE("eviction-test", "[dpo_map]") {
+  id_map map;
+  map.capacity(2);
+
+  /* the lowest density object is evicted to make room */
+  CATCH_REQUIRE(map.obj_add(obj_make(1, 1, 1, 1.0)));
+  CATCH_REQUIRE(map.obj_add(obj_make(2, 2, 2, 3.0)));
+  CATCH_REQUIRE(map.obj_add(obj_make(3, 3, 3, 2.0)));
+  CATCH_REQUIRE(2 == map.size());
+  CATCH_REQUIRE(1 == map.n_evicted());
+  CATCH_REQUIRE(!map.contains(rtypes::type_uuid(1)));
+
+  /*
+   * After decay, the objects already in the map are ranked by their decayed
+   * densities, so one added later with a density between theirs is retained.
+   */
+  for (size_t i = 0; i < 5; ++i) {
+    map.decay_all();
+  } /* for(i..) */
+  CATCH_REQUIRE(map.obj_add(obj_make(4, 4, 4, 1.5)));
+  CATCH_REQUIRE(2 == map.n_evicted());
+  CATCH_REQUIRE(!map.contains(rtypes::type_uuid(3)));
+  CATCH_REQUIRE(map.contains(rtypes::type_uuid(2)));
+  CATCH_REQUIRE(map.contains(rtypes::type_uuid(4)));
+
+  /* density updates change the ranking */
+  crepr::pheromone_density d(kRHO);
+  d.pheromone_set(10.0);
+  map.density_update(*map.find(rtypes::type_uuid(4)), d);
+  CATCH_REQUIRE(map.obj_add(obj_make(5, 5, 5, 5.0)));
+  CATCH_REQUIRE(3 == map.n_evicted());
+  CATCH_REQUIRE(!map.contains(rtypes::type_uuid(2)));
+  CATCH_REQUIRE(map.contains(rtypes::type_uuid(4)));
+  CATCH_REQUIRE(map.contains(rtypes::type_uuid(5)));
+
+  /*
+   * An incoming object with a lower density than any in the map is rejected,
+   * rather than evicting one which ranks higher.
+   */
+  size_t epoch = map.change_epoch();
+  CATCH_REQUIRE(!map.obj_add(obj_make(6, 6, 6, 1.0)));
+  CATCH_REQUIRE(4 == map.n_evicted());
+  CATCH_REQUIRE(2 == map.size());
+  CATCH_REQUIRE(!map.contains(rtypes::type_uuid(6)));
+  CATCH_REQUIRE(nullptr == map.find(rmath::vector2z(6, 6)));
+  CATCH_REQUIRE(map.contains(rtypes::type_uuid(4)));
+  CATCH_REQUIRE(map.contains(rtypes::type_uuid(5)));
+  CATCH_REQUIRE(epoch == map.change_epoch());
+
+  /* shrinking the capacity evicts the lowest density objects */
+  map.capacity(1);
+  CATCH_REQUIRE(1 == map.size());
+  CATCH_REQUIRE(map.contains(rtypes::type_uuid(4)));
+
+  map.evictions_reset();
+  CATCH_REQUIRE(0 == map.n_evicted());
+
+  /* unbounded maps never evict */
+  map.capacity(0);
+  for (int i = 10; i < 20; ++i) {
+    CATCH_REQUIRE(map.obj_add(obj_make(i, i, i, 1.0)));
+  } /* for(i..) */
+  CATCH_REQUIRE(11 == map.size());
+  CATCH_REQUIRE(0 == map.n_evicted());
+}
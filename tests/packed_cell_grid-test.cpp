@@ -0,0 +1,132 @@
+/**
+ * @file packed_cell_grid-test.cpp
+ *
+ * @copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_PREFIX_ALL
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+
+#include "fordyca/ds/packed_cell_grid.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+using namespace fordyca::ds;
+using state = packed_cell_grid::state;
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+CATCH_TEST_CASE("init-test", "[packed_cell_grid]") {
+  /* dimensions which are not a multiple of the tile size */
+  packed_cell_grid grid(50, 70);
+  CATCH_REQUIRE(0 == grid.tile_count());
+  for (size_t i = 0; i < 50; ++i) {
+    for (size_t j = 0; j < 70; ++j) {
+      CATCH_REQUIRE(state::ekUNKNOWN == grid.cell_state(i, j));
+      CATCH_REQUIRE(rtypes::constants::kNoUUID == grid.cell_entity(i, j));
+    } /* for(j..) */
+  } /* for(i..) */
+}
+
+CATCH_TEST_CASE("update-test", "[packed_cell_grid]") {
+  packed_cell_grid grid(50, 70);
+
+  /* marking a cell in an unallocated tile UNKNOWN does not allocate it */
+  grid.cell_update(3, 3, state::ekUNKNOWN, rtypes::constants::kNoUUID);
+  CATCH_REQUIRE(0 == grid.tile_count());
+
+  grid.cell_update(3, 3, state::ekHAS_BLOCK, rtypes::type_uuid(7));
+  CATCH_REQUIRE(1 == grid.tile_count());
+  CATCH_REQUIRE(state::ekHAS_BLOCK == grid.cell_state(3, 3));
+  CATCH_REQUIRE(rtypes::type_uuid(7) == grid.cell_entity(3, 3));
+
+  /* other cells in the same tile are still UNKNOWN */
+  CATCH_REQUIRE(state::ekUNKNOWN == grid.cell_state(3, 4));
+  CATCH_REQUIRE(rtypes::constants::kNoUUID == grid.cell_entity(3, 4));
+
+  /* cells in another tile allocate it */
+  grid.cell_update(49, 69, state::ekHAS_CACHE, rtypes::type_uuid(9));
+  CATCH_REQUIRE(2 == grid.tile_count());
+  CATCH_REQUIRE(state::ekHAS_CACHE == grid.cell_state(49, 69));
+  CATCH_REQUIRE(rtypes::type_uuid(9) == grid.cell_entity(49, 69));
+
+  /* cells can be updated in place */
+  grid.cell_update(3, 3, state::ekEMPTY, rtypes::constants::kNoUUID);
+  CATCH_REQUIRE(2 == grid.tile_count());
+  CATCH_REQUIRE(state::ekEMPTY == grid.cell_state(3, 3));
+  CATCH_REQUIRE(rtypes::constants::kNoUUID == grid.cell_entity(3, 3));
+}
+
+CATCH_TEST_CASE("packing-test", "[packed_cell_grid]") {
+  packed_cell_grid grid(packed_cell_grid::kTileDim, packed_cell_grid::kTileDim);
+  const state kStates[] = {
+    state::ekEMPTY, state::ekHAS_BLOCK, state::ekHAS_CACHE, state::ekUNKNOWN
+  };
+
+  /* neighboring cells share a byte, and must not clobber each other */
+  for (size_t j = 0; j < packed_cell_grid::kTileDim; ++j) {
+    state s = kStates[j % 4];
+    bool has_entity = (state::ekHAS_BLOCK == s || state::ekHAS_CACHE == s);
+    grid.cell_update(5,
+                     j,
+                     s,
+                     has_entity ? rtypes::type_uuid(static_cast<int>(j))
+                                : rtypes::constants::kNoUUID);
+  } /* for(j..) */
+
+  for (size_t j = 0; j < packed_cell_grid::kTileDim; ++j) {
+    state s = kStates[j % 4];
+    bool has_entity = (state::ekHAS_BLOCK == s || state::ekHAS_CACHE == s);
+    CATCH_REQUIRE(s == grid.cell_state(5, j));
+    CATCH_REQUIRE((has_entity ? rtypes::type_uuid(static_cast<int>(j))
+                              : rtypes::constants::kNoUUID) ==
+                  grid.cell_entity(5, j));
+    CATCH_REQUIRE(state::ekUNKNOWN == grid.cell_state(4, j));
+    CATCH_REQUIRE(state::ekUNKNOWN == grid.cell_state(6, j));
+  } /* for(j..) */
+
+  /* overwriting one cell leaves the others in its byte alone */
+  grid.cell_update(5, 1, state::ekEMPTY, rtypes::constants::kNoUUID);
+  CATCH_REQUIRE(state::ekEMPTY == grid.cell_state(5, 0));
+  CATCH_REQUIRE(state::ekEMPTY == grid.cell_state(5, 1));
+  CATCH_REQUIRE(state::ekHAS_CACHE == grid.cell_state(5, 2));
+  CATCH_REQUIRE(state::ekUNKNOWN == grid.cell_state(5, 3));
+}
+
+CATCH_TEST_CASE("reset-test", "[packed_cell_grid]") {
+  packed_cell_grid grid(100, 100);
+  grid.cell_update(10, 10, state::ekHAS_BLOCK, rtypes::type_uuid(1));
+  grid.cell_update(90, 90, state::ekEMPTY, rtypes::constants::kNoUUID);
+  CATCH_REQUIRE(2 == grid.tile_count());
+
+  grid.reset();
+  CATCH_REQUIRE(0 == grid.tile_count());
+  CATCH_REQUIRE(state::ekUNKNOWN == grid.cell_state(10, 10));
+  CATCH_REQUIRE(rtypes::constants::kNoUUID == grid.cell_entity(10, 10));
+  CATCH_REQUIRE(state::ekUNKNOWN == grid.cell_state(90, 90));
+
+  /* the grid is usable after a reset */
+  grid.cell_update(10, 10, state::ekHAS_CACHE, rtypes::type_uuid(2));
+  CATCH_REQUIRE(state::ekHAS_CACHE == grid.cell_state(10, 10));
+  CATCH_REQUIRE(rtypes::type_uuid(2) == grid.cell_entity(10, 10));
+}
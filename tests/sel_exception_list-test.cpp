@@ -0,0 +1,84 @@
+/**
+ * @file sel_exception_list-test.cpp
+ *
+ * @copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_PREFIX_ALL
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+
+#include "fordyca/controller/cognitive/sel_exception_list.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+using namespace fordyca::controller::cognitive;
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+CATCH_TEST_CASE("init-test", "[sel_exception_list]") {
+  sel_exception_list list;
+  CATCH_REQUIRE(list.empty());
+  CATCH_REQUIRE(0 == list.size());
+  CATCH_REQUIRE(!list.contains(rtypes::type_uuid(0)));
+}
+
+CATCH_TEST_CASE("contains-test", "[sel_exception_list]") {
+  sel_exception_list list;
+
+  /* added out of order, kept sorted for lookup */
+  for (int id : { 7, 2, 9, 0, 5 }) {
+    list.add(rtypes::type_uuid(id));
+  } /* for(id..) */
+  CATCH_REQUIRE(5 == list.size());
+  for (int id = 0; id < 10; ++id) {
+    bool expected = (0 == id || 2 == id || 5 == id || 7 == id || 9 == id);
+    CATCH_REQUIRE(expected == list.contains(rtypes::type_uuid(id)));
+  } /* for(id..) */
+}
+
+CATCH_TEST_CASE("version-test", "[sel_exception_list]") {
+  sel_exception_list list;
+  size_t version = list.version();
+
+  /* clearing an empty list is not a change */
+  list.clear();
+  CATCH_REQUIRE(version == list.version());
+
+  list.add(rtypes::type_uuid(3));
+  CATCH_REQUIRE(version != list.version());
+  version = list.version();
+
+  /* duplicates are ignored, and are not a change */
+  list.add(rtypes::type_uuid(3));
+  CATCH_REQUIRE(1 == list.size());
+  CATCH_REQUIRE(version == list.version());
+
+  list.add(rtypes::type_uuid(1));
+  CATCH_REQUIRE(version != list.version());
+  version = list.version();
+
+  list.clear();
+  CATCH_REQUIRE(list.empty());
+  CATCH_REQUIRE(!list.contains(rtypes::type_uuid(3)));
+  CATCH_REQUIRE(version != list.version());
+}
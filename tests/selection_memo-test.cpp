@@ -0,0 +1,193 @@
+/**
+ * @file selection_memo-test.cpp
+ *
+ * @copyright 2020 John Harwell, All rights reserved.
+ *
+ * This file is part of FORDYCA.
+ *
+ * FORDYCA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FORDYCA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FORDYCA.  If not, see <http://www.gnu.org/licenses/
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#define CATCH_CONFIG_PREFIX_ALL
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
+
+#include "fordyca/fsm/selection_memo.hpp"
+#include "fordyca/math/block_utility_batch.hpp"
+
+/*******************************************************************************
+ * Namespaces
+ ******************************************************************************/
+using namespace fordyca;
+
+using memo_type = fsm::selection_memo<int>;
+
+/*******************************************************************************
+ * Helper Functions
+ ******************************************************************************/
+static const double kRHO = 0.1;
+
+static cspconfig::pheromone_config config_make(void) {
+  cspconfig::pheromone_config config;
+  config.rho = kRHO;
+  config.repeat_deposit = false;
+  return config;
+}
+
+/**
+ * \brief Two blocks: one close to the robot with a high density, which is
+ * selected, and one further away with a low density, which overtakes it once
+ * densities have decayed enough.
+ */
+static math::utility_batch::result batch_calc(math::block_utility_batch* batch,
+                                              double scale) {
+  crepr::pheromone_density near(kRHO);
+  crepr::pheromone_density far(kRHO);
+  near.pheromone_set(1.0 * scale);
+  far.pheromone_set(0.1 * scale);
+  batch->add(rmath::vector2d(1.0, 0.0), near, 1.0);
+  batch->add(rmath::vector2d(5.0, 0.0), far, 1.0);
+  return batch->calc(rmath::vector2d(2.0, 0.0));
+}
+
+/*******************************************************************************
+ * Test Cases
+ ******************************************************************************/
+CATCH_TEST_CASE("decay-floor-test", "[selection_memo]") {
+  math::block_utility_batch batch(rmath::vector2d(0.0, 0.0));
+  auto res = batch_calc(&batch, 1.0);
+  CATCH_REQUIRE(0 == res.index);
+
+  double floor = batch.decay_floor(res);
+  CATCH_REQUIRE(floor > 0.0);
+  CATCH_REQUIRE(floor < 1.0);
+
+  /* the selection holds while densities stay above the floor... */
+  math::block_utility_batch above(rmath::vector2d(0.0, 0.0));
+  CATCH_REQUIRE(0 == batch_calc(&above, floor * 1.01).index);
+
+  /* ...and changes once they drop below it */
+  math::block_utility_batch below(rmath::vector2d(0.0, 0.0));
+  CATCH_REQUIRE(1 == batch_calc(&below, floor * 0.99).index);
+
+  /* nothing can overtake a selection which also decays more slowly */
+  math::block_utility_batch single(rmath::vector2d(0.0, 0.0));
+  crepr::pheromone_density d(kRHO);
+  d.pheromone_set(1.0);
+  single.add(rmath::vector2d(1.0, 0.0), d, 1.0);
+  auto single_res = single.calc(rmath::vector2d(2.0, 0.0));
+  CATCH_REQUIRE(0.0 == single.decay_floor(single_res));
+
+  /* no selection */
+  math::block_utility_batch none(rmath::vector2d(0.0, 0.0));
+  CATCH_REQUIRE(0.0 == none.decay_floor(none.calc(rmath::vector2d(2.0, 0.0))));
+}
+
+CATCH_TEST_CASE("key-test", "[selection_memo]") {
+  auto config = config_make();
+  ds::dpo_store store(&config);
+  fsm::selection_memo_counts counts;
+  memo_type memo(&store, &counts, rtypes::discretize_ratio(0.5));
+
+  int n_calls = 0;
+  auto select = [&]() {
+    ++n_calls;
+    return memo_type::computed{ n_calls, 0.0 };
+  };
+
+  CATCH_REQUIRE(1 == memo(rmath::vector2d(0.1, 0.1), 0, select));
+  CATCH_REQUIRE(0 == counts.n_hits(store.decay_epoch()));
+  CATCH_REQUIRE(1 == counts.n_misses(store.decay_epoch()));
+
+  /* same cell */
+  CATCH_REQUIRE(1 == memo(rmath::vector2d(0.3, 0.3), 0, select));
+  CATCH_REQUIRE(1 == counts.n_hits(store.decay_epoch()));
+
+  /* different cell */
+  CATCH_REQUIRE(2 == memo(rmath::vector2d(0.7, 0.1), 0, select));
+
+  /* different exception list version */
+  CATCH_REQUIRE(3 == memo(rmath::vector2d(0.7, 0.1), 1, select));
+  CATCH_REQUIRE(3 == memo(rmath::vector2d(0.7, 0.1), 1, select));
+
+  /* structural change to the store */
+  store.clear_all();
+  CATCH_REQUIRE(4 == memo(rmath::vector2d(0.7, 0.1), 1, select));
+
+  CATCH_REQUIRE(2 == counts.n_hits(store.decay_epoch()));
+  CATCH_REQUIRE(4 == counts.n_misses(store.decay_epoch()));
+  CATCH_REQUIRE(4 == n_calls);
+}
+
+CATCH_TEST_CASE("decay-test", "[selection_memo]") {
+  auto config = config_make();
+  ds::dpo_store store(&config);
+  memo_type memo(&store, nullptr, rtypes::discretize_ratio(0.5));
+  rmath::vector2d pos(0.1, 0.1);
+
+  int n_calls = 0;
+  double floor = 0.0;
+  auto select = [&]() {
+    ++n_calls;
+    return memo_type::computed{ n_calls, floor };
+  };
+
+  /* results which decay cannot change are reused indefinitely */
+  CATCH_REQUIRE(1 == memo(pos, 0, select));
+  for (size_t i = 0; i < 100; ++i) {
+    store.decay_all();
+    CATCH_REQUIRE(1 == memo(pos, 0, select));
+  } /* for(i..) */
+
+  /* results which any decay can change are only reused within an epoch */
+  floor = 1.0;
+  store.clear_all();
+  CATCH_REQUIRE(2 == memo(pos, 0, select));
+  CATCH_REQUIRE(2 == memo(pos, 0, select));
+  store.decay_all();
+  CATCH_REQUIRE(3 == memo(pos, 0, select));
+
+  /*
+   * 0.9^2 > 0.75 > 0.9^3, so the result is reused for 2 decay epochs after
+   * the one it was computed in.
+   */
+  floor = 0.75;
+  store.clear_all();
+  CATCH_REQUIRE(4 == memo(pos, 0, select));
+  store.decay_all();
+  CATCH_REQUIRE(4 == memo(pos, 0, select));
+  store.decay_all();
+  CATCH_REQUIRE(4 == memo(pos, 0, select));
+  store.decay_all();
+  CATCH_REQUIRE(5 == memo(pos, 0, select));
+}
+
+CATCH_TEST_CASE("counts-test", "[selection_memo]") {
+  fsm::selection_memo_counts counts;
+  counts.record(1, false);
+  counts.record(1, true);
+  counts.record(1, true);
+  CATCH_REQUIRE(2 == counts.n_hits(1));
+  CATCH_REQUIRE(1 == counts.n_misses(1));
+
+  /* counts are per decay epoch */
+  CATCH_REQUIRE(0 == counts.n_hits(2));
+  CATCH_REQUIRE(0 == counts.n_misses(2));
+  counts.record(2, true);
+  CATCH_REQUIRE(1 == counts.n_hits(2));
+  CATCH_REQUIRE(0 == counts.n_misses(2));
+  CATCH_REQUIRE(0 == counts.n_hits(1));
+}